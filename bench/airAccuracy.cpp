@@ -0,0 +1,648 @@
+/******************************************************************************
+||  airAccuracy.cpp      (implementation file)                               ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Accuracy harness for the evaluation paths of the equilibrium air ADT.  ||
+||    Every backend (calculateProperties, AirStream, and AirTaylorCache at   ||
+||    two settings) is compared with the long double reference of            ||
+||    AirReference over a dense (log P, T) grid and uniformly random         ||
+||    samples.  The maximum and mean relative error of each property, the    ||
+||    state of the largest error, an error map over (log P, T), and the      ||
+||    ns/state of each backend are reported as JSON so that speed and        ||
+||    accuracy can be traded with numbers.                                   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airReference.h                                                         ||
+||    airStream.h                                                            ||
+||    airTaylorCache.h                                                       ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airAccuracy.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airConstexpr.h"
+#include "airPrecision.h"
+#include "airReference.h"
+#include "airStream.h"
+#include "airTaylorCache.h"
+#include "benchSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
+/******************************************************
+**                    Backends                       **
+******************************************************/
+
+static const uint32 NUM_PROPERTIES = AirReference::NUM_PROPERTIES;
+
+/** A backend evaluates every state and stores NUM_PROPERTIES values per
+ *  state (in AirReference::Property order) into values.  */
+typedef void (*AccuracyKernel)(const std::vector<BenchState> &states,
+                               std::vector<double> &values);
+
+static void runAir (const std::vector<BenchState> &states,
+                    std::vector<double> &values)
+{
+    Air air;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        AirReference::extract(air, &values[i * NUM_PROPERTIES]);
+    }
+
+    return;
+}
+
+static void runStream (const std::vector<BenchState> &states,
+                       std::vector<double> &values)
+{
+    Air air;
+    AirStream stream;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        stream.calculateProperties(states[i].pressure, states[i].temperature,
+                                   air);
+        AirReference::extract(air, &values[i * NUM_PROPERTIES]);
+    }
+
+    return;
+}
+
+static void runTaylorCache (const std::vector<BenchState> &states,
+                            std::vector<double> &values,
+                            double tolerance, uint32 order)
+{
+    Air air;
+    AirTaylorCache cache(tolerance, order);
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        cache.calculateProperties(states[i].pressure, states[i].temperature,
+                                  air);
+        AirReference::extract(air, &values[i * NUM_PROPERTIES]);
+    }
+
+    return;
+}
+
+static void runTaylor2 (const std::vector<BenchState> &states,
+                        std::vector<double> &values)
+{  runTaylorCache(states, values, 1E-6, 2);  }
+
+static void runTaylor1 (const std::vector<BenchState> &states,
+                        std::vector<double> &values)
+{  runTaylorCache(states, values, 1E-4, 1);  }
+
+template <typename Real>
+static void runPrecision (const std::vector<BenchState> &states,
+                          std::vector<double> &values)
+{
+    AirPrecision<Real> air;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        double *row = &values[i * NUM_PROPERTIES];
+
+        air.calculateProperties(Real(states[i].pressure),
+                                Real(states[i].temperature));
+
+        row[AirReference::ENTHALPY]      = air.getEnthalpy();
+        row[AirReference::SPECIFIC_HEAT] = air.getSpecificHeat();
+        row[AirReference::THERMAL_COND]  = air.getThermalConductivity();
+        row[AirReference::VISCOSITY]     = air.getDynamicViscosity();
+        row[AirReference::COMP_FACTOR]   = air.getCompressibilityFactor();
+        row[AirReference::DENSITY]       = air.getDensity();
+        row[AirReference::GAMMA]         = air.getGamma();
+        row[AirReference::SOUND_SPEED]   = air.getSoundSpeed();
+        row[AirReference::ENTROPY]       = air.getEntropy();
+        row[AirReference::PRANDTL]       = air.getPrandtlNumber();
+    }
+
+    return;
+}
+
+static void runConstexpr (const std::vector<BenchState> &states,
+                          std::vector<double> &values)
+{
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        double *row = &values[i * NUM_PROPERTIES];
+        AirConstexpr::State state =
+            AirConstexpr::state(states[i].pressure, states[i].temperature);
+
+        row[AirReference::ENTHALPY]      = state.enthalpy;
+        row[AirReference::SPECIFIC_HEAT] = state.specificHeat;
+        row[AirReference::THERMAL_COND]  = state.thermalCond;
+        row[AirReference::VISCOSITY]     = state.viscosity;
+        row[AirReference::COMP_FACTOR]   = state.compFactor;
+        row[AirReference::DENSITY]       = state.density;
+        row[AirReference::GAMMA]         = state.gamma;
+        row[AirReference::SOUND_SPEED]   = state.soundSpeed;
+        row[AirReference::ENTROPY]       = state.entropy;
+        row[AirReference::PRANDTL]       = state.prandtl;
+    }
+
+    return;
+}
+
+/**
+ *  @struct AccuracyBackend One evaluation path compared with the
+ *          reference.
+*/
+struct AccuracyBackend
+{
+    const char *name;
+    AccuracyKernel kernel;
+};
+
+static const AccuracyBackend backends[] =
+{
+    { "calculateProperties",         runAir               },
+    { "AirStream",                   runStream            },
+    { "AirTaylorCache(1E-6,2)",      runTaylor2           },
+    { "AirTaylorCache(1E-4,1)",      runTaylor1           },
+    { "AirDouble",                   runPrecision<double> },
+    { "AirFloat",                    runPrecision<float>  },
+    { "AirConstexpr",                runConstexpr         }
+};
+
+static const uint32 numBackends = sizeof(backends) / sizeof(backends[0]);
+
+/******************************************************
+**                    Samples                        **
+******************************************************/
+
+// Upper limit of the curve fits [units: K]
+static const double T_MAX = 30000.0;
+
+// The entropy passes through zero near the reference state, so its
+// error is taken relative to at least this magnitude [units: kJ/kg-K].
+static const double ENTROPY_SCALE = 1.0;
+
+/** Build a dense (log P, T) grid.  Each isobar is swept with increasing
+ *  temperature, in the order a trajectory or sweep would visit it.
+ *
+ *  @pre nP > 1 and nT > 1.
+ *  @post states holds nP * nT states.
+ *  @param states The destination vector.
+ *  @param nP The number of isobars (1E-4 to 100 atm).
+ *  @param nT The number of temperatures on each isobar.
+ *  @param tMin The lowest temperature [units: K].
+ *  @return none.
+*/
+static void denseSamples (std::vector<BenchState> &states, uint32 nP,
+                          uint32 nT, double tMin)
+{
+    for (uint32 i = 0; i < nP; ++i)
+    {
+        double logP = -4.0 + 6.0 * double(i) / double(nP - 1);
+
+        for (uint32 j = 0; j < nT; ++j)
+        {
+            BenchState state;
+
+            //   0.101325 = conversion factor atm -> MPa
+            state.pressure = pow(10.0, logP) * 0.101325;
+            state.temperature = tMin + (T_MAX - tMin) * double(j)
+                                       / double(nT - 1);
+            state.enthalpy = 0.0;
+
+            states.push_back(state);
+        }
+    }
+
+    return;
+}
+
+/** Build uniformly random samples in (log P, T).
+ *
+ *  @pre none.
+ *  @post states holds count states.
+ *  @param states The destination vector.
+ *  @param count The number of states.
+ *  @param tMin The lowest temperature [units: K].
+ *  @param seed The seed of the pseudo-random generator.
+ *  @return none.
+*/
+static void randomSamples (std::vector<BenchState> &states, uint32 count,
+                           double tMin, uint64 seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        BenchState state;
+
+        state.pressure = pow(10.0, -4.0 + 6.0 * unit(rng)) * 0.101325;
+        state.temperature = tMin + (T_MAX - tMin) * unit(rng);
+        state.enthalpy = 0.0;
+
+        states.push_back(state);
+    }
+
+    return;
+}
+
+/******************************************************
+**                  Error Summary                    **
+******************************************************/
+
+/**
+ *  @struct ErrorMap The largest relative error of one property in
+ *          each (log P, T) cell.
+*/
+struct ErrorMap
+{
+    uint32 nP,                  // Number of log P bins (1E-4 to 100 atm)
+           nT;                  // Number of temperature bins
+    double tMin;                // Lower edge of the first T bin [K]
+    std::vector<double> cells;  // nP * nT maxima, isobar bins first
+
+    /** Record an error.
+     *
+     *  @pre cells holds nP * nT entries.
+     *  @post The maximum of the cell holding the state is updated.
+     *  @param state The sampled state.
+     *  @param error The relative error at the state.
+     *  @return none.
+    */
+    void add (const BenchState &state, double error)
+    {
+        double u = (log10(state.pressure / 0.101325) + 4.0) / 6.0,
+               v = (state.temperature - tMin) / (T_MAX - tMin);
+
+        uint32 i = std::min(uint32(std::max(u, 0.0) * nP), nP - 1),
+               j = std::min(uint32(std::max(v, 0.0) * nT), nT - 1);
+
+        double &cell = cells[i * nT + j];
+
+        if (!std::isnan(cell) && !(error <= cell))  // NaN errors stick
+            cell = error;
+
+        return;
+    }
+};
+
+/**
+ *  @struct PropertyError The error summary of one property.
+*/
+struct PropertyError
+{
+    double maxRel,                  // Largest relative error
+           sumRel;                  // Sum of the relative errors
+    uint32 compared,                // States with a finite reference
+           undefined;               // States without (e.g. gamma < 0)
+    BenchState maxAt;               // State of the largest error
+};
+
+/**
+ *  @struct SetResult The comparison of one backend over one sample set.
+*/
+struct SetResult
+{
+    const char *set;
+    uint32 states;
+    double nsPerState;              // Fastest of the timed passes
+    PropertyError errors[AirReference::NUM_PROPERTIES];
+};
+
+/** Compare a backend with the reference over one sample set.
+ *
+ *  @pre reference holds NUM_PROPERTIES values per state.
+ *  @post The error maps of the backend are updated.
+ *  @param backend The backend to be compared.
+ *  @param set The name of the sample set.
+ *  @param states The sample set.
+ *  @param reference The reference values of the sample set.
+ *  @param maps The error maps of the backend (one per property).
+ *  @return The error summary and timing of the backend.
+*/
+static SetResult compare (const AccuracyBackend &backend, const char *set,
+                          const std::vector<BenchState> &states,
+                          const std::vector<long double> &reference,
+                          std::vector<ErrorMap> &maps)
+{
+    SetResult result;
+    std::vector<double> values(states.size() * NUM_PROPERTIES);
+
+    result.set = set;
+    result.states = uint32(states.size());
+    result.nsPerState = HUGE_VAL;
+
+    // The first pass warms up; the fastest of the next three is kept.
+    for (uint32 pass = 0; pass < 4; ++pass)
+    {
+        double start = benchSeconds();
+        backend.kernel(states, values);
+        double elapsed = benchSeconds() - start;
+
+        if (pass > 0)
+            result.nsPerState = std::min(result.nsPerState, elapsed * 1E9
+                                             / double(states.size()));
+    }
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        PropertyError &error = result.errors[p];
+
+        error.maxRel = 0.0;
+        error.sumRel = 0.0;
+        error.compared = 0;
+        error.undefined = 0;
+        error.maxAt = states[0];
+
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            long double ref = reference[i * NUM_PROPERTIES + p],
+                        scale = fabsl(ref);
+
+            // The fits themselves are undefined at a few states (cp
+            // below the gas constant makes the sound speed imaginary);
+            // there is nothing to compare with.
+            if (!std::isfinite(ref))
+            {
+                ++error.undefined;
+                continue;
+            }
+
+            if (p == AirReference::ENTROPY)
+                scale = std::max(scale, (long double)ENTROPY_SCALE);
+
+            double rel = double(fabsl(values[i * NUM_PROPERTIES + p] - ref)
+                                / scale);
+
+            if (!std::isnan(error.maxRel) && !(rel <= error.maxRel))
+            {
+                error.maxRel = rel;
+                error.maxAt = states[i];
+            }
+
+            error.sumRel += rel;
+            ++error.compared;
+            maps[p].add(states[i], rel);
+        }
+    }
+
+    return result;
+}
+
+/** Format an error for JSON output (non-finite errors become null).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param value The error.
+ *  @return The JSON number or null.
+*/
+static std::string jsonError (double value)
+{
+    char text[32];
+
+    if (std::isfinite(value))
+        snprintf(text, sizeof(text), "%.4e", value);
+    else
+        snprintf(text, sizeof(text), "null");
+
+    return text;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --grid NP,NT     dense grid isobars, temperatures (61,600)\n"
+            "  --random N       random samples (default 20000)\n"
+            "  --tmin T         lowest temperature in K (default 200)\n"
+            "  --map NP,NT      error map bins (default 12,30)\n"
+            "  --seed N         random sample seed (default 2014)\n"
+            "  --filter TEXT    only compare backends whose name has TEXT\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 gridP = 61, gridT = 600,
+           randomCount = 20000,
+           mapP = 12, mapT = 30;
+    double tMin = 200.0;
+    uint64 seed = 2014;
+    const char *filter = NULL,
+               *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--grid") && hasValue)
+        {
+            if (sscanf(argv[++i], "%u,%u", &gridP, &gridT) != 2)
+                gridP = 0;
+        }
+        else if (!strcmp(argv[i], "--random") && hasValue)
+            randomCount = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--tmin") && hasValue)
+            tMin = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--map") && hasValue)
+        {
+            if (sscanf(argv[++i], "%u,%u", &mapP, &mapT) != 2)
+                mapP = 0;
+        }
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--filter") && hasValue)
+            filter = argv[++i];
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((gridP < 2) || (gridT < 2) || (randomCount == 0) || (mapP == 0)
+        || (mapT == 0) || !(tMin > 0.0) || !(tMin < T_MAX))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airAccuracy: cannot open %s\n", output);
+        return 1;
+    }
+
+    // Sample sets and their reference values
+    const char *setNames[2] = { "dense", "random" };
+    std::vector<BenchState> sets[2];
+    std::vector<long double> reference[2];
+
+    denseSamples(sets[0], gridP, gridT, tMin);
+    randomSamples(sets[1], randomCount, tMin, seed);
+
+    for (uint32 s = 0; s < 2; ++s)
+    {
+        reference[s].resize(sets[s].size() * NUM_PROPERTIES);
+
+        for (size_t i = 0; i < sets[s].size(); ++i)
+            AirReference::evaluate(sets[s][i].pressure,
+                                   sets[s][i].temperature,
+                                   &reference[s][i * NUM_PROPERTIES]);
+    }
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airAccuracy");
+    fprintf(out, "  \"reference\": \"long double (%u-bit mantissa)\",\n",
+            uint32(std::numeric_limits<long double>::digits));
+    fprintf(out, "  \"dense_grid\": [%u, %u],\n", gridP, gridT);
+    fprintf(out, "  \"random_states\": %u,\n", randomCount);
+    fprintf(out, "  \"t_min_k\": %g,\n", tMin);
+    fprintf(out, "  \"seed\": %llu,\n", seed);
+    fprintf(out, "  \"error_map\": { \"log10_p_atm\": [-4, 2, %u], "
+            "\"temperature_k\": [%g, %g, %u] },\n", mapP, tMin, T_MAX, mapT);
+    fprintf(out, "  \"backends\": [");
+
+    bool first = true;
+
+    for (uint32 b = 0; b < numBackends; ++b)
+    {
+        if (filter && !strstr(backends[b].name, filter))
+            continue;
+
+        ErrorMap empty;
+        empty.nP = mapP;
+        empty.nT = mapT;
+        empty.tMin = tMin;
+        empty.cells.assign(size_t(mapP) * mapT, 0.0);
+
+        std::vector<ErrorMap> maps(NUM_PROPERTIES, empty);
+
+        fprintf(out, "%s\n    {\n", first ? "" : ",");
+        fprintf(out, "      \"name\": %s,\n",
+                benchJsonString(backends[b].name).c_str());
+        fprintf(out, "      \"sets\": [");
+
+        for (uint32 s = 0; s < 2; ++s)
+        {
+            SetResult result = compare(backends[b], setNames[s], sets[s],
+                                       reference[s], maps);
+
+            fprintf(stderr, "%-24s %-7s %8.1f ns/state\n", backends[b].name,
+                    result.set, result.nsPerState);
+
+            fprintf(out, "%s\n        {\n", s ? "," : "");
+            fprintf(out, "          \"set\": \"%s\",\n", result.set);
+            fprintf(out, "          \"states\": %u,\n", result.states);
+            fprintf(out, "          \"ns_per_state\": %.3f,\n",
+                    result.nsPerState);
+            fprintf(out, "          \"properties\": {");
+
+            for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+            {
+                const PropertyError &error = result.errors[p];
+                double mean = error.sumRel
+                            / double(std::max(error.compared, 1u));
+
+                fprintf(stderr, "    %-14s max %.3e  mean %.3e\n",
+                        AirReference::name(p), error.maxRel, mean);
+
+                fprintf(out, "%s\n            \"%s\": { \"max_rel\": %s, "
+                        "\"mean_rel\": %s, \"max_at\": [%.9g, %.9g], "
+                        "\"undefined\": %u }",
+                        p ? "," : "", AirReference::name(p),
+                        jsonError(error.maxRel).c_str(),
+                        jsonError(mean).c_str(), error.maxAt.pressure,
+                        error.maxAt.temperature, error.undefined);
+            }
+
+            fprintf(out, "\n          }\n        }");
+        }
+
+        fprintf(out, "\n      ],\n");
+        fprintf(out, "      \"error_map\": {");
+
+        for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+        {
+            fprintf(out, "%s\n        \"%s\": [", p ? "," : "",
+                    AirReference::name(p));
+
+            for (uint32 i = 0; i < mapP; ++i)
+            {
+                fprintf(out, "%s\n          [", i ? "," : "");
+
+                for (uint32 j = 0; j < mapT; ++j)
+                    fprintf(out, "%s%s", j ? ", " : "",
+                            jsonError(maps[p].cells[i * mapT + j]).c_str());
+
+                fprintf(out, "]");
+            }
+
+            fprintf(out, "\n        ]");
+        }
+
+        fprintf(out, "\n      }\n    }");
+
+        first = false;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
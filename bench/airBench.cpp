@@ -0,0 +1,686 @@
+/******************************************************************************
+||  airBench.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Single-thread microbenchmarks of every evaluation path of the          ||
+||    equilibrium air ADT (calculateProperties, calculateProps_PH, each      ||
+||    curve fit helper, AirStream, and AirTaylorCache) over the standard     ||
+||    input regimes.  The timings are reported in ns/state as a JSON         ||
+||    document so that the effect of each performance change can be          ||
+||    tracked.  With --check, the cost of an AirTaylorCache miss and of      ||
+||    an AirTrace capture relative to calculateProperties is checked.        ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airStream.h                                                            ||
+||    airTaylorCache.h                                                       ||
+||    airTrace.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airBench.cpp
+ *  @date 2026-10-18
+*/
+
+#include "benchSupport.h"
+#include "airBatch.h"
+#include "airConstexpr.h"
+#include "airEvaluator.h"
+#include "airPrecision.h"
+#include "airStream.h"
+#include "airTaylorCache.h"
+#include "airTrace.h"
+
+#include <cstdlib>
+#include <cstring>
+
+/******************************************************
+**                  Benchmark Kernels                **
+******************************************************/
+
+static double runProperties (const std::vector<BenchState> &states)
+{
+    Air air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        sum += air.getDensity();
+    }
+
+    return sum;
+}
+
+static double runPropsPH (const std::vector<BenchState> &states)
+{
+    Air air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProps_PH(states[i].pressure, states[i].enthalpy);
+        sum += air.getTemperature();
+    }
+
+    return sum;
+}
+
+// The curve fit helpers are timed through the single-property
+// evaluators, which call only the helper of that property.
+template <typename Property>
+static double runHelper (const std::vector<BenchState> &states)
+{
+    Air::Evaluator<Property> air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        sum += air.template get<Property>();
+    }
+
+    return sum;
+}
+
+static double runStream (const std::vector<BenchState> &states)
+{
+    AirStream stream;
+    Air air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        stream.calculateProperties(states[i].pressure,
+                                   states[i].temperature, air);
+        sum += air.getDensity();
+    }
+
+    return sum;
+}
+
+static double runTaylorCache (const std::vector<BenchState> &states)
+{
+    AirTaylorCache cache(1E-6, 2);
+    Air air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        cache.calculateProperties(states[i].pressure,
+                                  states[i].temperature, air);
+        sum += air.getDensity();
+    }
+
+    return sum;
+}
+
+template <typename Real>
+static double runPrecision (const std::vector<BenchState> &states)
+{
+    AirPrecision<Real> air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(Real(states[i].pressure),
+                                Real(states[i].temperature));
+        sum += air.getDensity();
+    }
+
+    return sum;
+}
+
+template <typename Real>
+static double runPrecisionPH (const std::vector<BenchState> &states)
+{
+    AirPrecision<Real> air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProps_PH(Real(states[i].pressure),
+                              Real(states[i].enthalpy));
+        sum += air.getTemperature();
+    }
+
+    return sum;
+}
+
+template <typename First, typename Second>
+static double runEvaluator (const std::vector<BenchState> &states)
+{
+    Air::Evaluator<First, Second> air;
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        sum += air.template get<First>() + air.template get<Second>();
+    }
+
+    return sum;
+}
+
+template <uint32 SCHEDULE>
+static double runBatch (const std::vector<BenchState> &states)
+{
+    static const uint32 columns[] =
+    {
+        AirBatch::DENSITY, AirBatch::ENTHALPY, AirBatch::VISCOSITY,
+        AirBatch::THERMAL_COND
+    };
+
+    AirBatch batch;
+    std::vector<double> pairs(2 * states.size()),
+                        values(4 * states.size());
+    double sum = 0.0;
+
+    batch.setColumns(columns, 4);
+    batch.setSchedule(SCHEDULE);
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        pairs[2 * i] = states[i].pressure;
+        pairs[2 * i + 1] = states[i].temperature;
+    }
+
+    batch.evaluate(AirBatch::INPUT_PT, &pairs[0], states.size(),
+                   &values[0]);
+
+    for (size_t i = 0; i < states.size(); ++i)
+        sum += values[4 * i];
+
+    return sum;
+}
+
+// The regime schedule evaluates its bins through an AirStream; the same
+// rows in input order separate the gain of the sort from that of the
+// cached coefficient rows.
+static double runStreamBatch (const std::vector<BenchState> &states)
+{
+    AirStream stream;
+    Air air;
+    std::vector<double> pairs(2 * states.size()),
+                        values(4 * states.size());
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        pairs[2 * i] = states[i].pressure;
+        pairs[2 * i + 1] = states[i].temperature;
+    }
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        stream.calculateProperties(pairs[2 * i], pairs[2 * i + 1], air);
+        values[4 * i] = air.getDensity();
+        values[4 * i + 1] = air.getEnthalpy();
+        values[4 * i + 2] = air.getDynamicViscosity();
+        values[4 * i + 3] = air.getThermalConductivity();
+    }
+
+    for (size_t i = 0; i < states.size(); ++i)
+        sum += values[4 * i];
+
+    return sum;
+}
+
+static double runConstexpr (const std::vector<BenchState> &states)
+{
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+        sum += AirConstexpr::state(states[i].pressure,
+                                   states[i].temperature).density;
+
+    return sum;
+}
+
+// The sweep kernels read density, specific heat, and temperature from
+// one per-cell array of AirState or Air per input state.  The arrays
+// are filled during the untimed warm-up pass, whenever the kernel is
+// given a different set of states (told apart by their count and
+// their first and last inputs); run them with --states 1048576 to
+// sweep 1M cells.
+static bool sweepStale (const std::vector<BenchState> &states,
+                        BenchState (&swept)[2], size_t &numSwept)
+{
+    const BenchState &first = states.front(),
+                     &last = states.back();
+
+    if ((numSwept == states.size())
+        && (swept[0].pressure == first.pressure)
+        && (swept[0].temperature == first.temperature)
+        && (swept[1].pressure == last.pressure)
+        && (swept[1].temperature == last.temperature))
+        return false;
+
+    swept[0] = first;
+    swept[1] = last;
+    numSwept = states.size();
+    return true;
+}
+
+static double runStateSweep (const std::vector<BenchState> &states)
+{
+    static BenchState swept[2];
+    static size_t numSwept = 0;
+    static AirState *cells = NULL;
+
+    if (sweepStale(states, swept, numSwept))
+    {
+        void *memory = NULL;
+
+        free(cells);
+
+        if (posix_memalign(&memory, 64, states.size() * sizeof(AirState)))
+        {
+            fprintf(stderr, "airBench: cannot allocate the sweep\n");
+            exit(1);
+        }
+
+        cells = static_cast<AirState *>(memory);
+
+        Air air;
+
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            air.calculateProperties(states[i].pressure,
+                                    states[i].temperature);
+            cells[i] = air.getState();
+        }
+    }
+
+    double sum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+        sum += cells[i].density + cells[i].specificHeat
+               + cells[i].temperature;
+
+    return sum;
+}
+
+static double runAirSweep (const std::vector<BenchState> &states)
+{
+    static BenchState swept[2];
+    static size_t numSwept = 0;
+    static std::vector<Air> cells;
+
+    if (sweepStale(states, swept, numSwept))
+    {
+        cells.assign(states.size(), Air());
+
+        for (size_t i = 0; i < cells.size(); ++i)
+            cells[i].calculateProperties(states[i].pressure,
+                                         states[i].temperature);
+    }
+
+    double sum = 0.0;
+
+    for (size_t i = 0; i < cells.size(); ++i)
+        sum += cells[i].getDensity() + cells[i].getSpecificHeat()
+               + cells[i].getTemperature();
+
+    return sum;
+}
+
+/**
+ *  @struct BenchPath One evaluation path of the ADT.
+*/
+struct BenchPath
+{
+    const char *name;
+    BenchKernel kernel;
+    bool boundedEnthalpy;  // Skip states above BENCH_PH_MAX_ENTHALPY
+};
+
+static const BenchPath paths[] =
+{
+    { "calculateProperties",    runProperties,          false },
+    { "calculateProps_PH",      runPropsPH,             true  },
+    { "_calculateEnthalpy",
+      runHelper<Air::Enthalpy>,                             false },
+    { "_calculateSpecificHeat",
+      runHelper<Air::SpecificHeat>,                         false },
+    { "_calculateThermalCond",
+      runHelper<Air::ThermalConductivity>,                  false },
+    { "_calculateViscosity",
+      runHelper<Air::DynamicViscosity>,                     false },
+    { "_calculateCompFactor",
+      runHelper<Air::CompressibilityFactor>,                false },
+    { "AirStream",              runStream,              false },
+    { "AirTaylorCache",         runTaylorCache,         false },
+    { "AirDouble",              runPrecision<double>,   false },
+    { "AirDouble PH",           runPrecisionPH<double>, true  },
+    { "AirFloat",               runPrecision<float>,    false },
+    { "AirFloat PH",            runPrecisionPH<float>,  true  },
+    { "AirConstexpr",           runConstexpr,           false },
+    { "Evaluator<Density, Viscosity>",
+      runEvaluator<Air::Density, Air::Viscosity>,           false },
+    { "Evaluator<Enthalpy, SpecificHeat>",
+      runEvaluator<Air::Enthalpy, Air::SpecificHeat>,       false },
+    { "AirBatch",        runBatch<AirBatch::SCHEDULE_INPUT>,  false },
+    { "AirBatch stream", runStreamBatch,                      false },
+    { "AirBatch regime", runBatch<AirBatch::SCHEDULE_REGIME>, false },
+    { "AirState sweep",         runStateSweep,          false },
+    { "Air sweep",              runAirSweep,            false }
+};
+
+static const uint32 numPaths = sizeof(paths) / sizeof(paths[0]);
+
+/******************************************************
+**                      Checks                       **
+******************************************************/
+
+/**
+ *  @struct BenchCheck A kernel whose cost relative to
+ *          calculateProperties must stay under a limit.
+*/
+struct BenchCheck
+{
+    const char *name,      // JSON name
+               *label,     // Console label
+               *regime;    // Input regime
+    BenchKernel kernel;
+    bool traced;           // The kernel passes are recorded by AirTrace
+    double limit;          // Largest accepted ratio to the direct call
+};
+
+// The scratch trace of the capture check (removed afterwards).
+static const char TRACE_PATH[] = "airBench.trace";
+
+// A miss of AirTaylorCache, and a call recorded by AirTrace with its
+// outputs, may cost at most 5% more than a direct calculateProperties
+// call.  The capture check needs a build with AIR_ENABLE_TRACE.
+static const BenchCheck checks[] =
+{
+    { "taylor_miss_cost",   "AirTaylorCache miss / direct", "random_mixed",
+      runTaylorCache, false, 1.05 },
+    { "trace_capture_cost", "AirTrace outputs / direct",    "random_mixed",
+      runProperties,  true,  1.05 }
+};
+
+static const uint32 numChecks = sizeof(checks) / sizeof(checks[0]);
+
+/** Time a checked kernel against calculateProperties.  The two are
+ *  timed in alternating passes and the fastest pass of each is
+ *  compared, which cancels most of the clock drift of a shared
+ *  machine.  A traced pass starts a trace (with outputs) before the
+ *  timer and stops it inside, so the timing includes the capture, the
+ *  background writer and the final flush.
+ *
+ *  @pre states is not empty.
+ *  @post none.
+ *  @param check The check.
+ *  @param states The input states.
+ *  @param minTime The minimum total time of the timed passes [s].
+ *  @return The ratio of the fastest passes, kernel / direct, or a
+ *          negative value when the trace cannot be recorded.
+*/
+static double checkRatio (const BenchCheck &check,
+                          const std::vector<BenchState> &states,
+                          double minTime)
+{
+    BenchKernel kernels[2] = { runProperties, check.kernel };
+    double fastest[2] = { HUGE_VAL, HUGE_VAL },
+           total = 0.0;
+    volatile double checksum = kernels[0](states) + kernels[1](states);
+
+    for (uint32 pass = 0; (pass < 10) || (total < 2.0 * minTime); ++pass)
+    {
+        for (uint32 k = 0; k < 2; ++k)
+        {
+            bool traced = check.traced && (k == 1);
+
+            if (traced && !AirTrace::start(TRACE_PATH, true))
+                return -1.0;
+
+            double start = benchSeconds();
+            checksum = checksum + kernels[k](states);
+
+            if (traced)
+                AirTrace::stop();
+
+            double elapsed = benchSeconds() - start;
+
+            total += elapsed;
+
+            if (elapsed < fastest[k])
+                fastest[k] = elapsed;
+        }
+    }
+
+    if (check.traced)
+        remove(TRACE_PATH);
+
+    return fastest[1] / fastest[0];
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --states N      states per regime (default 4096)\n"
+            "  --min-time S    minimum timed seconds per case (default 0.2)\n"
+            "  --seed N        input generator seed (default 2014)\n"
+            "  --filter TEXT   only run the cases whose label contains TEXT\n"
+            "  --check         also run the pass/fail checks (exit 1 on a\n"
+            "                  failure)\n"
+            "  --output FILE   write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 count = 4096;
+    double minTime = 0.2;
+    uint64 seed = 2014;
+    const char *filter = NULL,
+               *output = NULL;
+    bool check = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--states") && hasValue)
+            count = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--min-time") && hasValue)
+            minTime = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--filter") && hasValue)
+            filter = argv[++i];
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else if (!strcmp(argv[i], "--check"))
+            check = true;
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (count == 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airBench: cannot open %s\n", output);
+        return 1;
+    }
+
+    std::vector<BenchRegime> regimes;
+    benchRegimes(regimes, count, seed);
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airBench");
+    fprintf(out, "  \"states_per_regime\": %u,\n", count);
+    fprintf(out, "  \"min_time_s\": %g,\n", minTime);
+    fprintf(out, "  \"seed\": %llu,\n", seed);
+    benchJsonCountersInfo(out);
+    fprintf(out, "  \"results\": [");
+
+    bool first = true;
+
+    for (uint32 p = 0; p < numPaths; ++p)
+    {
+        for (size_t r = 0; r < regimes.size(); ++r)
+        {
+            std::string label = std::string(paths[p].name) + "/"
+                              + regimes[r].name;
+
+            if (filter && (label.find(filter) == std::string::npos))
+                continue;
+
+            std::vector<BenchState> states;
+
+            for (size_t i = 0; i < regimes[r].states.size(); ++i)
+            {
+                const BenchState &state = regimes[r].states[i];
+
+                if (!paths[p].boundedEnthalpy
+                    || (state.enthalpy <= BENCH_PH_MAX_ENTHALPY))
+                    states.push_back(state);
+            }
+
+            if (states.empty())
+                continue;
+
+            BenchResult result = benchMeasure(paths[p].kernel, states,
+                                              minTime);
+
+            fprintf(stderr, "%-48s %10.1f ns/state (median %.1f)\n",
+                    label.c_str(), result.nsMin, result.nsMedian);
+
+            fprintf(out, "%s\n    {\n", first ? "" : ",");
+            fprintf(out, "      \"path\": %s,\n",
+                    benchJsonString(paths[p].name).c_str());
+            fprintf(out, "      \"regime\": %s,\n",
+                    benchJsonString(regimes[r].name).c_str());
+            fprintf(out, "      \"description\": %s,\n",
+                    benchJsonString(regimes[r].description).c_str());
+            fprintf(out, "      \"states\": %u,\n",
+                    uint32(states.size()));
+            fprintf(out, "      \"passes\": %u,\n", result.passes);
+            fprintf(out, "      \"ns_per_state_min\": %.3f,\n", result.nsMin);
+            fprintf(out, "      \"ns_per_state_median\": %.3f,\n",
+                    result.nsMedian);
+            fprintf(out, "      \"ns_per_state_mean\": %.3f,\n",
+                    result.nsMean);
+            fprintf(out, "      \"checksum\": %.17g,\n      ",
+                    result.checksum);
+            benchJsonCounters(out, result);
+            fprintf(out, "\n    }");
+
+            first = false;
+        }
+    }
+
+    fprintf(out, "\n  ],\n");
+
+    bool passed = true;
+
+    if (check)
+    {
+        fprintf(out, "  \"checks\": [");
+
+        bool firstCheck = true;
+
+        for (uint32 c = 0; c < numChecks; ++c)
+        {
+            if (checks[c].traced && !AirTrace::enabled())
+            {
+                fprintf(stderr, "check: %s skipped (needs "
+                        "AIR_ENABLE_TRACE)\n", checks[c].label);
+                continue;
+            }
+
+            for (size_t r = 0; r < regimes.size(); ++r)
+            {
+                if (regimes[r].name != checks[c].regime)
+                    continue;
+
+                double ratio = checkRatio(checks[c], regimes[r].states,
+                                          minTime);
+                bool ok = (ratio >= 0.0) && (ratio <= checks[c].limit);
+                std::string label = std::string("check: ")
+                                  + checks[c].label;
+
+                passed = passed && ok;
+
+                fprintf(stderr, "%-48s %10.3f (limit %.2f) %s\n",
+                        label.c_str(), ratio, checks[c].limit,
+                        ok ? "passed" : "FAILED");
+
+                fprintf(out, "%s\n    {\n", firstCheck ? "" : ",");
+                fprintf(out, "      \"name\": \"%s\",\n", checks[c].name);
+                fprintf(out, "      \"regime\": \"%s\",\n",
+                        checks[c].regime);
+                fprintf(out, "      \"ratio\": %.4f,\n", ratio);
+                fprintf(out, "      \"limit\": %.2f,\n", checks[c].limit);
+                fprintf(out, "      \"passed\": %s\n    }",
+                        ok ? "true" : "false");
+
+                firstCheck = false;
+            }
+        }
+
+        fprintf(out, "\n  ],\n");
+    }
+
+    benchJsonStats(out);
+    fprintf(out, "\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,310 @@
+/******************************************************************************
+||  airCoalesce.cpp      (implementation file)                               ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Benchmark of the duplicate input detection of AirBatch.  Batches with  ||
+||    no duplicates, runs of equal states, a uniform block, shuffled         ||
+||    duplicates, and duplicates that differ in the last bits are evaluated  ||
+||    with every Coalesce mode.  Reports the time per state of each case     ||
+||    and the largest relative difference from the rows of a plain           ||
+||    evaluation.                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airCoalesce.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+#include "benchSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// Output columns of the batches.
+static const uint32 COLUMNS[] =
+{
+    AirBatch::DENSITY, AirBatch::ENTHALPY, AirBatch::VISCOSITY,
+    AirBatch::THERMAL_COND
+};
+
+static const uint32 NUM_COLUMNS = 4;
+
+/**
+ *  @struct CoalesceCase One input batch.
+*/
+struct CoalesceCase
+{
+    const char *name;
+    std::vector<double> states;   // Interleaved (P, T) pairs
+};
+
+/**
+ *  @struct CoalesceMode One duplicate detection setting.
+*/
+struct CoalesceMode
+{
+    const char *name;
+    uint32 mode;
+    double quantum;
+};
+
+static const CoalesceMode MODES[] =
+{
+    { "none",      AirBatch::COALESCE_NONE,      0.0  },
+    { "exact",     AirBatch::COALESCE_EXACT,     0.0  },
+    { "quantized", AirBatch::COALESCE_QUANTIZED, 1E-6 }
+};
+
+static const uint32 NUM_MODES = sizeof(MODES) / sizeof(MODES[0]);
+
+/** Build the input batches from the distinct states.
+ *
+ *  @pre distinct holds an even number of values.
+ *  @post cases holds the batches, each of distinct.size() values.
+ *  @return none.
+*/
+static void buildCases (const std::vector<double> &distinct,
+                        uint32 repeat, uint64 seed,
+                        std::vector<CoalesceCase> &cases)
+{
+    size_t count = distinct.size() / 2;
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::vector<size_t> order(count);
+
+    for (size_t i = 0; i < count; ++i)
+        order[i] = i;
+
+    std::shuffle(order.begin(), order.end(), rng);
+
+    CoalesceCase unique = { "unique", distinct },
+                 runs = { "runs", distinct },
+                 uniform = { "uniform", distinct },
+                 shuffled = { "shuffled", distinct },
+                 jittered = { "jittered", distinct };
+
+    // The duplicated states are every repeat-th state, so that they
+    // still cover every regime.
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t source = (i / repeat) * repeat,       // Runs of equal states
+               spread = (order[i] / repeat) * repeat;  // Shuffled copies
+
+        runs.states[2 * i] = distinct[2 * source];
+        runs.states[2 * i + 1] = distinct[2 * source + 1];
+
+        uniform.states[2 * i] = distinct[count - (count & 1)];
+        uniform.states[2 * i + 1] = distinct[count - (count & 1) + 1];
+
+        shuffled.states[2 * i] = distinct[2 * spread];
+        shuffled.states[2 * i + 1] = distinct[2 * spread + 1];
+
+        // Solver noise in the last bits defeats the exact comparison.
+        jittered.states[2 * i] = distinct[2 * spread]
+                                 * (1.0 + 1E-12 * unit(rng));
+        jittered.states[2 * i + 1] = distinct[2 * spread + 1]
+                                     * (1.0 + 1E-12 * unit(rng));
+    }
+
+    cases.push_back(unique);
+    cases.push_back(runs);
+    cases.push_back(uniform);
+    cases.push_back(shuffled);
+    cases.push_back(jittered);
+    return;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --states N       distinct states per regime (default 4096)\n"
+            "  --repeat N       copies of each duplicated state "
+            "(default 16)\n"
+            "  --chunk N        states per evaluate() call "
+            "(default 0, whole batch)\n"
+            "  --min-time S     minimum timed seconds per case "
+            "(default 0.2)\n"
+            "  --seed N         random state seed (default 2014)\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 count = 4096,
+           repeat = 16,
+           chunk = 0;
+    double minTime = 0.2;
+    uint64 seed = 2014;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--states") && hasValue)
+            count = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--repeat") && hasValue)
+            repeat = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--chunk") && hasValue)
+            chunk = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--min-time") && hasValue)
+            minTime = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((count == 0) || (repeat == 0) || (repeat > count))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airCoalesce: cannot open %s\n", output);
+        return 1;
+    }
+
+    // The distinct states are those of every regime.
+    std::vector<BenchRegime> regimes;
+    std::vector<double> distinct;
+
+    benchRegimes(regimes, count, seed);
+
+    for (size_t r = 0; r < regimes.size(); ++r)
+        for (size_t i = 0; i < regimes[r].states.size(); ++i)
+        {
+            distinct.push_back(regimes[r].states[i].pressure);
+            distinct.push_back(regimes[r].states[i].temperature);
+        }
+
+    std::vector<CoalesceCase> cases;
+    buildCases(distinct, repeat, seed, cases);
+
+    size_t states = distinct.size() / 2,
+           step = (chunk && chunk < states) ? chunk : states;
+    std::vector<double> plain(states * NUM_COLUMNS),
+                        rows(states * NUM_COLUMNS);
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airCoalesce");
+    fprintf(out, "  \"states\": %zu,\n", states);
+    fprintf(out, "  \"repeat\": %u,\n", repeat);
+    fprintf(out, "  \"chunk\": %zu,\n", step);
+    fprintf(out, "  \"cases\": [\n");
+
+    for (size_t k = 0; k < cases.size(); ++k)
+    {
+        const double *input = &cases[k].states[0];
+
+        for (uint32 m = 0; m < NUM_MODES; ++m)
+        {
+            AirBatch batch;
+
+            batch.setColumns(COLUMNS, NUM_COLUMNS);
+            batch.setCoalesce(MODES[m].mode, MODES[m].quantum);
+
+            double *values = (m == 0) ? &plain[0] : &rows[0];
+            uint32 passes = 0;
+            double start = benchSeconds(),
+                   elapsed = 0.0;
+
+            // Small chunks model pool chunks and server batches, where
+            // the per-call cost of the duplicate detection shows.
+            do
+            {
+                for (size_t first = 0; first < states; first += step)
+                    batch.evaluate(AirBatch::INPUT_PT, input + 2 * first,
+                                   std::min(step, states - first),
+                                   values + first * NUM_COLUMNS);
+
+                elapsed = benchSeconds() - start;
+                ++passes;
+            } while (elapsed < minTime);
+
+            // The largest relative difference from the plain rows.
+            double maxError = 0.0;
+
+            for (size_t i = 0; (m > 0) && (i < plain.size()); ++i)
+                if (!std::isnan(plain[i]) && !std::isnan(rows[i]))
+                    maxError = std::max(maxError, std::fabs(rows[i] - plain[i])
+                                                  / std::fabs(plain[i]));
+
+            fprintf(out, "    { \"case\": \"%s\", \"coalesce\": \"%s\", "
+                    "\"ns_per_state\": %.1f, "
+                    "\"max_relative_error\": %.3e }%s\n",
+                    cases[k].name, MODES[m].name,
+                    1E9 * elapsed / (double(passes) * states), maxError,
+                    ((k + 1 == cases.size()) && (m + 1 == NUM_MODES)) ?
+                    "" : ",");
+            fprintf(stderr, "%-10s %-10s %9.1f ns/state  (max error %.1e)\n",
+                    cases[k].name, MODES[m].name,
+                    1E9 * elapsed / (double(passes) * states), maxError);
+        }
+    }
+
+    fprintf(out, "  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
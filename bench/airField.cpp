@@ -0,0 +1,253 @@
+/******************************************************************************
+||  airField.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Benchmark of incremental recomputation with AirField.  A synthetic     ||
+||    steady run moves a fraction of the cells of a field every iteration,   ||
+||    while the converged remainder only jitters below the tolerance.        ||
+||    Reports the time of evaluating every cell with AirBatch and of         ||
+||    AirField::update, the fraction of cells that update evaluated, and     ||
+||    the largest relative difference between the two fields.                ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airField.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airField.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airField.h"
+#include "benchSupport.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// Output columns of the field.
+static const uint32 COLUMNS[] =
+{
+    AirBatch::DENSITY, AirBatch::ENTHALPY, AirBatch::VISCOSITY,
+    AirBatch::THERMAL_COND
+};
+
+static const uint32 NUM_COLUMNS = 4;
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --states N       cells per regime (default 4096)\n"
+            "  --iterations N   solver iterations (default 20)\n"
+            "  --moving F       fraction of cells that move (default 0.1)\n"
+            "  --step F         relative step of a moving cell "
+            "(default 1E-3)\n"
+            "  --tolerance F    relative input tolerance (default 1E-6)\n"
+            "  --seed N         random state seed (default 2014)\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 count = 4096,
+           iterations = 20;
+    double moving = 0.1,
+           step = 1E-3,
+           tolerance = 1E-6;
+    uint64 seed = 2014;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--states") && hasValue)
+            count = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--iterations") && hasValue)
+            iterations = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--moving") && hasValue)
+            moving = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--step") && hasValue)
+            step = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tolerance") && hasValue)
+            tolerance = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((count == 0) || (iterations == 0) || !(tolerance >= 0.0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airField: cannot open %s\n", output);
+        return 1;
+    }
+
+    // The cells are the states of every regime.
+    std::vector<BenchRegime> regimes;
+    std::vector<double> states;
+
+    benchRegimes(regimes, count, seed);
+
+    for (size_t r = 0; r < regimes.size(); ++r)
+        for (size_t i = 0; i < regimes[r].states.size(); ++i)
+        {
+            states.push_back(regimes[r].states[i].pressure);
+            states.push_back(regimes[r].states[i].temperature);
+        }
+
+    size_t cells = states.size() / 2;
+
+    // The inputs of every iteration are generated up front: a moving
+    // cell steps by up to step, a converged cell jitters by up to a
+    // tenth of the tolerance.
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0),
+                                           draw(0.0, 1.0);
+    std::vector<double> inputs(2 * cells * iterations);
+
+    for (uint32 n = 0; n < iterations; ++n)
+    {
+        double *next = &inputs[2 * cells * n];
+
+        for (size_t i = 0; i < cells; ++i)
+        {
+            double scale = (draw(rng) < moving) ? step : 0.1 * tolerance;
+
+            states[2 * i] *= 1.0 + scale * unit(rng);
+            states[2 * i + 1] *= 1.0 + scale * unit(rng);
+
+            next[2 * i] = states[2 * i];
+            next[2 * i + 1] = states[2 * i + 1];
+        }
+    }
+
+    AirBatch batch;
+    AirField field(cells);
+    std::vector<double> rows(cells * NUM_COLUMNS);
+
+    batch.setColumns(COLUMNS, NUM_COLUMNS);
+    field.setColumns(COLUMNS, NUM_COLUMNS);
+    field.setTolerance(tolerance);
+
+    // The first update evaluates every cell, as in a cold start.
+    field.setInputs(&states[0]);
+    field.update();
+
+    // Full: every cell of every iteration.
+    double start = benchSeconds();
+
+    for (uint32 n = 0; n < iterations; ++n)
+        batch.evaluate(AirBatch::INPUT_PT, &inputs[2 * cells * n], cells,
+                       &rows[0]);
+
+    double full = benchSeconds() - start;
+
+    // Incremental: only the dirty and moved cells.
+    uint64 evaluations = field.getEvaluations();
+
+    start = benchSeconds();
+
+    for (uint32 n = 0; n < iterations; ++n)
+    {
+        field.setInputs(&inputs[2 * cells * n]);
+        field.update();
+    }
+
+    double incremental = benchSeconds() - start;
+
+    evaluations = field.getEvaluations() - evaluations;
+
+    // Compare the last iteration with the full evaluation.
+    double maxError = 0.0;
+
+    for (uint32 c = 0; c < NUM_COLUMNS; ++c)
+        for (size_t i = 0; i < cells; ++i)
+        {
+            double exact = rows[i * NUM_COLUMNS + c],
+                   value = field.getValue(i, c);
+
+            if (std::isnan(exact) || std::isnan(value))
+                continue;
+
+            maxError = std::max(maxError,
+                                std::fabs(value - exact) / std::fabs(exact));
+        }
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airField");
+    fprintf(out, "  \"cells\": %zu,\n", cells);
+    fprintf(out, "  \"iterations\": %u,\n", iterations);
+    fprintf(out, "  \"moving_fraction\": %.3f,\n", moving);
+    fprintf(out, "  \"step\": %.3g,\n", step);
+    fprintf(out, "  \"tolerance\": %.3g,\n", tolerance);
+    fprintf(out, "  \"evaluated_fraction\": %.4f,\n",
+            double(evaluations) / (double(cells) * iterations));
+    fprintf(out, "  \"full_ns_per_cell\": %.1f,\n",
+            1E9 * full / (double(cells) * iterations));
+    fprintf(out, "  \"field_ns_per_cell\": %.1f,\n",
+            1E9 * incremental / (double(cells) * iterations));
+    fprintf(out, "  \"speedup\": %.3f,\n", full / incremental);
+    fprintf(out, "  \"max_relative_error\": %.3e\n}\n", maxError);
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,248 @@
+/******************************************************************************
+||  airOverlap.cpp      (implementation file)                                ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Benchmark of overlapping property evaluation with other work through   ||
+||    AirAsync.  A synthetic solver loop evaluates the properties of a       ||
+||    block of states and then runs a flux kernel over them; the overlapped  ||
+||    variant submits the next block to the pool before computing the flux   ||
+||    of the current one (double buffering).  Reports the time of both       ||
+||    loops and checks that they produce the same results.                   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airAsync.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airOverlap.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airAsync.h"
+#include "benchSupport.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+// Output columns of the solver loop.
+static const uint32 COLUMNS[] =
+{
+    AirBatch::DENSITY, AirBatch::ENTHALPY, AirBatch::VISCOSITY,
+    AirBatch::THERMAL_COND
+};
+
+static const uint32 NUM_COLUMNS = 4;
+
+/** A synthetic flux kernel: work dependent floating point operations
+ *  per state on the evaluated properties.
+ *
+ *  @return A checksum of the fluxes.
+*/
+static double flux (const double *values, size_t count, uint32 work)
+{
+    double sum = 0.0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double *row = values + NUM_COLUMNS * i;
+        double f = row[0];
+
+        for (uint32 k = 0; k < work; ++k)
+            f = sqrt(f * row[1] + row[2]) + row[3];
+
+        sum += f;
+    }
+
+    return sum;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --threads N      pool threads (default: hardware threads)\n"
+            "  --block N        states per block (default 4096)\n"
+            "  --blocks N       blocks per loop (default 64)\n"
+            "  --work N         flux operations per state (default 100)\n"
+            "  --seed N         random state seed (default 2014)\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 threads = 0,
+           blockStates = 4096,
+           blocks = 64,
+           work = 100;
+    uint64 seed = 2014;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--threads") && hasValue)
+            threads = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--block") && hasValue)
+            blockStates = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--blocks") && hasValue)
+            blocks = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--work") && hasValue)
+            work = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((blockStates == 0) || (blocks == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airOverlap: cannot open %s\n", output);
+        return 1;
+    }
+
+    // The blocks cycle through the mixed states of every regime.
+    std::vector<BenchRegime> regimes;
+    std::vector<double> states;
+
+    benchRegimes(regimes, blockStates, seed);
+
+    for (size_t r = 0; r < regimes.size(); ++r)
+        for (size_t i = 0; i < regimes[r].states.size(); ++i)
+        {
+            states.push_back(regimes[r].states[i].pressure);
+            states.push_back(regimes[r].states[i].temperature);
+        }
+
+    size_t poolBlocks = states.size() / (2 * size_t(blockStates));
+    AirBatch batch;
+    AirAsync pool(threads);
+    std::vector<double> values[2];
+
+    batch.setColumns(COLUMNS, NUM_COLUMNS);
+    values[0].resize(size_t(blockStates) * NUM_COLUMNS);
+    values[1].resize(size_t(blockStates) * NUM_COLUMNS);
+
+    auto block = [&] (uint32 b)
+    {  return &states[2 * size_t(blockStates) * (b % poolBlocks)];  };
+
+    // Serial: evaluate, then compute the flux.
+    double start = benchSeconds(),
+           serialSum = 0.0;
+
+    for (uint32 b = 0; b < blocks; ++b)
+    {
+        batch.evaluate(AirBatch::INPUT_PT, block(b), blockStates,
+                       &values[0][0]);
+        serialSum += flux(&values[0][0], blockStates, work);
+    }
+
+    double serial = benchSeconds() - start;
+
+    // Overlapped: block b + 1 is evaluated by the pool while the flux
+    // of block b is computed.
+    start = benchSeconds();
+
+    double overlapSum = 0.0;
+    std::future<size_t> next = pool.submit(batch, AirBatch::INPUT_PT,
+                                           block(0), blockStates,
+                                           &values[0][0]);
+
+    for (uint32 b = 0; b < blocks; ++b)
+    {
+        next.get();
+
+        if (b + 1 < blocks)
+            next = pool.submit(batch, AirBatch::INPUT_PT, block(b + 1),
+                               blockStates, &values[(b + 1) % 2][0]);
+
+        overlapSum += flux(&values[b % 2][0], blockStates, work);
+    }
+
+    double overlapped = benchSeconds() - start;
+
+    // Evaluation alone, for the fraction of the loop it takes.
+    start = benchSeconds();
+
+    for (uint32 b = 0; b < blocks; ++b)
+        batch.evaluate(AirBatch::INPUT_PT, block(b), blockStates,
+                       &values[0][0]);
+
+    double evaluation = benchSeconds() - start;
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airOverlap");
+    fprintf(out, "  \"pool_threads\": %u,\n", pool.getThreads());
+    fprintf(out, "  \"hardware_threads\": %u,\n",
+            std::thread::hardware_concurrency());
+    fprintf(out, "  \"block_states\": %u,\n", blockStates);
+    fprintf(out, "  \"blocks\": %u,\n", blocks);
+    fprintf(out, "  \"flux_work\": %u,\n", work);
+    fprintf(out, "  \"evaluation_fraction\": %.3f,\n", evaluation / serial);
+    fprintf(out, "  \"serial_s\": %.6f,\n", serial);
+    fprintf(out, "  \"overlapped_s\": %.6f,\n", overlapped);
+    fprintf(out, "  \"speedup\": %.3f,\n", serial / overlapped);
+    fprintf(out, "  \"results_match\": %s\n}\n",
+            (serialSum == overlapSum) ? "true" : "false");
+
+    if (out != stdout)
+        fclose(out);
+
+    return (serialSum == overlapSum) ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+/******************************************************************************
+||  airReference.cpp      (implementation file)                              ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Extended precision reference for the equilibrium air ADT.  The         ||
+||    RP-1260 curve fits, the log-linear pressure interpolation, and the     ||
+||    derived properties are evaluated in long double with the same          ||
+||    coefficient rows that Air selects, so that the error of any fast       ||
+||    evaluation path can be measured against it.                            ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airCoefficients.h                                                      ||
+||    airReference.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airReference.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airReference.h"
+#include "airCoefficients.h"
+
+#include <algorithm>
+#include <cmath>
+
+/******************************************************
+**               Local Helper Functions              **
+******************************************************/
+
+/** Evaluate an exponential curve fit (enthalpy, specific heat, and
+ *  thermal conductivity) in extended precision.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param c The five coefficients of the curve fit row.
+ *  @param x The independent variable, ln(T / 10000).
+ *  @return The property in the fit units.
+*/
+static long double expFit (const double c[5], long double x)
+{
+    long double exponent = c[4];
+
+    for (uint32 i = 4; i-- > 0; )
+        exponent += c[i] * powl(x, 4 - i);
+
+    return expl(exponent);
+}
+
+/** Evaluate a polynomial curve fit (compressibility factor and
+ *  viscosity) in extended precision.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param c The coefficients of the curve fit row (ascending powers).
+ *  @param n The number of coefficients in the row.
+ *  @param x The independent variable, T / 1000.
+ *  @return The property in the fit units.
+*/
+static long double polyFit (const double *c, uint32 n, long double x)
+{
+    long double phi = 0.0L;
+
+    for (uint32 i = n; i-- > 0; )
+        phi = phi * x + c[i];
+
+    return phi;
+}
+
+/** Determine the pressure group of a pressure with the same
+ *  comparisons as Air::_getDecade.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The pressure group (0 .. 6).
+*/
+static uint32 pressureGroup (double pressure)
+{
+    static const double contours[6] = { 1E-4, 1E-3, 1E-2, 1E-1, 1E0, 1E1 };
+
+    uint32 group = 0;
+
+    while ((group < 6) && !((pressure / contours[group]) < 10.0))
+        ++group;
+
+    return group;
+}
+
+/** Determine the row of a coefficient table with the same search as
+ *  Air::_getRow, so that the reference uses the rows of Air.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param decadeRows The first row of each pressure group of the
+ *         table followed by the table length.
+ *  @param Tmin The lower temperature limit of each row in K.
+ *  @param pressure The order-of-magnitude of the pressure of interest.
+ *  @param temperature The temperature of the state in K.
+ *  @return The index into the coefficient table.
+*/
+static uint32 tableRow (const uint32 decadeRows[8], const double Tmin[],
+                        double pressure, double temperature)
+{
+    uint32 group = pressureGroup(pressure),
+           row = decadeRows[group];
+
+    while (   ((row + 1) < decadeRows[group + 1])
+           && (temperature >= Tmin[row + 1]))
+        ++row;
+
+    return row;
+}
+
+/** Logarithmically interpolate a property between the pressure
+ *  contours in extended precision.
+ *
+ *  @pre p1 <= p < p2.
+ *  @post none.
+ *  @param p1 The smaller pressure order-of-magnitude [atm].
+ *  @param p2 The larger pressure order-of-magnitude [atm].
+ *  @param p The pressure of the state [atm].
+ *  @param phi_1 The property at p1.
+ *  @param phi_2 The property at p2.
+ *  @return The interpolated property.
+*/
+static long double interpolate (long double p1, long double p2,
+                                long double p, long double phi_1,
+                                long double phi_2)
+{
+    long double slope = (log10l(phi_2) - log10l(phi_1))
+                      / (log10l(p2) - log10l(p1));
+
+    return powl(10.0L, slope * (log10l(p) - log10l(p1)) + log10l(phi_1));
+}
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Retrieve the name of a property.
+ *
+ *  @pre property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @return The property name as used in the reports.
+*/
+const char * AirReference::name (uint32 property)
+{
+    static const char *names[NUM_PROPERTIES] =
+    {
+        "enthalpy", "specific_heat", "thermal_cond", "viscosity",
+        "comp_factor", "density", "gamma", "sound_speed", "entropy",
+        "prandtl"
+    };
+
+    return names[property];
+}
+
+/** Copy the compared properties out of an evaluated Air object.
+ *
+ *  @pre state holds calculated properties.
+ *  @post none.
+ *  @param state The evaluated Air object.
+ *  @param values The destination (NUM_PROPERTIES values).
+ *  @return none.
+*/
+void AirReference::extract (const Air &state, double values[NUM_PROPERTIES])
+{
+    values[ENTHALPY]      = state.getEnthalpy();
+    values[SPECIFIC_HEAT] = state.getSpecificHeat();
+    values[THERMAL_COND]  = state.getThermalConductivity();
+    values[VISCOSITY]     = state.getDynamicViscosity();
+    values[COMP_FACTOR]   = state.getCompressibilityFactor();
+    values[DENSITY]       = state.getDensity();
+    values[GAMMA]         = state.getGamma();
+    values[SOUND_SPEED]   = state.getSoundSpeed();
+    values[ENTROPY]       = state.getEntropy();
+    values[PRANDTL]       = state.getPrandtlNumber();
+
+    return;
+}
+
+/** Evaluate the reference properties of a state.  The coefficient
+ *  rows are selected exactly as Air selects them so that only the
+ *  arithmetic of a fast path is measured, not the breakpoints.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 < T <= 30000 K.
+ *  @post none.
+ *  @param pressure The pressure of the state in MPa.
+ *  @param temperature The temperature of the state in K.
+ *  @param values The destination (NUM_PROPERTIES values).
+ *  @return none.
+*/
+void AirReference::evaluate (double pressure, double temperature,
+                             long double values[NUM_PROPERTIES])
+{
+    long double P = pressure,
+                T = temperature,
+                h, cp, k, mu, z;  // Curve fit units (cal, g, cm, poise)
+
+    // The reference states that for temperatures below 500 K,
+    // simpler relations may be used to generate properties.
+    if (temperature <= 500.0)
+    {
+        h = 0.24E-3L * T;
+        cp = 0.24L;
+        k = 5.9776E-6L * (powl(T, 1.5L) / (T + 194.4L));
+        mu = 1.4584E-5L * (powl(T, 1.5L) / (T + 110.33L));
+        z = 1.0L;
+    }
+    else
+    {
+        // The pressure contours of Air::_getPressureOM.
+        static const double contours[7] =
+            { 1E-4, 1E-3, 1E-2, 1E-1, 1E0, 1E1, 1E2 };
+
+        //   0.101325 = conversion factor MPa -> atm
+        double pAtm = pressure / 0.101325;
+        uint32 lower = std::min(pressureGroup(pAtm), 5u);
+        double pOM[2] = { contours[lower], contours[lower + 1] };
+
+        long double xLog = logl(T / 10000.0L),
+                    xLin = T / 1000.0L,
+                    phi[5][2];
+
+        typedef AirCoefficients C;
+
+        for (uint32 i = 0; i < 2; ++i)
+        {
+            double p = pOM[i];
+
+            phi[0][i] = expFit(C::hCoeffs[tableRow(C::hDecadeRows,
+                                  C::hTmin, p, temperature)], xLog);
+            phi[1][i] = expFit(C::cpCoeffs[tableRow(C::cpDecadeRows,
+                                  C::cpTmin, p, temperature)], xLog);
+            phi[2][i] = expFit(C::kCoeffs[tableRow(C::kDecadeRows,
+                                  C::kTmin, p, temperature)], xLog);
+            phi[3][i] = polyFit(C::muCoeffs[tableRow(C::muDecadeRows,
+                                  C::muTmin, p, temperature)], 6, xLin);
+            phi[4][i] = polyFit(C::zCoeffs[tableRow(C::zDecadeRows,
+                                  C::zTmin, p, temperature)], 5, xLin);
+        }
+
+        long double p = P / 0.101325L;
+
+        h  = interpolate(pOM[0], pOM[1], p, phi[0][0], phi[0][1]);
+        cp = interpolate(pOM[0], pOM[1], p, phi[1][0], phi[1][1]);
+        k  = interpolate(pOM[0], pOM[1], p, phi[2][0], phi[2][1]);
+        mu = interpolate(pOM[0], pOM[1], p, phi[3][0], phi[3][1]);
+        z  = interpolate(pOM[0], pOM[1], p, phi[4][0], phi[4][1]);
+    }
+
+    // Convert to the units of the Air accessors (see Air).
+    values[ENTHALPY]      = h * 1000.0L * 1000.0L / 238.8459L;
+    values[SPECIFIC_HEAT] = cp * 1000.0L / 238.8459L;
+    values[THERMAL_COND]  = k * 100.0L / 0.2388459L;
+    values[VISCOSITY]     = mu * 100.0L / 1000.0L;
+    values[COMP_FACTOR]   = z;
+
+    // Derived properties, as in Air::_calculateDerivedProperties
+    long double molarMass = 28.96755L / z,
+                R = (long double)AirCoefficients::rUniv / molarMass,
+                cpSI = values[SPECIFIC_HEAT];
+
+    values[DENSITY]     = (P * 1000.0L) / (z * R * T);
+    values[GAMMA]       = cpSI / (cpSI - R);
+    values[SOUND_SPEED] = sqrtl(values[GAMMA] * R * T * 1000.0L);
+    values[ENTROPY]     = (cpSI * logl(T / 300.0L))
+                        - (R * logl(P / 0.101325L)) + 1.70203L;
+    values[PRANDTL]     = values[VISCOSITY] * cpSI * 1000.0L
+                        / values[THERMAL_COND];
+
+    return;
+}
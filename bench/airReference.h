@@ -0,0 +1,117 @@
+/******************************************************************************
+||  airReference.h      (definition file)                                    ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Extended precision reference for the equilibrium air ADT.  The         ||
+||    RP-1260 curve fits, the log-linear pressure interpolation, and the     ||
+||    derived properties are evaluated in long double with the same          ||
+||    coefficient rows that Air selects, so that the error of any fast       ||
+||    evaluation path can be measured against it.                            ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airReference.cpp                                                       ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airReference.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_REFERENCE_H
+#define _GH_DEF_AIR_REFERENCE_H
+
+#include "air.h"
+
+/**
+ *  @class AirReference Evaluates the RP-1260 curve fits of the Air ADT
+ *         in extended precision (long double) as the reference for the
+ *         accuracy of the fast evaluation paths.
+*/
+class AirReference
+{
+  public:
+    /** The properties compared by the accuracy harness.  */
+    enum Property
+    {
+        ENTHALPY,       // [units: kJ/kg]
+        SPECIFIC_HEAT,  // [units: kJ/kg-K]
+        THERMAL_COND,   // [units: W/m-K]
+        VISCOSITY,      // [units: kg/m-s]
+        COMP_FACTOR,    // [-dimensionless-]
+        DENSITY,        // [units: kg/m^3]
+        GAMMA,          // [-dimensionless-]
+        SOUND_SPEED,    // [units: m/s]
+        ENTROPY,        // [units: kJ/kg-K]
+        PRANDTL,        // [-dimensionless-]
+        NUM_PROPERTIES
+    };
+
+    /** Retrieve the name of a property.
+     *
+     *  @pre property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @return The property name as used in the reports.
+    */
+    static const char * name (uint32 property);
+
+    /** Copy the compared properties out of an evaluated Air object.
+     *
+     *  @pre state holds calculated properties.
+     *  @post none.
+     *  @param state The evaluated Air object.
+     *  @param values The destination (NUM_PROPERTIES values).
+     *  @return none.
+    */
+    static void extract (const Air &state, double values[NUM_PROPERTIES]);
+
+    /** Evaluate the reference properties of a state.  The coefficient
+     *  rows are selected exactly as Air selects them so that only the
+     *  arithmetic of a fast path is measured, not the breakpoints.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 < T <= 30000 K.
+     *  @post none.
+     *  @param pressure The pressure of the state in MPa.
+     *  @param temperature The temperature of the state in K.
+     *  @param values The destination (NUM_PROPERTIES values).
+     *  @return none.
+    */
+    static void evaluate (double pressure, double temperature,
+                          long double values[NUM_PROPERTIES]);
+};
+
+#endif
@@ -0,0 +1,548 @@
+/******************************************************************************
+||  airReplay.cpp      (implementation file)                                 ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Offline replay of the traces recorded by AirTrace.  The decoded calls  ||
+||    are fed in order into each evaluation backend; the tool reports the    ||
+||    replay throughput and, for traces recorded with outputs, how far the   ||
+||    results of each backend differ from the recorded ones.                 ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airStream.h                                                            ||
+||    airTaylorCache.h                                                       ||
+||    airTrace.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airReplay.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airStream.h"
+#include "airTaylorCache.h"
+#include "airTrace.h"
+#include "benchSupport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+/******************************************************
+**                    Backends                       **
+******************************************************/
+
+static const uint32 NUM_OUTPUTS = AirTrace::NUM_OUTPUTS;
+
+/**
+ *  @struct ReplayOutcome The result of one replayed record.
+*/
+struct ReplayOutcome
+{
+    bool replayed,                // The backend supports the call
+         valid;                   // The call returned true
+    double outputs[NUM_OUTPUTS];  // In AirTrace::Output order
+};
+
+/** A backend replays every record in order and returns a checksum of
+ *  the results; when outcomes is not NULL, the result of each record is
+ *  stored there as well.  */
+typedef double (*ReplayKernel)(const std::vector<AirTrace::Record> &records,
+                               std::vector<ReplayOutcome> *outcomes);
+
+/** Store the result of one call.
+ *
+ *  @pre none.
+ *  @post outcome holds the flags and the outputs of state.
+ *  @param state The evaluated state.
+ *  @param valid The result of the call.
+ *  @param outcome The destination.
+ *  @return none.
+*/
+static void store (const Air &state, bool valid, ReplayOutcome &outcome)
+{
+    outcome.replayed = true;
+    outcome.valid = valid;
+    outcome.outputs[AirTrace::OUT_TEMPERATURE] = state.getTemperature();
+    outcome.outputs[AirTrace::OUT_ENTHALPY] = state.getEnthalpy();
+    outcome.outputs[AirTrace::OUT_SPECIFIC_HEAT] = state.getSpecificHeat();
+    outcome.outputs[AirTrace::OUT_THERMAL_COND] =
+        state.getThermalConductivity();
+    outcome.outputs[AirTrace::OUT_VISCOSITY] = state.getDynamicViscosity();
+    outcome.outputs[AirTrace::OUT_COMP_FACTOR] =
+        state.getCompressibilityFactor();
+
+    return;
+}
+
+static double replayAir (const std::vector<AirTrace::Record> &records,
+                         std::vector<ReplayOutcome> *outcomes)
+{
+    Air air;
+    double checksum = 0.0;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const AirTrace::Record &record = records[i];
+
+        bool valid = (record.kind == AirTrace::KIND_PH)
+                   ? air.calculateProps_PH(record.pressure, record.input)
+                   : air.calculateProperties(record.pressure, record.input);
+
+        checksum += air.getEnthalpy();
+
+        if (outcomes)
+            store(air, valid, (*outcomes)[i]);
+    }
+
+    return checksum;
+}
+
+static double replayStream (const std::vector<AirTrace::Record> &records,
+                            std::vector<ReplayOutcome> *outcomes)
+{
+    Air air;
+    AirStream stream;
+    double checksum = 0.0;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const AirTrace::Record &record = records[i];
+
+        // AirStream has no P-H entry point.
+        if (record.kind == AirTrace::KIND_PH)
+            continue;
+
+        bool valid = stream.calculateProperties(record.pressure,
+                                                record.input, air);
+
+        checksum += air.getEnthalpy();
+
+        if (outcomes)
+            store(air, valid, (*outcomes)[i]);
+    }
+
+    return checksum;
+}
+
+static double replayTaylorCache (const std::vector<AirTrace::Record> &records,
+                                 std::vector<ReplayOutcome> *outcomes,
+                                 double tolerance, uint32 order)
+{
+    Air air;
+    AirTaylorCache cache(tolerance, order);
+    double checksum = 0.0;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const AirTrace::Record &record = records[i];
+
+        // AirTaylorCache has no P-H entry point.
+        if (record.kind == AirTrace::KIND_PH)
+            continue;
+
+        bool valid = cache.calculateProperties(record.pressure,
+                                               record.input, air);
+
+        checksum += air.getEnthalpy();
+
+        if (outcomes)
+            store(air, valid, (*outcomes)[i]);
+    }
+
+    return checksum;
+}
+
+static double replayTaylor2 (const std::vector<AirTrace::Record> &records,
+                             std::vector<ReplayOutcome> *outcomes)
+{  return replayTaylorCache(records, outcomes, 1E-6, 2);  }
+
+static double replayTaylor1 (const std::vector<AirTrace::Record> &records,
+                             std::vector<ReplayOutcome> *outcomes)
+{  return replayTaylorCache(records, outcomes, 1E-4, 1);  }
+
+/**
+ *  @struct ReplayBackend One evaluation path fed with the trace.
+*/
+struct ReplayBackend
+{
+    const char *name;
+    ReplayKernel kernel;
+};
+
+static const ReplayBackend backends[] =
+{
+    { "calculateProperties",         replayAir     },
+    { "AirStream",                   replayStream  },
+    { "AirTaylorCache(1E-6,2)",      replayTaylor2 },
+    { "AirTaylorCache(1E-4,1)",      replayTaylor1 }
+};
+
+static const uint32 numBackends = sizeof(backends) / sizeof(backends[0]);
+
+static const char *outputNames[NUM_OUTPUTS] =
+{
+    "temperature", "enthalpy", "specific_heat", "thermal_cond",
+    "viscosity", "comp_factor"
+};
+
+/******************************************************
+**                    Replay                         **
+******************************************************/
+
+/**
+ *  @struct OutputDiff The differences of one output from the trace.
+*/
+struct OutputDiff
+{
+    double maxRel;       // Largest relative difference
+    size_t maxAt;        // Record index of maxRel
+    uint64 differing,    // Records that are not bit-identical
+           aboveTol;     // Records above the tolerance
+};
+
+/**
+ *  @struct ReplayResult The replay of one backend.
+*/
+struct ReplayResult
+{
+    uint64 replayed,             // Records the backend supports
+           compared,             // Replayed records with outputs
+           identical,            // Compared records, all bit-identical
+           validMismatches;      // Replayed records whose flag differs
+    uint32 passes;               // Timed passes
+    double nsMin,                // Fastest pass [units: ns/record]
+           nsMedian,             // Median pass [units: ns/record]
+           checksum;             // Sum of the results (defeats DCE)
+    OutputDiff diffs[NUM_OUTPUTS];
+};
+
+/** Replay a trace through one backend: one pass that keeps the results
+ *  for the comparison, then timed passes until minTime has elapsed.
+ *
+ *  @pre records is not empty.
+ *  @post none.
+ *  @param backend The backend to be replayed.
+ *  @param records The decoded trace.
+ *  @param minTime The minimum total time of the timed passes [s].
+ *  @param tolerance The relative difference counted as a regression.
+ *  @return The timing and the differences from the recorded outputs.
+*/
+static ReplayResult replay (const ReplayBackend &backend,
+                            const std::vector<AirTrace::Record> &records,
+                            double minTime, double tolerance)
+{
+    ReplayResult result;
+    std::vector<ReplayOutcome> outcomes(records.size());
+
+    for (size_t i = 0; i < records.size(); ++i)
+        outcomes[i].replayed = false;
+
+    // The comparison pass also warms up.
+    result.checksum = backend.kernel(records, &outcomes);
+
+    result.replayed = 0;
+    result.compared = 0;
+    result.identical = 0;
+    result.validMismatches = 0;
+
+    for (uint32 o = 0; o < NUM_OUTPUTS; ++o)
+    {
+        result.diffs[o].maxRel = 0.0;
+        result.diffs[o].maxAt = 0;
+        result.diffs[o].differing = 0;
+        result.diffs[o].aboveTol = 0;
+    }
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const AirTrace::Record &record = records[i];
+        const ReplayOutcome &outcome = outcomes[i];
+
+        if (!outcome.replayed)
+            continue;
+
+        ++result.replayed;
+
+        if (outcome.valid != record.valid)
+            ++result.validMismatches;
+
+        if (!record.hasOutputs || !outcome.valid)
+            continue;
+
+        ++result.compared;
+
+        bool identical = true;
+
+        for (uint32 o = 0; o < NUM_OUTPUTS; ++o)
+        {
+            OutputDiff &diff = result.diffs[o];
+            double was = record.outputs[o],
+                   now = outcome.outputs[o];
+
+            // NaN results match NaN recordings.
+            if ((now == was) || (std::isnan(now) && std::isnan(was)))
+                continue;
+
+            double rel = fabs(now - was) / std::max(fabs(was), 1E-300);
+
+            identical = false;
+            ++diff.differing;
+
+            if (!(rel <= tolerance))
+                ++diff.aboveTol;
+
+            if (!std::isnan(diff.maxRel) && !(rel <= diff.maxRel))
+            {
+                diff.maxRel = rel;
+                diff.maxAt = i;
+            }
+        }
+
+        if (identical)
+            ++result.identical;
+    }
+
+    std::vector<double> samples;
+    double total = 0.0,
+           count = double(std::max(result.replayed, uint64(1)));
+
+    while ((total < minTime) || (samples.size() < 3))
+    {
+        double start = benchSeconds();
+        result.checksum += backend.kernel(records, NULL);
+        double elapsed = benchSeconds() - start;
+
+        total += elapsed;
+        samples.push_back(elapsed * 1E9 / count);
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    result.passes = uint32(samples.size());
+    result.nsMin = samples.front();
+    result.nsMedian = samples[samples.size() / 2];
+
+    return result;
+}
+
+/** Format a difference for JSON output (non-finite values become null).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param value The difference.
+ *  @return The JSON number or null.
+*/
+static std::string jsonDiff (double value)
+{
+    char text[32];
+
+    if (std::isfinite(value))
+        snprintf(text, sizeof(text), "%.4e", value);
+    else
+        snprintf(text, sizeof(text), "null");
+
+    return text;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options] TRACE\n"
+            "  --min-time S     minimum timed seconds per backend (0.2)\n"
+            "  --tolerance R    relative difference reported as a\n"
+            "                   regression (default 0: any difference)\n"
+            "  --filter TEXT    only replay backends whose name has TEXT\n"
+            "  --output FILE    write the report to FILE (default stdout)\n"
+            "Record a trace with AIR_TRACE=FILE (AIR_TRACE_OUTPUTS=1 for\n"
+            "the results) in a build with -DAIR_ENABLE_TRACE=ON.\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    double minTime = 0.2,
+           tolerance = 0.0;
+    const char *trace = NULL,
+               *filter = NULL,
+               *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--min-time") && hasValue)
+            minTime = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tolerance") && hasValue)
+            tolerance = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--filter") && hasValue)
+            filter = argv[++i];
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else if ((argv[i][0] != '-') && !trace)
+            trace = argv[i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!trace || !(minTime >= 0.0) || !(tolerance >= 0.0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Decode the whole trace first, so that decoding is not timed.
+    AirTraceReader reader;
+    std::vector<AirTrace::Record> records;
+    AirTrace::Record record;
+    uint64 counts[2] = { 0, 0 };
+
+    if (!reader.open(trace))
+    {
+        fprintf(stderr, "airReplay: %s\n", reader.getError());
+        return 1;
+    }
+
+    while (reader.next(record))
+    {
+        records.push_back(record);
+        ++counts[record.kind];
+    }
+
+    // A truncated trace (a recording that was not stopped) is replayed
+    // up to its last complete chunk.
+    if (reader.getError()[0])
+        fprintf(stderr, "airReplay: %s (replaying %u records)\n",
+                reader.getError(), uint32(records.size()));
+
+    if (records.empty())
+    {
+        fprintf(stderr, "airReplay: %s holds no records\n", trace);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airReplay: cannot open %s\n", output);
+        return 1;
+    }
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airReplay");
+    fprintf(out, "  \"trace\": %s,\n", benchJsonString(trace).c_str());
+    fprintf(out, "  \"records\": %u,\n", uint32(records.size()));
+    fprintf(out, "  \"pt_records\": %llu,\n", counts[AirTrace::KIND_PT]);
+    fprintf(out, "  \"ph_records\": %llu,\n", counts[AirTrace::KIND_PH]);
+    fprintf(out, "  \"chunks\": %llu,\n", reader.getChunks());
+    fprintf(out, "  \"has_outputs\": %s,\n",
+            reader.hasOutputs() ? "true" : "false");
+    fprintf(out, "  \"decode_error\": %s,\n",
+            reader.getError()[0] ? benchJsonString(reader.getError()).c_str()
+                                 : "null");
+    fprintf(out, "  \"tolerance\": %g,\n", tolerance);
+    fprintf(out, "  \"backends\": [");
+
+    bool first = true;
+
+    for (uint32 b = 0; b < numBackends; ++b)
+    {
+        if (filter && !strstr(backends[b].name, filter))
+            continue;
+
+        ReplayResult result = replay(backends[b], records, minTime,
+                                     tolerance);
+
+        fprintf(stderr, "%-24s %8.1f ns/record  %llu replayed, "
+                "%llu identical of %llu compared\n", backends[b].name,
+                result.nsMin, result.replayed, result.identical,
+                result.compared);
+
+        fprintf(out, "%s\n    {\n", first ? "" : ",");
+        fprintf(out, "      \"name\": %s,\n",
+                benchJsonString(backends[b].name).c_str());
+        fprintf(out, "      \"replayed\": %llu,\n", result.replayed);
+        fprintf(out, "      \"skipped\": %llu,\n",
+                uint64(records.size()) - result.replayed);
+        fprintf(out, "      \"passes\": %u,\n", result.passes);
+        fprintf(out, "      \"ns_per_record_min\": %.3f,\n", result.nsMin);
+        fprintf(out, "      \"ns_per_record_median\": %.3f,\n",
+                result.nsMedian);
+        fprintf(out, "      \"records_per_s\": %.6g,\n",
+                (result.nsMin > 0.0) ? 1E9 / result.nsMin : 0.0);
+        fprintf(out, "      \"checksum\": %.17g,\n", result.checksum);
+        fprintf(out, "      \"valid_mismatches\": %llu,\n",
+                result.validMismatches);
+        fprintf(out, "      \"compared\": %llu,\n", result.compared);
+        fprintf(out, "      \"identical\": %llu,\n", result.identical);
+        fprintf(out, "      \"outputs\": {");
+
+        for (uint32 o = 0; o < NUM_OUTPUTS; ++o)
+        {
+            const OutputDiff &diff = result.diffs[o];
+
+            fprintf(out, "%s\n        \"%s\": { \"max_rel\": %s, "
+                    "\"max_at\": [%.9g, %.9g], \"differing\": %llu, "
+                    "\"above_tolerance\": %llu }",
+                    o ? "," : "", outputNames[o],
+                    jsonDiff(diff.maxRel).c_str(),
+                    records[diff.maxAt].pressure, records[diff.maxAt].input,
+                    diff.differing, diff.aboveTol);
+        }
+
+        fprintf(out, "\n      }\n    }");
+
+        first = false;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
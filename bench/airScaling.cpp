@@ -0,0 +1,552 @@
+/******************************************************************************
+||  airScaling.cpp      (implementation file)                                ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Multithreaded scaling and tail-latency benchmark of the equilibrium    ||
+||    air ADT.  Bulk P-T and P-H evaluations are run at 1..N threads with    ||
+||    one shared (mutex serialized) Air object, per-thread objects packed    ||
+||    into one array, and per-thread objects padded to whole cache lines.    ||
+||    The throughput, parallel efficiency, and p50/p99/p99.9 per-call        ||
+||    latency of every case are reported as JSON, and a packed layout that   ||
+||    falls behind the padded one is flagged as false sharing.               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airScaling.cpp
+ *  @date 2026-10-18
+*/
+
+#include "benchSupport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+/******************************************************
+**                 Object Layouts                    **
+******************************************************/
+
+// Assumed size of a cache line (x86-64, most AArch64) [units: bytes]
+static const size_t CACHE_LINE = 64;
+
+/**
+ *  @enum Layout The placement of the Air objects used by the threads.
+*/
+enum Layout
+{
+    LAYOUT_SHARED,    // One Air object, serialized with a mutex
+    LAYOUT_ADJACENT,  // One Air object per thread, packed in an array
+    LAYOUT_PADDED     // One Air object per thread, each on its own lines
+};
+
+static const char *layoutNames[] = { "shared", "adjacent", "padded" };
+static const uint32 numLayouts = 3;
+
+/**
+ *  @enum Call The evaluation that each thread performs.
+*/
+enum Call
+{
+    CALL_PT,  // calculateProperties(pressure, temperature)
+    CALL_PH   // calculateProps_PH(pressure, enthalpy)
+};
+
+static const char *callNames[] = { "calculateProperties",
+                                   "calculateProps_PH" };
+static const uint32 numCalls = 2;
+
+/**
+ *  @class AirArray A cache-line aligned array of Air objects with a
+ *         configurable stride, so that neighbouring objects either share
+ *         cache lines (stride = sizeof(Air)) or never do (stride rounded
+ *         up to a whole number of lines).
+*/
+class AirArray
+{
+  public:
+    /** Initialization constructor.
+     *
+     *  @pre count > 0.
+     *  @post count Air objects are constructed in the buffer.
+     *  @param count The number of objects.
+     *  @param padded Whether each object starts on its own cache line.
+     *  @return none.
+    */
+    AirArray (uint32 count, bool padded)
+      : _count(count),
+        _stride(padded ? (sizeof(Air) + CACHE_LINE - 1) / CACHE_LINE
+                           * CACHE_LINE
+                       : sizeof(Air))
+    {
+        _buffer = new char[_count * _stride + CACHE_LINE];
+
+        size_t offset = size_t(CACHE_LINE - (size_t(_buffer) % CACHE_LINE))
+                      % CACHE_LINE;
+        _base = _buffer + offset;
+
+        for (uint32 i = 0; i < _count; ++i)
+            new (_base + i * _stride) Air();
+    }
+
+    /** Default destructor.  */
+    ~AirArray()
+    {
+        for (uint32 i = 0; i < _count; ++i)
+            (*this)[i].~Air();
+
+        delete [] _buffer;
+    }
+
+    /** Retrieve one of the objects.
+     *
+     *  @pre index < count.
+     *  @post none.
+     *  @param index The index of the object.
+     *  @return A reference to the object.
+    */
+    Air & operator[] (uint32 index)
+    {  return *reinterpret_cast<Air *>(_base + index * _stride);  }
+
+  private:
+    uint32 _count;   // Number of Air objects
+    size_t _stride;  // Distance between objects [units: bytes]
+    char *_buffer,   // The allocation
+         *_base;     // The first cache-line aligned byte of _buffer
+
+    // Not copyable.
+    AirArray (const AirArray &);
+    AirArray & operator= (const AirArray &);
+};
+
+/******************************************************
+**                    Workers                        **
+******************************************************/
+
+/**
+ *  @struct Worker The inputs and results of one benchmark thread.
+*/
+struct Worker
+{
+    Air *air;                          // The object evaluated by the thread
+    std::mutex *lock;                  // Serializes a shared object
+    const std::vector<BenchState> *states;
+    size_t first;                      // Index of the first state
+    uint32 calls;                      // Number of evaluations
+    Call call;                         // Evaluation to perform
+    std::vector<float> latency;        // Per-call latency [units: ns]
+    double checksum;                   // Sum of the results (defeats DCE)
+};
+
+/** Evaluate the calls of one thread, timing each call.
+ *
+ *  @pre worker.latency has room for worker.calls entries.
+ *  @post worker.latency and worker.checksum are filled.
+ *  @param worker The thread's inputs and results.
+ *  @param go Set by the main thread to release all workers at once.
+ *  @return none.
+*/
+static void runWorker (Worker &worker, const std::atomic<bool> &go)
+{
+    using std::chrono::steady_clock;
+
+    const std::vector<BenchState> &states = *worker.states;
+    size_t index = worker.first;
+    double checksum = 0.0;
+
+    while (!go.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+    for (uint32 i = 0; i < worker.calls; ++i)
+    {
+        const BenchState &state = states[index];
+
+        if (++index == states.size())
+            index = 0;
+
+        steady_clock::time_point start = steady_clock::now();
+
+        if (worker.lock)
+            worker.lock->lock();
+
+        if (worker.call == CALL_PT)
+            worker.air->calculateProperties(state.pressure,
+                                            state.temperature);
+        else
+            worker.air->calculateProps_PH(state.pressure, state.enthalpy);
+
+        checksum += worker.air->getDensity();
+
+        if (worker.lock)
+            worker.lock->unlock();
+
+        steady_clock::time_point stop = steady_clock::now();
+
+        worker.latency[i] = float(std::chrono::duration<double, std::nano>
+                                      (stop - start).count());
+    }
+
+    worker.checksum = checksum;
+
+    return;
+}
+
+/**
+ *  @struct ScalingResult The summary of one (layout, call, threads) run.
+*/
+struct ScalingResult
+{
+    Layout layout;
+    Call call;
+    uint32 threads;
+    double seconds,       // Wall time of the run [units: s]
+           throughput,    // Evaluations per second, all threads
+           efficiency,    // throughput / (threads * 1-thread throughput)
+           p50,           // Per-call latency percentiles [units: ns]
+           p99,
+           p999,
+           max,
+           checksum;
+};
+
+/** Retrieve a percentile of a sorted sample.
+ *
+ *  @pre sorted is not empty and in ascending order.
+ *  @post none.
+ *  @param sorted The sample.
+ *  @param fraction The percentile as a fraction (0 to 1).
+ *  @return The nearest-rank percentile.
+*/
+static double percentile (const std::vector<float> &sorted, double fraction)
+{
+    size_t rank = size_t(fraction * double(sorted.size()));
+
+    if (rank >= sorted.size())
+        rank = sorted.size() - 1;
+
+    return sorted[rank];
+}
+
+/** Run one (layout, call, threads) case.
+ *
+ *  @pre states is not empty and threads > 0.
+ *  @post none.
+ *  @param layout The placement of the Air objects.
+ *  @param call The evaluation performed by each thread.
+ *  @param threads The number of threads.
+ *  @param calls The number of evaluations per thread.
+ *  @param states The input states, shared by all threads.
+ *  @return The summary of the run (efficiency is left at zero).
+*/
+static ScalingResult runCase (Layout layout, Call call, uint32 threads,
+                              uint32 calls,
+                              const std::vector<BenchState> &states)
+{
+    AirArray objects((layout == LAYOUT_SHARED) ? 1 : threads,
+                     layout == LAYOUT_PADDED);
+    std::mutex lock;
+    std::vector<Worker> workers(threads);
+    std::vector<std::thread> pool;
+    std::atomic<bool> go(false);
+
+    for (uint32 t = 0; t < threads; ++t)
+    {
+        Worker &worker = workers[t];
+
+        worker.air = &objects[(layout == LAYOUT_SHARED) ? 0 : t];
+        worker.lock = (layout == LAYOUT_SHARED) ? &lock : NULL;
+        worker.states = &states;
+        worker.first = (size_t(t) * states.size()) / threads;
+        worker.calls = calls;
+        worker.call = call;
+        worker.latency.resize(calls);
+        worker.checksum = 0.0;
+    }
+
+    for (uint32 t = 0; t < threads; ++t)
+        pool.push_back(std::thread(runWorker, std::ref(workers[t]),
+                                   std::cref(go)));
+
+    double start = benchSeconds();
+    go.store(true, std::memory_order_release);
+
+    for (uint32 t = 0; t < threads; ++t)
+        pool[t].join();
+
+    double elapsed = benchSeconds() - start;
+
+    std::vector<float> latency;
+    latency.reserve(size_t(threads) * calls);
+
+    ScalingResult result;
+    result.layout = layout;
+    result.call = call;
+    result.threads = threads;
+    result.seconds = elapsed;
+    result.throughput = double(threads) * double(calls) / elapsed;
+    result.efficiency = 0.0;
+    result.checksum = 0.0;
+
+    for (uint32 t = 0; t < threads; ++t)
+    {
+        latency.insert(latency.end(), workers[t].latency.begin(),
+                       workers[t].latency.end());
+        result.checksum += workers[t].checksum;
+    }
+
+    std::sort(latency.begin(), latency.end());
+
+    result.p50 = percentile(latency, 0.50);
+    result.p99 = percentile(latency, 0.99);
+    result.p999 = percentile(latency, 0.999);
+    result.max = latency.back();
+
+    return result;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --threads N      largest thread count (default: hardware)\n"
+            "  --calls N        evaluations per thread (default 20000)\n"
+            "  --states N       states per input regime (default 1024)\n"
+            "  --seed N         input generator seed (default 2014)\n"
+            "  --fs-threshold R adjacent/padded throughput ratio below\n"
+            "                   which false sharing is flagged (default 0.9)\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 hardwareThreads = std::max(std::thread::hardware_concurrency(),
+                                      1u),
+           maxThreads = hardwareThreads,
+           calls = 20000,
+           count = 1024;
+    uint64 seed = 2014;
+    double fsThreshold = 0.9;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--threads") && hasValue)
+            maxThreads = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--calls") && hasValue)
+            calls = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--states") && hasValue)
+            count = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--fs-threshold") && hasValue)
+            fsThreshold = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((maxThreads == 0) || (calls == 0) || (count == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airScaling: cannot open %s\n", output);
+        return 1;
+    }
+
+    // Every regime is mixed into one input pool; the P-H pool leaves out
+    // the states that calculateProps_PH cannot start from.
+    std::vector<BenchRegime> regimes;
+    std::vector<BenchState> pool[numCalls];
+
+    benchRegimes(regimes, count, seed);
+
+    for (size_t r = 0; r < regimes.size(); ++r)
+    {
+        for (size_t i = 0; i < regimes[r].states.size(); ++i)
+        {
+            const BenchState &state = regimes[r].states[i];
+
+            pool[CALL_PT].push_back(state);
+
+            if (state.enthalpy <= BENCH_PH_MAX_ENTHALPY)
+                pool[CALL_PH].push_back(state);
+        }
+    }
+
+    std::vector<ScalingResult> results;
+
+    for (uint32 l = 0; l < numLayouts; ++l)
+    {
+        for (uint32 c = 0; c < numCalls; ++c)
+        {
+            double single = 0.0;
+
+            for (uint32 n = 1; n <= maxThreads; ++n)
+            {
+                ScalingResult result = runCase(Layout(l), Call(c), n, calls,
+                                               pool[c]);
+
+                if (n == 1)
+                    single = result.throughput;
+
+                result.efficiency = result.throughput / (double(n) * single);
+
+                fprintf(stderr, "%-8s %-20s %3u threads %12.0f /s"
+                        "  eff %5.2f  p50 %7.0f  p99 %7.0f  p99.9 %7.0f ns\n",
+                        layoutNames[l], callNames[c], n, result.throughput,
+                        result.efficiency, result.p50, result.p99,
+                        result.p999);
+
+                results.push_back(result);
+            }
+        }
+    }
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airScaling");
+    fprintf(out, "  \"max_threads\": %u,\n", maxThreads);
+    fprintf(out, "  \"hardware_threads\": %u,\n", hardwareThreads);
+    fprintf(out, "  \"calls_per_thread\": %u,\n", calls);
+    fprintf(out, "  \"states_per_regime\": %u,\n", count);
+    fprintf(out, "  \"seed\": %llu,\n", seed);
+    fprintf(out, "  \"sizeof_air\": %u,\n", uint32(sizeof(Air)));
+    fprintf(out, "  \"cache_line\": %u,\n", uint32(CACHE_LINE));
+    fprintf(out, "  \"results\": [");
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const ScalingResult &r = results[i];
+
+        fprintf(out, "%s\n    {\n", i ? "," : "");
+        fprintf(out, "      \"layout\": \"%s\",\n", layoutNames[r.layout]);
+        fprintf(out, "      \"call\": \"%s\",\n", callNames[r.call]);
+        fprintf(out, "      \"threads\": %u,\n", r.threads);
+        fprintf(out, "      \"seconds\": %.6f,\n", r.seconds);
+        fprintf(out, "      \"throughput_per_s\": %.1f,\n", r.throughput);
+        fprintf(out, "      \"efficiency\": %.4f,\n", r.efficiency);
+        fprintf(out, "      \"latency_ns\": { \"p50\": %.1f, \"p99\": %.1f, "
+                "\"p99.9\": %.1f, \"max\": %.1f },\n",
+                r.p50, r.p99, r.p999, r.max);
+        fprintf(out, "      \"checksum\": %.17g\n    }", r.checksum);
+    }
+
+    fprintf(out, "\n  ],\n");
+
+    // False sharing: per-thread objects packed into one array should
+    // scale like padded ones; a large gap means that neighbouring
+    // objects are bouncing the cache lines they share.
+    bool sharesLines = (sizeof(Air) % CACHE_LINE) != 0;
+    bool first = true;
+
+    fprintf(out, "  \"adjacent_objects_share_lines\": %s,\n",
+            sharesLines ? "true" : "false");
+    fprintf(out, "  \"false_sharing\": [");
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const ScalingResult &adjacent = results[i];
+
+        if ((adjacent.layout != LAYOUT_ADJACENT) || (adjacent.threads < 2))
+            continue;
+
+        for (size_t j = 0; j < results.size(); ++j)
+        {
+            const ScalingResult &padded = results[j];
+
+            if ((padded.layout != LAYOUT_PADDED)
+                || (padded.call != adjacent.call)
+                || (padded.threads != adjacent.threads))
+                continue;
+
+            // Oversubscribed threads time-share cores, so the lines are
+            // not contended and the ratio is only scheduling noise.
+            double ratio = adjacent.throughput / padded.throughput;
+            bool oversubscribed = adjacent.threads > hardwareThreads,
+                 suspected = !oversubscribed && (ratio < fsThreshold);
+
+            if (suspected)
+                fprintf(stderr, "false sharing suspected: %s at %u threads "
+                        "(adjacent/padded throughput %.2f)\n",
+                        callNames[adjacent.call], adjacent.threads, ratio);
+
+            fprintf(out, "%s\n    { \"call\": \"%s\", \"threads\": %u, "
+                    "\"ratio\": %.4f, \"oversubscribed\": %s, "
+                    "\"suspected\": %s }",
+                    first ? "" : ",", callNames[adjacent.call],
+                    adjacent.threads, ratio,
+                    oversubscribed ? "true" : "false",
+                    suspected ? "true" : "false");
+
+            first = false;
+        }
+    }
+
+    fprintf(out, "\n  ],\n");
+    benchJsonStats(out);
+    fprintf(out, "\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,267 @@
+/******************************************************************************
+||  airStageProfile.cpp      (implementation file)                           ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Per-stage cycle profile of Air::calculateProperties over the standard  ||
+||    input regimes.  The library must be built with AIR_ENABLE_PROFILE;     ||
+||    the sampled calls of each regime are reported as the mean ticks and    ||
+||    share of every stage, log2 tick histograms, and the slowest sampled    ||
+||    calls with their stage breakdown.                                      ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airProfile.h                                                           ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airStageProfile.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airProfile.h"
+#include "benchSupport.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+/** Measure the rate of the profiler tick source.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The number of ticks per nanosecond.
+*/
+static double ticksPerNs (void)
+{
+    double start = benchSeconds();
+    uint64 ticks = AirProfile::now();
+
+    while (benchSeconds() - start < 0.05)
+        ;
+
+    double elapsed = benchSeconds() - start;
+
+    return double(AirProfile::now() - ticks) / (elapsed * 1E9);
+}
+
+/** Write one histogram as a JSON array.
+ *
+ *  @pre out is open for writing.
+ *  @post none.
+ *  @param out The output stream.
+ *  @param histogram The HISTOGRAM_BINS bins.
+ *  @return none.
+*/
+static void writeHistogram (FILE *out, const uint64 *histogram)
+{
+    fprintf(out, "[");
+
+    for (uint32 b = 0; b < AirProfile::HISTOGRAM_BINS; ++b)
+        fprintf(out, "%s%llu", b ? ", " : "", histogram[b]);
+
+    fprintf(out, "]");
+
+    return;
+}
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --states N      states per regime (default 4096)\n"
+            "  --passes N      passes over each regime (default 64)\n"
+            "  --period N      time one call in N (default 64)\n"
+            "  --seed N        input generator seed (default 2014)\n"
+            "  --filter TEXT   only run regimes whose name contains TEXT\n"
+            "  --output FILE   write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    uint32 count = 4096,
+           passes = 64,
+           period = 64;
+    uint64 seed = 2014;
+    const char *filter = NULL,
+               *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--states") && hasValue)
+            count = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--passes") && hasValue)
+            passes = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--period") && hasValue)
+            period = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--filter") && hasValue)
+            filter = argv[++i];
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((count == 0) || (passes == 0) || (period == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (!AirProfile::enabled())
+    {
+        fprintf(stderr, "airStageProfile: the air library was built "
+                "without AIR_ENABLE_PROFILE\n");
+        return 1;
+    }
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airStageProfile: cannot open %s\n", output);
+        return 1;
+    }
+
+    std::vector<BenchRegime> regimes;
+    benchRegimes(regimes, count, seed);
+
+    AirProfile::setSamplePeriod(period);
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airStageProfile");
+    fprintf(out, "  \"clock\": \"%s\",\n", AirProfile::clockName());
+    fprintf(out, "  \"ticks_per_ns\": %.4f,\n", ticksPerNs());
+    fprintf(out, "  \"sample_period\": %u,\n", period);
+    fprintf(out, "  \"histogram\": \"bin b counts 2^b <= ticks < 2^(b+1)\",\n");
+    fprintf(out, "  \"regimes\": [");
+
+    bool first = true;
+
+    for (size_t r = 0; r < regimes.size(); ++r)
+    {
+        if (filter && (regimes[r].name.find(filter) == std::string::npos))
+            continue;
+
+        const std::vector<BenchState> &states = regimes[r].states;
+        Air air;
+        double checksum = 0.0;
+
+        AirProfile::reset();
+
+        for (uint32 pass = 0; pass < passes; ++pass)
+        {
+            for (size_t i = 0; i < states.size(); ++i)
+            {
+                air.calculateProperties(states[i].pressure,
+                                        states[i].temperature);
+                checksum += air.getDensity();
+            }
+        }
+
+        AirProfile::Report report;
+        AirProfile::report(report);
+
+        double calls = double(std::max(report.calls, 1ULL)),
+               total = double(std::max(report.ticks[AirProfile::NUM_STAGES],
+                                       1ULL));
+
+        fprintf(stderr, "%-20s %8llu samples %8.0f ticks/call\n",
+                regimes[r].name.c_str(), report.calls, total / calls);
+
+        fprintf(out, "%s\n    {\n", first ? "" : ",");
+        fprintf(out, "      \"regime\": %s,\n",
+                benchJsonString(regimes[r].name).c_str());
+        fprintf(out, "      \"sampled_calls\": %llu,\n", report.calls);
+        fprintf(out, "      \"mean_ticks_per_call\": %.1f,\n", total / calls);
+        fprintf(out, "      \"call_histogram\": ");
+        writeHistogram(out, report.histogram[AirProfile::NUM_STAGES]);
+        fprintf(out, ",\n      \"stages\": [");
+
+        for (uint32 s = 0; s < AirProfile::NUM_STAGES; ++s)
+        {
+            fprintf(stderr, "    %-16s %8.1f ticks %5.1f%%\n",
+                    AirProfile::stageName(s), report.ticks[s] / calls,
+                    100.0 * report.ticks[s] / total);
+
+            fprintf(out, "%s\n        { \"stage\": \"%s\", "
+                    "\"mean_ticks\": %.1f, \"share\": %.4f,\n"
+                    "          \"histogram\": ",
+                    s ? "," : "", AirProfile::stageName(s),
+                    report.ticks[s] / calls, report.ticks[s] / total);
+            writeHistogram(out, report.histogram[s]);
+            fprintf(out, " }");
+        }
+
+        fprintf(out, "\n      ],\n      \"slow_calls\": [");
+
+        for (size_t i = 0; i < report.slow.size(); ++i)
+        {
+            const AirProfile::SlowCall &call = report.slow[i];
+
+            fprintf(out, "%s\n        { \"pressure\": %.9g, "
+                    "\"temperature\": %.9g, \"ticks\": %llu, \"stages\": [",
+                    i ? "," : "", call.pressure, call.temperature,
+                    call.total);
+
+            for (uint32 s = 0; s < AirProfile::NUM_STAGES; ++s)
+                fprintf(out, "%s%llu", s ? ", " : "", call.stages[s]);
+
+            fprintf(out, "] }");
+        }
+
+        fprintf(out, "\n      ],\n");
+        fprintf(out, "      \"checksum\": %.17g\n    }", checksum);
+
+        first = false;
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
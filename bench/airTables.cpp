@@ -0,0 +1,650 @@
+/******************************************************************************
+||  airTables.cpp      (implementation file)                                 ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Startup cost and accuracy of the mapped property tables.  A table is   ||
+||    generated, saved, and mapped back; the tool reports the time of each   ||
+||    step, the interpolation error of the mapped table against              ||
+||    calculateProperties at random states, and the per state cost of both.  ||
+||    An enthalpy table baked by the compiler (airConstexpr.h) is checked    ||
+||    the same way.                                                          ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airConstexpr.h                                                         ||
+||    airTable.h                                                             ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTables.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airConstexpr.h"
+#include "airTable.h"
+#include "airTableCache.h"
+#include "airTableShared.h"
+#include "benchSupport.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AIR_TABLES_FORK
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+static const uint32 NUM_PROPERTIES = AirTable::NUM_PROPERTIES;
+
+/**
+ *  @struct BakedGrid The grid of the enthalpy table baked by the
+ *          compiler: the pressure range of the ADT (1E-4 to 100 atm)
+ *          above 200 K.  Each node costs about 5 ms of compile time.
+*/
+struct BakedGrid
+{
+    static const uint32 NP = 11,
+                        NT = 121;
+
+    static constexpr double LOG_P_MIN = AirConstexpr::log10(1E-4 * 0.101325),
+                            LOG_P_MAX = AirConstexpr::log10(100.0 * 0.101325),
+                            T_MIN = 200.0,
+                            T_MAX = 30000.0;
+};
+
+typedef AirBakedTable<BakedGrid, &AirConstexpr::State::enthalpy>
+        BakedEnthalpy;
+
+/******************************************************
+**                    Samples                        **
+******************************************************/
+
+/** Build uniformly random samples inside the grid of a table.
+ *
+ *  @pre none.
+ *  @post states holds count states.
+ *  @param states The destination vector.
+ *  @param spec The grid of the table.
+ *  @param count The number of states.
+ *  @param seed The seed of the pseudo-random generator.
+ *  @return none.
+*/
+static void randomSamples (std::vector<BenchState> &states,
+                           const AirTableSpec &spec, uint32 count,
+                           uint64 seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        BenchState state;
+
+        state.pressure = pow(10.0, spec.logPMin + (spec.logPMax
+                                   - spec.logPMin) * unit(rng));
+        state.temperature = spec.tMin + (spec.tMax - spec.tMin) * unit(rng);
+        state.enthalpy = 0.0;
+
+        states.push_back(state);
+    }
+
+    return;
+}
+
+/** Extract the tabulated properties from an evaluated state.
+ *
+ *  @pre none.
+ *  @post values holds NUM_PROPERTIES entries in AirTable order.
+ *  @param air The evaluated state.
+ *  @param values The destination.
+ *  @return none.
+*/
+static void extract (const Air &air, double values[NUM_PROPERTIES])
+{
+    values[AirTable::ENTHALPY] = air.getEnthalpy();
+    values[AirTable::SPECIFIC_HEAT] = air.getSpecificHeat();
+    values[AirTable::GAMMA] = air.getGamma();
+    values[AirTable::DENSITY] = air.getDensity();
+    values[AirTable::ENTROPY] = air.getEntropy();
+    values[AirTable::SOUND_SPEED] = air.getSoundSpeed();
+    values[AirTable::THERMAL_COND] = air.getThermalConductivity();
+    values[AirTable::VISCOSITY] = air.getDynamicViscosity();
+    values[AirTable::PRANDTL] = air.getPrandtlNumber();
+    values[AirTable::COMP_FACTOR] = air.getCompressibilityFactor();
+
+    return;
+}
+
+/******************************************************
+**                    Kernels                        **
+******************************************************/
+
+// The table timed by tableKernel.
+static const AirTable *timedTable = NULL;
+
+static double exactKernel (const std::vector<BenchState> &states)
+{
+    Air air;
+    double checksum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        checksum += air.getEnthalpy() + air.getDensity();
+    }
+
+    return checksum;
+}
+
+static double tableKernel (const std::vector<BenchState> &states)
+{
+    double checksum = 0.0,
+           values[NUM_PROPERTIES];
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        timedTable->lookup(states[i].pressure, states[i].temperature,
+                           values);
+        checksum += values[AirTable::ENTHALPY]
+                  + values[AirTable::DENSITY];
+    }
+
+    return checksum;
+}
+
+static double bakedKernel (const std::vector<BenchState> &states)
+{
+    double checksum = 0.0;
+
+    for (size_t i = 0; i < states.size(); ++i)
+        checksum += BakedEnthalpy::value(states[i].pressure,
+                                         states[i].temperature);
+
+    return checksum;
+}
+
+/******************************************************
+**                 Shared Tables                     **
+******************************************************/
+
+/**
+ *  @struct SharedResult The outcome of attaching several processes to
+ *          one shared table.
+*/
+struct SharedResult
+{
+    uint32 builders,    // Processes that built the segment
+           joined,      // Processes that mapped the finished segment
+           failed;      // Processes that could not attach
+    double ms;          // Until every process was attached
+};
+
+/** Attach several processes to the shared copy of a table.  Every
+ *  process stays attached until all of them have reported, so exactly
+ *  one of them should build the segment.
+ *
+ *  @pre processes > 0.
+ *  @post The segment is removed again.
+ *  @param spec The grid and contents.
+ *  @param processes The number of processes.
+ *  @return The number of builders, joiners, and failures.
+*/
+static SharedResult attachShared (const AirTableSpec &spec,
+                                  uint32 processes)
+{
+    SharedResult result = { 0, 0, 0, 0.0 };
+
+#ifdef AIR_TABLES_FORK
+    int report[2],
+        release[2];
+
+    if (pipe(report) || pipe(release))
+    {
+        result.failed = processes;
+        return result;
+    }
+
+    fflush(NULL);
+
+    double start = benchSeconds();
+
+    for (uint32 p = 0; p < processes; ++p)
+    {
+        if (fork() == 0)
+        {
+            AirTableShared shared;
+            AirTable table;
+            char outcome = 'F',
+                 end;
+
+            close(report[0]);
+            close(release[1]);
+
+            if (shared.attach(spec, table)
+                && std::isfinite(table.value(AirTable::ENTHALPY, 0.1,
+                                             1000.0)))
+                outcome = shared.isBuilder() ? 'B' : 'J';
+            else
+                fprintf(stderr, "airTables: %s\n", shared.getError());
+
+            ssize_t sent = write(report[1], &outcome, 1);
+
+            // Stay attached until every process has reported.
+            while (read(release[0], &end, 1) > 0)
+                ;
+
+            shared.detach();
+            _exit(sent == 1 ? 0 : 1);
+        }
+    }
+
+    close(report[1]);
+    close(release[0]);
+
+    char outcome;
+
+    for (uint32 p = 0; (p < processes) && (read(report[0], &outcome, 1) == 1);
+         ++p)
+    {
+        if (outcome == 'B')
+            ++result.builders;
+        else if (outcome == 'J')
+            ++result.joined;
+        else
+            ++result.failed;
+    }
+
+    result.ms = (benchSeconds() - start) * 1E3;
+    result.failed = processes - result.builders - result.joined;
+
+    close(release[1]);
+    close(report[0]);
+
+    for (uint32 p = 0; p < processes; ++p)
+        wait(NULL);
+#else
+    (void)spec;
+    result.failed = processes;
+#endif
+
+    return result;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --grid NP,NT     table points in log P, T (default 61,600)\n"
+            "  --tmin T         lowest temperature in K (default 200)\n"
+            "  --encoding E     double or q16 (default double)\n"
+            "  --file PATH      table file (default air.table)\n"
+            "  --cache DIR      also time AirTableCache loads from DIR\n"
+            "  --shared N       attach N processes to one shared table\n"
+            "  --random N       accuracy and timing samples (default 20000)\n"
+            "  --min-time S     minimum timed seconds per case (0.2)\n"
+            "  --seed N         random sample seed (default 2014)\n"
+            "  --output FILE    write the report to FILE (default stdout)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    AirTableSpec spec;
+    uint32 randomCount = 20000,
+           sharedProcesses = 0;
+    double minTime = 0.2;
+    uint64 seed = 2014;
+    const char *path = "air.table",
+               *cacheDirectory = NULL,
+               *output = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--grid") && hasValue)
+        {
+            if (sscanf(argv[++i], "%u,%u", &spec.nP, &spec.nT) != 2)
+                spec.nP = 0;
+        }
+        else if (!strcmp(argv[i], "--tmin") && hasValue)
+            spec.tMin = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--encoding") && hasValue)
+        {
+            const char *name = argv[++i];
+
+            if (!strcmp(name, "double"))
+                spec.encoding = AirTable::ENCODING_DOUBLE;
+            else if (!strcmp(name, "q16"))
+                spec.encoding = AirTable::ENCODING_Q16;
+            else
+            {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--file") && hasValue)
+            path = argv[++i];
+        else if (!strcmp(argv[i], "--cache") && hasValue)
+            cacheDirectory = argv[++i];
+        else if (!strcmp(argv[i], "--shared") && hasValue)
+            sharedProcesses = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--random") && hasValue)
+            randomCount = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--min-time") && hasValue)
+            minTime = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            output = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if ((spec.nP < 2) || (spec.nT < 2) || (randomCount == 0)
+        || !(spec.tMin > 0.0) || !(spec.tMin < spec.tMax))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Startup costs: tabulating, writing, and mapping the table.
+    AirTable generated,
+             mapped;
+    double start = benchSeconds();
+
+    if (!generated.generate(spec))
+    {
+        fprintf(stderr, "airTables: %s\n", generated.getError());
+        return 1;
+    }
+
+    double generateMs = (benchSeconds() - start) * 1E3;
+
+    start = benchSeconds();
+
+    if (!generated.save(path))
+    {
+        fprintf(stderr, "airTables: %s\n", generated.getError());
+        return 1;
+    }
+
+    double saveMs = (benchSeconds() - start) * 1E3;
+
+    start = benchSeconds();
+    bool verified = mapped.map(path, true);
+    double mapVerifiedMs = (benchSeconds() - start) * 1E3;
+
+    start = benchSeconds();
+    bool unverified = mapped.map(path, false);
+    double mapMs = (benchSeconds() - start) * 1E3;
+
+    if (!verified || !unverified)
+    {
+        fprintf(stderr, "airTables: %s\n", mapped.getError());
+        return 1;
+    }
+
+    fprintf(stderr, "generate %.1f ms, save %.1f ms, map %.3f ms "
+            "(%.1f ms verified), %.1f MiB\n", generateMs, saveMs, mapMs,
+            mapVerifiedMs, mapped.getBytes() / 1048576.0);
+
+    // Cache loads: the first one builds the table unless an earlier run
+    // stored it, the second one always maps the stored file.
+    double cacheFirstMs = 0.0,
+           cacheWarmMs = 0.0;
+    bool cacheBuilt = false;
+
+    if (cacheDirectory)
+    {
+        AirTableCache cache(cacheDirectory);
+        AirTable first,
+                 warm;
+
+        start = benchSeconds();
+        bool loaded = cache.load(spec, first);
+        cacheFirstMs = (benchSeconds() - start) * 1E3;
+        cacheBuilt = cache.getBuilds() > 0;
+
+        start = benchSeconds();
+        loaded = cache.load(spec, warm) && loaded;
+        cacheWarmMs = (benchSeconds() - start) * 1E3;
+
+        if (!loaded || cache.getError()[0])
+        {
+            fprintf(stderr, "airTables: %s\n", cache.getError());
+            return 1;
+        }
+
+        fprintf(stderr, "cache %s %.1f ms, warm %.3f ms (%s)\n",
+                cacheBuilt ? "build" : "hit", cacheFirstMs, cacheWarmMs,
+                cache.path(spec).c_str());
+    }
+
+    SharedResult shared = { 0, 0, 0, 0.0 };
+
+    if (sharedProcesses)
+    {
+        shared = attachShared(spec, sharedProcesses);
+
+        fprintf(stderr, "shared: %u processes attached in %.1f ms "
+                "(%u built, %u joined, %u failed)\n", sharedProcesses,
+                shared.ms, shared.builders, shared.joined, shared.failed);
+
+        if (shared.failed)
+            return 1;
+    }
+
+    // Interpolation error of the mapped table against the exact fits.
+    std::vector<BenchState> states;
+    randomSamples(states, spec, randomCount, seed);
+
+    double maxRel[NUM_PROPERTIES],
+           sumRel[NUM_PROPERTIES];
+    uint32 compared[NUM_PROPERTIES];
+    Air air;
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        maxRel[p] = 0.0;
+        sumRel[p] = 0.0;
+        compared[p] = 0;
+    }
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        double exact[NUM_PROPERTIES],
+               table[NUM_PROPERTIES];
+
+        air.calculateProperties(states[i].pressure, states[i].temperature);
+        extract(air, exact);
+
+        if (!mapped.lookup(states[i].pressure, states[i].temperature,
+                           table))
+            continue;
+
+        for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+        {
+            // Cells touching the undefined sound speed are not compared.
+            if (!std::isfinite(exact[p]) || !std::isfinite(table[p]))
+                continue;
+
+            double scale = (p == AirTable::ENTROPY)
+                         ? std::max(fabs(exact[p]), 1.0) : fabs(exact[p]),
+                   rel = fabs(table[p] - exact[p]) / scale;
+
+            maxRel[p] = std::max(maxRel[p], rel);
+            sumRel[p] += rel;
+            ++compared[p];
+        }
+    }
+
+    // Per state cost of the mapped table and of the exact fits.
+    timedTable = &mapped;
+
+    BenchResult exactResult = benchMeasure(exactKernel, states, minTime),
+                tableResult = benchMeasure(tableKernel, states, minTime);
+
+    fprintf(stderr, "calculateProperties %8.1f ns/state\n",
+            exactResult.nsMin);
+    fprintf(stderr, "AirTable::lookup    %8.1f ns/state\n",
+            tableResult.nsMin);
+
+    // The enthalpy table baked by the compiler: its nodes against the
+    // run time fits, and its interpolation error and cost.
+    double bakedNodeRel = 0.0,
+           bakedMaxRel = 0.0;
+
+    for (uint32 i = 0; i < BakedGrid::NP; ++i)
+    {
+        for (uint32 j = 0; j < BakedGrid::NT; ++j)
+        {
+            double baked = BakedEnthalpy::values.value[i * BakedGrid::NT + j],
+                   pressure = pow(10.0, BakedGrid::LOG_P_MIN
+                                        + (BakedGrid::LOG_P_MAX
+                                           - BakedGrid::LOG_P_MIN)
+                                        * i / (BakedGrid::NP - 1.0)),
+                   temperature = BakedGrid::T_MIN
+                               + (BakedGrid::T_MAX - BakedGrid::T_MIN)
+                               * j / (BakedGrid::NT - 1.0);
+
+            if (air.calculateProperties(pressure, temperature))
+                bakedNodeRel = std::max(bakedNodeRel,
+                                        fabs(baked / air.getEnthalpy()
+                                             - 1.0));
+        }
+    }
+
+    for (size_t i = 0; i < states.size(); ++i)
+    {
+        double baked = BakedEnthalpy::value(states[i].pressure,
+                                            states[i].temperature);
+
+        if (std::isfinite(baked)
+            && air.calculateProperties(states[i].pressure,
+                                       states[i].temperature))
+            bakedMaxRel = std::max(bakedMaxRel,
+                                   fabs(baked / air.getEnthalpy() - 1.0));
+    }
+
+    BenchResult bakedResult = benchMeasure(bakedKernel, states, minTime);
+
+    fprintf(stderr, "AirBakedTable       %8.1f ns/state (%u x %u "
+            "enthalpy, node error %.2e)\n", bakedResult.nsMin,
+            BakedGrid::NP, BakedGrid::NT, bakedNodeRel);
+
+    FILE *out = stdout;
+
+    if (output && !(out = fopen(output, "w")))
+    {
+        fprintf(stderr, "airTables: cannot open %s\n", output);
+        return 1;
+    }
+
+    fprintf(out, "{\n");
+    benchJsonHeader(out, "airTables");
+    fprintf(out, "  \"grid\": [%u, %u],\n", spec.nP, spec.nT);
+    fprintf(out, "  \"log10_p_mpa\": [%.9g, %.9g],\n", spec.logPMin,
+            spec.logPMax);
+    fprintf(out, "  \"temperature_k\": [%g, %g],\n", spec.tMin, spec.tMax);
+    fprintf(out, "  \"encoding\": \"%s\",\n",
+            (spec.encoding == AirTable::ENCODING_Q16) ? "q16" : "double");
+    fprintf(out, "  \"image_bytes\": %llu,\n",
+            (unsigned long long)mapped.getBytes());
+    fprintf(out, "  \"coefficient_hash\": \"%016llx\",\n",
+            (unsigned long long)AirTable::coefficientHash());
+    fprintf(out, "  \"generate_ms\": %.3f,\n", generateMs);
+    fprintf(out, "  \"save_ms\": %.3f,\n", saveMs);
+    fprintf(out, "  \"map_ms\": %.3f,\n", mapMs);
+    fprintf(out, "  \"map_verified_ms\": %.3f,\n", mapVerifiedMs);
+
+    if (cacheDirectory)
+        fprintf(out, "  \"cache\": { \"first_ms\": %.3f, \"built\": %s, "
+                "\"warm_ms\": %.3f },\n", cacheFirstMs,
+                cacheBuilt ? "true" : "false", cacheWarmMs);
+    else
+        fprintf(out, "  \"cache\": null,\n");
+
+    if (sharedProcesses)
+        fprintf(out, "  \"shared\": { \"processes\": %u, \"attach_ms\": %.3f, "
+                "\"builders\": %u, \"joined\": %u, \"segment_bytes\": %llu, "
+                "\"private_bytes\": %llu },\n", sharedProcesses, shared.ms,
+                shared.builders, shared.joined,
+                (unsigned long long)mapped.getBytes() + 4096,
+                (unsigned long long)mapped.getBytes() * sharedProcesses);
+    else
+        fprintf(out, "  \"shared\": null,\n");
+    fprintf(out, "  \"baked\": { \"grid\": [%u, %u], \"property\": "
+            "\"enthalpy\", \"bytes\": %llu, \"node_rel\": %.4e, "
+            "\"max_rel\": %.4e, \"ns_per_state\": %.3f },\n",
+            BakedGrid::NP, BakedGrid::NT,
+            (unsigned long long)sizeof(BakedEnthalpy::values), bakedNodeRel,
+            bakedMaxRel, bakedResult.nsMin);
+    fprintf(out, "  \"samples\": %u,\n", randomCount);
+    fprintf(out, "  \"ns_per_state_exact\": %.3f,\n", exactResult.nsMin);
+    fprintf(out, "  \"ns_per_state_table\": %.3f,\n", tableResult.nsMin);
+    fprintf(out, "  \"checksum\": %.17g,\n",
+            exactResult.checksum + tableResult.checksum
+            + bakedResult.checksum);
+    fprintf(out, "  \"properties\": {");
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+        fprintf(out, "%s\n    \"%s\": { \"max_rel\": %.4e, "
+                "\"mean_rel\": %.4e, \"quantization\": %.4e, "
+                "\"compared\": %u }", p ? "," : "",
+                AirTable::propertyName(p), maxRel[p],
+                sumRel[p] / double(std::max(compared[p], 1u)),
+                mapped.getQuantizationError(p), compared[p]);
+
+    fprintf(out, "\n  }\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
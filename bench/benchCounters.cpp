@@ -0,0 +1,263 @@
+/******************************************************************************
+||  benchCounters.cpp      (implementation file)                             ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Hardware performance counters for the benchmark harness of the         ||
+||    equilibrium air ADT.  Cycles, instructions, branch misses, and L1      ||
+||    data and last level cache read misses of the calling thread are        ||
+||    counted with the Linux perf_event_open interface.  Every event is      ||
+||    opened on its own, so the harness degrades to the events that are      ||
+||    allowed (or to none) instead of failing.                               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    benchCounters.h                                                        ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file benchCounters.cpp
+ *  @date 2026-10-18
+*/
+
+#include "benchCounters.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (opens the events, disabled).  */
+BenchCounters::BenchCounters()
+{
+    _error[0] = '\0';
+
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        _fd[e] = -1;
+        _value[e] = 0.0;
+    }
+
+#ifdef __linux__
+    static const struct
+    {
+        uint32 type;
+        uint64 config;
+    } events[NUM_EVENTS] =
+    {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE,  PERF_COUNT_HW_CACHE_L1D
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HW_CACHE,  PERF_COUNT_HW_CACHE_LL
+                            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) }
+    };
+
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+
+        attr.size = sizeof(attr);
+        attr.type = events[e].type;
+        attr.config = events[e].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;  // Allowed with perf_event_paranoid 2
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+                         | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // This thread, any CPU, no group.
+        _fd[e] = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+
+        if ((_fd[e] < 0) && !_error[0])
+            snprintf(_error, sizeof(_error), "perf_event_open(%s): %s",
+                     name(e), strerror(errno));
+    }
+#else
+    snprintf(_error, sizeof(_error), "perf_event_open: not Linux");
+#endif
+}
+
+/** Default destructor (closes the events).  */
+BenchCounters::~BenchCounters()
+{
+#ifdef __linux__
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        if (_fd[e] >= 0)
+            close(_fd[e]);
+    }
+#endif
+}
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Retrieve the name of an event (as used in reports).
+ *
+ *  @pre event < NUM_EVENTS.
+ *  @post none.
+ *  @param event The event of interest.
+ *  @return The name.
+*/
+const char * BenchCounters::name (uint32 event)
+{
+    static const char *names[NUM_EVENTS] =
+    {
+        "cycles", "instructions", "branch_misses", "l1d_misses",
+        "llc_misses"
+    };
+
+    return names[event];
+}
+
+/** Determine whether an event could be opened.
+ *
+ *  @pre event < NUM_EVENTS.
+ *  @post none.
+ *  @param event The event of interest.
+ *  @return true The event is counted.
+*/
+bool BenchCounters::available (uint32 event) const
+{  return _fd[event] >= 0;  }
+
+/** Determine whether any event could be opened.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true At least one event is counted.
+*/
+bool BenchCounters::anyAvailable (void) const
+{
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        if (_fd[e] >= 0)
+            return true;
+    }
+
+    return false;
+}
+
+/** Retrieve the reason why the events are unavailable.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The error of the first failed open ("" if none failed).
+*/
+const char * BenchCounters::getError (void) const
+{  return _error;  }
+
+/** Zero the counts and start counting.
+ *
+ *  @pre none.
+ *  @post The available events are counting from zero.
+ *  @return none.
+*/
+void BenchCounters::start (void)
+{
+#ifdef __linux__
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        if (_fd[e] >= 0)
+        {
+            ioctl(_fd[e], PERF_EVENT_IOC_RESET, 0);
+            ioctl(_fd[e], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+
+    return;
+}
+
+/** Stop counting and read the counts.
+ *
+ *  @pre start() was called.
+ *  @post The counts since start() are stored.
+ *  @return none.
+*/
+void BenchCounters::stop (void)
+{
+#ifdef __linux__
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        if (_fd[e] >= 0)
+            ioctl(_fd[e], PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    for (uint32 e = 0; e < NUM_EVENTS; ++e)
+    {
+        // value, time enabled, time running
+        uint64 data[3] = { 0, 0, 0 };
+
+        _value[e] = 0.0;
+
+        if ((_fd[e] < 0) || (read(_fd[e], data, sizeof(data))
+                                 != ssize_t(sizeof(data))))
+            continue;
+
+        // Scale up when the event was only scheduled part of the time.
+        _value[e] = double(data[0]);
+
+        if ((data[2] > 0) && (data[2] < data[1]))
+            _value[e] *= double(data[1]) / double(data[2]);
+    }
+#endif
+
+    return;
+}
+
+/** Retrieve the count of an event between start() and stop().
+ *
+ *  @pre event < NUM_EVENTS and the event is available.
+ *  @post none.
+ *  @param event The event of interest.
+ *  @return The (multiplexing scaled) count.
+*/
+double BenchCounters::value (uint32 event) const
+{  return _value[event];  }
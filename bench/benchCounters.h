@@ -0,0 +1,159 @@
+/******************************************************************************
+||  benchCounters.h      (definition file)                                   ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Hardware performance counters for the benchmark harness of the         ||
+||    equilibrium air ADT.  Cycles, instructions, branch misses, and L1      ||
+||    data and last level cache read misses of the calling thread are        ||
+||    counted with the Linux perf_event_open interface.  Every event is      ||
+||    opened on its own, so the harness degrades to the events that are      ||
+||    allowed (or to none) instead of failing.                               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    benchCounters.cpp                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file benchCounters.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_BENCH_COUNTERS_H
+#define _GH_DEF_BENCH_COUNTERS_H
+
+#include "air.h"
+
+/**
+ *  @class BenchCounters Hardware performance counters of the calling
+ *         thread (Linux perf_event_open).
+ *
+ *  Each event is opened on its own, so a counter that the CPU, the
+ *  kernel, or perf_event_paranoid does not allow only marks that event
+ *  unavailable.  On other systems no event is available.  The counts
+ *  are scaled for multiplexing when the kernel time-shares the
+ *  counters.
+*/
+class BenchCounters
+{
+  public:
+    /** The counted events.  */
+    enum Event
+    {
+        CYCLES,         // CPU cycles
+        INSTRUCTIONS,   // Retired instructions
+        BRANCH_MISSES,  // Mispredicted branches
+        L1D_MISSES,     // L1 data cache read misses
+        LLC_MISSES,     // Last level cache read misses
+        NUM_EVENTS
+    };
+
+    /** Default constructor (opens the events, disabled).  */
+    BenchCounters();
+
+    /** Default destructor (closes the events).  */
+    ~BenchCounters();
+
+    /** Retrieve the name of an event (as used in reports).
+     *
+     *  @pre event < NUM_EVENTS.
+     *  @post none.
+     *  @param event The event of interest.
+     *  @return The name.
+    */
+    static const char * name (uint32 event);
+
+    /** Determine whether an event could be opened.
+     *
+     *  @pre event < NUM_EVENTS.
+     *  @post none.
+     *  @param event The event of interest.
+     *  @return true The event is counted.
+    */
+    bool available (uint32 event) const;
+
+    /** Determine whether any event could be opened.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true At least one event is counted.
+    */
+    bool anyAvailable (void) const;
+
+    /** Retrieve the reason why the events are unavailable.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The error of the first failed open ("" if none failed).
+    */
+    const char * getError (void) const;
+
+    /** Zero the counts and start counting.
+     *
+     *  @pre none.
+     *  @post The available events are counting from zero.
+     *  @return none.
+    */
+    void start (void);
+
+    /** Stop counting and read the counts.
+     *
+     *  @pre start() was called.
+     *  @post The counts since start() are stored.
+     *  @return none.
+    */
+    void stop (void);
+
+    /** Retrieve the count of an event between start() and stop().
+     *
+     *  @pre event < NUM_EVENTS and the event is available.
+     *  @post none.
+     *  @param event The event of interest.
+     *  @return The (multiplexing scaled) count.
+    */
+    double value (uint32 event) const;
+
+  private:
+    int _fd[NUM_EVENTS];         // Event file descriptors (-1: unavailable)
+    double _value[NUM_EVENTS];   // Counts of the last start()/stop()
+    char _error[128];            // Why the first event could not be opened
+
+    // Not copyable.
+    BenchCounters (const BenchCounters &);
+    BenchCounters & operator= (const BenchCounters &);
+};
+
+#endif
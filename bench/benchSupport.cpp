@@ -0,0 +1,550 @@
+/******************************************************************************
+||  benchSupport.cpp      (implementation file)                              ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Shared support for the benchmark executables of the equilibrium air    ||
+||    ADT: the standard input regimes (low temperature, each pressure        ||
+||    decade, curve fit breakpoints, random mixed states, and synthetic      ||
+||    hypersonic flowfield profiles), a pass-based timer, and helpers for    ||
+||    the JSON reports.                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airCoefficients.h                                                      ||
+||    benchSupport.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file benchSupport.cpp
+ *  @date 2026-10-18
+*/
+
+#include "benchSupport.h"
+#include "airCoefficients.h"
+#include "airStats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+/******************************************************
+**               Curve Fit Breakpoints               **
+******************************************************/
+
+/** Collect the curve fit temperature breakpoints of every table.
+ *
+ *  @pre none.
+ *  @post breakpoints holds the sorted, unique breakpoints above 500 K.
+ *  @param breakpoints The destination vector [units: K].
+ *  @return none.
+*/
+void benchBreakpoints (std::vector<double> &breakpoints)
+{
+    typedef AirCoefficients C;
+
+    const double *tables[5] = { C::hTmin, C::cpTmin, C::kTmin, C::muTmin,
+                                C::zTmin };
+    const uint32 *groups[5] = { C::hDecadeRows, C::cpDecadeRows,
+                                C::kDecadeRows, C::muDecadeRows,
+                                C::zDecadeRows };
+
+    breakpoints.clear();
+
+    for (uint32 t = 0; t < 5; ++t)
+    {
+        for (uint32 row = 0; row < groups[t][7]; ++row)
+        {
+            if (tables[t][row] > 500.0)
+                breakpoints.push_back(tables[t][row]);
+        }
+    }
+
+    std::sort(breakpoints.begin(), breakpoints.end());
+    breakpoints.erase(std::unique(breakpoints.begin(), breakpoints.end()),
+                      breakpoints.end());
+
+    return;
+}
+
+/******************************************************
+**                  Input Regimes                    **
+******************************************************/
+
+/** Append a state, storing its enthalpy for the P-H kernels.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post The state is appended to regime.
+ *  @param regime The destination regime.
+ *  @param pressure The pressure of the state in atm.
+ *  @param temperature The temperature of the state in K.
+ *  @return none.
+*/
+static void addState (BenchRegime &regime, double pressure,
+                      double temperature)
+{
+    BenchState state;
+    Air air;
+
+    //   0.101325 = conversion factor atm -> MPa
+    state.pressure = pressure * 0.101325;
+    state.temperature = temperature;
+
+    air.calculateProperties(state.pressure, state.temperature);
+    state.enthalpy = air.getEnthalpy();
+
+    regime.states.push_back(state);
+
+    return;
+}
+
+/** Append the states along the stagnation line of a blunt body in
+ *  hypersonic flight: freestream, shock, equilibrium shock layer, and
+ *  a cooled boundary layer at the wall.
+ *
+ *  @pre none.
+ *  @post count states are appended to regime.
+ *  @param regime The destination regime.
+ *  @param count The number of states along the profile.
+ *  @param T_inf The freestream temperature in K.
+ *  @param p_inf The freestream pressure in atm.
+ *  @param velocity The flight velocity in m/s.
+ *  @return none.
+*/
+static void addStagnationProfile (BenchRegime &regime, uint32 count,
+                                  double T_inf, double p_inf,
+                                  double velocity)
+{
+    // Stagnation conditions behind a strong normal shock:
+    //    p0 ~ rho_inf V^2 and h0 = h_inf + V^2 / 2, with the
+    //    equilibrium temperature from the P-H lookup.
+    //    287.05 = gas constant of air [J/kg-K]
+    double rho_inf = p_inf * 101325.0 / (287.05 * T_inf),
+           p0 = std::min(rho_inf * velocity * velocity / 101325.0, 100.0),
+           h0 = (1.005 * T_inf) + (velocity * velocity / 2000.0);
+
+    Air stagnation;
+    stagnation.calculateProps_PH(p0 * 0.101325, h0);
+
+    double T0 = std::min(stagnation.getTemperature(), 30000.0),
+           T_wall = 1200.0;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        double s = (count > 1) ? double(i) / double(count - 1) : 0.0;
+
+        // Shock jump centred at s = 0.15, boundary layer near s = 0.92.
+        double shock = 0.5 * (1.0 + tanh((s - 0.15) / 0.01)),
+               wall = 0.5 * (1.0 + tanh((s - 0.92) / 0.03));
+
+        double pressure = exp(log(p_inf) + shock * (log(p0) - log(p_inf))),
+               temperature = T_inf + shock * (T0 - T_inf);
+
+        temperature += wall * (T_wall - temperature);
+
+        addState(regime, std::max(pressure, 1E-4), temperature);
+    }
+
+    return;
+}
+
+/** Build the standard benchmark regimes.
+ *
+ *  @pre none.
+ *  @post regimes holds the low temperature, per pressure decade,
+ *        breakpoint, random mixed, and hypersonic profile regimes.
+ *  @param regimes The destination vector.
+ *  @param count The number of states in each regime.
+ *  @param seed The seed of the pseudo-random generator.
+ *  @return none.
+*/
+void benchRegimes (std::vector<BenchRegime> &regimes, uint32 count,
+                   uint64 seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    regimes.clear();
+
+    // Temperatures at or below 500 K use the simple relations.
+    {
+        BenchRegime regime;
+        regime.name = "low_temperature";
+        regime.description = "T <= 500 K, all pressures";
+
+        for (uint32 i = 0; i < count; ++i)
+            addState(regime, pow(10.0, -4.0 + 6.0 * unit(rng)),
+                     50.0 + 450.0 * unit(rng));
+
+        regimes.push_back(regime);
+    }
+
+    // One regime per pressure order-of-magnitude (curve fit region).
+    for (int decade = -4; decade <= 1; ++decade)
+    {
+        BenchRegime regime;
+        char name[32];
+
+        snprintf(name, sizeof(name), "decade_1e%+d", decade);
+        regime.name = name;
+        regime.description = "500 < T <= 30000 K, one pressure decade";
+
+        for (uint32 i = 0; i < count; ++i)
+            addState(regime, pow(10.0, decade + unit(rng)),
+                     500.0 + 29500.0 * unit(rng));
+
+        regimes.push_back(regime);
+    }
+
+    // Within 1 K of a curve fit breakpoint, on either side.
+    {
+        std::vector<double> breakpoints;
+        benchBreakpoints(breakpoints);
+
+        BenchRegime regime;
+        regime.name = "breakpoints";
+        regime.description = "within 1 K of a curve fit breakpoint";
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            double T = breakpoints[i % breakpoints.size()];
+            addState(regime, pow(10.0, -4.0 + 6.0 * unit(rng)),
+                     T + 2.0 * unit(rng) - 1.0);
+        }
+
+        regimes.push_back(regime);
+    }
+
+    // Uniform over the whole ADT range.
+    {
+        BenchRegime regime;
+        regime.name = "random_mixed";
+        regime.description = "log-uniform P, uniform 0 <= T <= 30000 K";
+
+        for (uint32 i = 0; i < count; ++i)
+            addState(regime, pow(10.0, -4.0 + 6.0 * unit(rng)),
+                     30000.0 * unit(rng));
+
+        regimes.push_back(regime);
+    }
+
+    // Stagnation-line profiles of three flight conditions:
+    //    30 km at 3 km/s, 50 km at 5 km/s, and 65 km at 7 km/s.
+    {
+        BenchRegime regime;
+        regime.name = "hypersonic_profile";
+        regime.description = "synthetic stagnation-line flowfields";
+
+        uint32 third = count / 3;
+
+        addStagnationProfile(regime, third, 226.5, 1.185E-2, 3000.0);
+        addStagnationProfile(regime, third, 270.7, 7.87E-4, 5000.0);
+        addStagnationProfile(regime, count - 2 * third,
+                             233.3, 1.08E-4, 7000.0);
+
+        regimes.push_back(regime);
+    }
+
+    return;
+}
+
+/******************************************************
+**                  Timing / Output                  **
+******************************************************/
+
+/** Read a monotonic clock.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The time in seconds since an arbitrary epoch.
+*/
+double benchSeconds (void)
+{
+    using namespace std::chrono;
+
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+/** Time a kernel over a set of states.  One untimed warm-up pass is
+ *  followed by timed passes until minTime has elapsed (at least
+ *  minPasses passes).
+ *
+ *  @pre states is not empty.
+ *  @post none.
+ *  @param kernel The kernel to be timed.
+ *  @param states The input states.
+ *  @param minTime The minimum total time of the timed passes [s].
+ *  @param minPasses The minimum number of timed passes.
+ *  @return The timing summary.
+*/
+BenchResult benchMeasure (BenchKernel kernel,
+                          const std::vector<BenchState> &states,
+                          double minTime, uint32 minPasses)
+{
+    // Opened once per thread; the events stay open between cases.
+    static thread_local BenchCounters counters;
+
+    BenchResult result;
+    std::vector<double> samples;
+
+    result.checksum = kernel(states);  // Warm-up pass
+
+    double total = 0.0;
+
+    counters.start();
+
+    while ((total < minTime) || (samples.size() < minPasses))
+    {
+        double start = benchSeconds();
+        result.checksum += kernel(states);
+        double elapsed = benchSeconds() - start;
+
+        total += elapsed;
+        samples.push_back(elapsed * 1E9 / double(states.size()));
+    }
+
+    counters.stop();
+
+    double evaluated = double(samples.size()) * double(states.size());
+
+    for (uint32 e = 0; e < BenchCounters::NUM_EVENTS; ++e)
+    {
+        result.counted[e] = counters.available(e);
+        result.counters[e] = result.counted[e]
+                           ? counters.value(e) / evaluated : 0.0;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        sum += samples[i];
+
+    result.passes = uint32(samples.size());
+    result.nsMin = samples.front();
+    result.nsMedian = samples[samples.size() / 2];
+    result.nsMean = sum / double(samples.size());
+
+    return result;
+}
+
+/** Quote and escape a string for JSON output.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param text The text to be quoted.
+ *  @return The JSON string literal.
+*/
+std::string benchJsonString (const std::string &text)
+{
+    std::string quoted = "\"";
+
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        char c = text[i];
+
+        if ((c == '"') || (c == '\\'))
+        {
+            quoted += '\\';
+            quoted += c;
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", (unsigned int)c);
+            quoted += escape;
+        }
+        else
+            quoted += c;
+    }
+
+    quoted += '"';
+
+    return quoted;
+}
+
+/** Write the members common to every benchmark report (benchmark
+ *  name, compiler, build flags) without the enclosing braces.
+ *
+ *  @pre out is open for writing.
+ *  @post The members are written, each followed by a comma.
+ *  @param out The output stream.
+ *  @param benchmark The name of the benchmark executable.
+ *  @return none.
+*/
+void benchJsonHeader (FILE *out, const char *benchmark)
+{
+#if defined(__VERSION__)
+    const char *compiler = __VERSION__;
+#else
+    const char *compiler = "unknown";
+#endif
+
+#if defined(NDEBUG)
+    const char *assertions = "off";
+#else
+    const char *assertions = "on";
+#endif
+
+    fprintf(out, "  \"benchmark\": %s,\n", benchJsonString(benchmark).c_str());
+    fprintf(out, "  \"compiler\": %s,\n", benchJsonString(compiler).c_str());
+    fprintf(out, "  \"assertions\": \"%s\",\n", assertions);
+
+    return;
+}
+
+/** Write the hardware counts of a benchmark case as the "counters"
+ *  member, without a trailing comma.  Each count is per evaluated
+ *  state; "ipc" is instructions per cycle.  Counts that could not be
+ *  measured are null.
+ *
+ *  @pre out is open for writing.
+ *  @post The member is written.
+ *  @param out The output stream.
+ *  @param result The measured benchmark case.
+ *  @return none.
+*/
+void benchJsonCounters (FILE *out, const BenchResult &result)
+{
+    fprintf(out, "\"counters\": {");
+
+    for (uint32 e = 0; e < BenchCounters::NUM_EVENTS; ++e)
+    {
+        fprintf(out, "\"%s\": ", BenchCounters::name(e));
+
+        if (result.counted[e])
+            fprintf(out, "%.4f, ", result.counters[e]);
+        else
+            fprintf(out, "null, ");
+    }
+
+    const uint32 cycles = BenchCounters::CYCLES,
+                 instructions = BenchCounters::INSTRUCTIONS;
+
+    if (result.counted[cycles] && result.counted[instructions]
+        && (result.counters[cycles] > 0.0))
+        fprintf(out, "\"ipc\": %.4f}",
+                result.counters[instructions] / result.counters[cycles]);
+    else
+        fprintf(out, "\"ipc\": null}");
+
+    return;
+}
+
+/** Write the availability of the hardware counters as the
+ *  "counters_available" member (and "counters_error" when an event
+ *  could not be opened), each followed by a comma.
+ *
+ *  @pre out is open for writing.
+ *  @post The members are written.
+ *  @param out The output stream.
+ *  @return none.
+*/
+void benchJsonCountersInfo (FILE *out)
+{
+    BenchCounters counters;
+
+    fprintf(out, "  \"counters_available\": [");
+
+    const char *separator = "";
+
+    for (uint32 e = 0; e < BenchCounters::NUM_EVENTS; ++e)
+    {
+        if (counters.available(e))
+        {
+            fprintf(out, "%s\"%s\"", separator, BenchCounters::name(e));
+            separator = ", ";
+        }
+    }
+
+    fprintf(out, "],\n");
+
+    if (counters.getError()[0])
+        fprintf(out, "  \"counters_error\": %s,\n",
+                benchJsonString(counters.getError()).c_str());
+
+    return;
+}
+
+/** Write the hot path statistics of the library (see AirStats) as the
+ *  "stats" member, without a trailing comma.  The member is null when
+ *  the library was built without AIR_ENABLE_STATS.
+ *
+ *  @pre out is open for writing.
+ *  @post The member is written.
+ *  @param out The output stream.
+ *  @return none.
+*/
+void benchJsonStats (FILE *out)
+{
+    if (!AirStats::enabled())
+    {
+        fprintf(out, "  \"stats\": null");
+        return;
+    }
+
+    AirStatsSnapshot stats;
+    AirStats::snapshot(stats);
+
+    fprintf(out, "  \"stats\": {\n    \"threads\": %u,\n", stats.threads);
+
+    for (uint32 i = 0; i < AirStats::NUM_COUNTERS; ++i)
+        fprintf(out, "    \"%s\": %llu,\n", AirStats::counterName(i),
+                stats.counters[i]);
+
+    fprintf(out, "    \"pressure_groups\": [");
+    for (uint32 i = 0; i < AirStats::NUM_DECADES; ++i)
+        fprintf(out, "%s%llu", i ? ", " : "", stats.decades[i]);
+
+    fprintf(out, "],\n    \"ph_iterations\": [");
+    for (uint32 i = 0; i < AirStats::PH_BINS; ++i)
+        fprintf(out, "%s%llu", i ? ", " : "", stats.phIterations[i]);
+
+    fprintf(out, "],\n    \"rows\": {");
+    for (uint32 t = 0; t < AirStats::NUM_TABLES; ++t)
+    {
+        fprintf(out, "%s\n      \"%s\": [", t ? "," : "",
+                AirStats::tableName(t));
+
+        for (uint32 r = 0; r < AirStats::MAX_ROWS; ++r)
+            fprintf(out, "%s%llu", r ? ", " : "", stats.rows[t][r]);
+
+        fprintf(out, "]");
+    }
+
+    fprintf(out, "\n    }\n  }");
+
+    return;
+}
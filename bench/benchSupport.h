@@ -0,0 +1,213 @@
+/******************************************************************************
+||  benchSupport.h      (definition file)                                    ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Shared support for the benchmark executables of the equilibrium air    ||
+||    ADT: the standard input regimes (low temperature, each pressure        ||
+||    decade, curve fit breakpoints, random mixed states, and synthetic      ||
+||    hypersonic flowfield profiles), a pass-based timer, and helpers for    ||
+||    the JSON reports.                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    benchSupport.cpp                                                       ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file benchSupport.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_BENCH_SUPPORT_H
+#define _GH_DEF_BENCH_SUPPORT_H
+
+#include "air.h"
+#include "benchCounters.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ *  @struct BenchState One benchmark input state.
+*/
+struct BenchState
+{
+    double pressure,     // Air pressure [units: MPa]
+           temperature,  // Air temperature [units: K]
+           enthalpy;     // Air enthalpy at (pressure, temperature) [kJ/kg]
+};
+
+/**
+ *  @struct BenchRegime A named set of input states that exercises one
+ *          part of the property surface.
+*/
+struct BenchRegime
+{
+    std::string name;                // Short identifier used in the output
+    std::string description;         // One line description of the inputs
+    std::vector<BenchState> states;  // The input states
+};
+
+/**
+ *  @struct BenchResult The timing summary of one benchmark case.
+*/
+struct BenchResult
+{
+    uint32 passes;        // Number of timed passes over the inputs
+    double nsMin,         // Fastest pass [units: ns/state]
+           nsMedian,      // Median pass [units: ns/state]
+           nsMean,        // Mean of all passes [units: ns/state]
+           checksum;      // Sum of the kernel results (defeats DCE)
+
+    // Hardware counts over the timed passes [units: per state]; only
+    // meaningful where counted[event] is true (see BenchCounters).
+    double counters[BenchCounters::NUM_EVENTS];
+    bool counted[BenchCounters::NUM_EVENTS];
+};
+
+// calculateProps_PH starts its search at T = h / 1.005; above this
+// enthalpy the first guess leaves the curve fit range and the
+// extrapolated fits overflow, so the P-H benchmarks skip those states.
+static const double BENCH_PH_MAX_ENTHALPY = 1.005 * 30000.0;  // [kJ/kg]
+
+/** A benchmark kernel evaluates every state once and returns a checksum
+ *  of the results so that the work cannot be optimized away.  */
+typedef double (*BenchKernel)(const std::vector<BenchState> &states);
+
+/** Collect the curve fit temperature breakpoints of every table.
+ *
+ *  @pre none.
+ *  @post breakpoints holds the sorted, unique breakpoints above 500 K.
+ *  @param breakpoints The destination vector [units: K].
+ *  @return none.
+*/
+void benchBreakpoints (std::vector<double> &breakpoints);
+
+/** Build the standard benchmark regimes.
+ *
+ *  @pre none.
+ *  @post regimes holds the low temperature, per pressure decade,
+ *        breakpoint, random mixed, and hypersonic profile regimes.
+ *  @param regimes The destination vector.
+ *  @param count The number of states in each regime.
+ *  @param seed The seed of the pseudo-random generator.
+ *  @return none.
+*/
+void benchRegimes (std::vector<BenchRegime> &regimes, uint32 count,
+                   uint64 seed);
+
+/** Read a monotonic clock.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The time in seconds since an arbitrary epoch.
+*/
+double benchSeconds (void);
+
+/** Time a kernel over a set of states.  One untimed warm-up pass is
+ *  followed by timed passes until minTime has elapsed (at least
+ *  minPasses passes).  The hardware counters of the calling thread
+ *  are read around the timed passes when they are available.
+ *
+ *  @pre states is not empty.
+ *  @post none.
+ *  @param kernel The kernel to be timed.
+ *  @param states The input states.
+ *  @param minTime The minimum total time of the timed passes [s].
+ *  @param minPasses The minimum number of timed passes.
+ *  @return The timing summary.
+*/
+BenchResult benchMeasure (BenchKernel kernel,
+                          const std::vector<BenchState> &states,
+                          double minTime, uint32 minPasses = 3);
+
+/** Quote and escape a string for JSON output.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param text The text to be quoted.
+ *  @return The JSON string literal.
+*/
+std::string benchJsonString (const std::string &text);
+
+/** Write the members common to every benchmark report (benchmark
+ *  name, compiler, build flags) without the enclosing braces.
+ *
+ *  @pre out is open for writing.
+ *  @post The members are written, each followed by a comma.
+ *  @param out The output stream.
+ *  @param benchmark The name of the benchmark executable.
+ *  @return none.
+*/
+void benchJsonHeader (FILE *out, const char *benchmark);
+
+/** Write the hardware counts of a benchmark case as the "counters"
+ *  member, without a trailing comma.  Each count is per evaluated
+ *  state; "ipc" is instructions per cycle.  Counts that could not be
+ *  measured are null.
+ *
+ *  @pre out is open for writing.
+ *  @post The member is written.
+ *  @param out The output stream.
+ *  @param result The measured benchmark case.
+ *  @return none.
+*/
+void benchJsonCounters (FILE *out, const BenchResult &result);
+
+/** Write the availability of the hardware counters as the
+ *  "counters_available" member (and "counters_error" when an event
+ *  could not be opened), each followed by a comma.
+ *
+ *  @pre out is open for writing.
+ *  @post The members are written.
+ *  @param out The output stream.
+ *  @return none.
+*/
+void benchJsonCountersInfo (FILE *out);
+
+/** Write the hot path statistics of the library (see AirStats) as the
+ *  "stats" member, without a trailing comma.  The member is null when
+ *  the library was built without AIR_ENABLE_STATS.
+ *
+ *  @pre out is open for writing.
+ *  @post The member is written.
+ *  @param out The output stream.
+ *  @return none.
+*/
+void benchJsonStats (FILE *out);
+
+#endif
@@ -20,6 +20,7 @@
 ||===========================================================================||
 ||    airCoefficients.h                                                      ||
 ||    air.h                                                                  ||
+||    airEvaluator.h                                                         ||
 ||                                                                           ||
 ||===========================================================================||
 ||  REFERENCES                                                               ||
@@ -74,10 +75,62 @@
 
 #include "air.h"
 #include "airCoefficients.h"
+#include "airEvaluator.h"
+#include "airProbes.h"
+#include "airProfile.h"
+#include "airStats.h"
+#include "airTrace.h"
+
+#include <cstddef>
 
 // Define the universal gas constant:
 //    8.314462175 kJ/kgmol-K
-const double Air::_R_univ = 8.314462175;
+const double Air::_R_univ = AirCoefficients::rUniv;
+
+// Storage for the constexpr coefficient tables, and the names
+// under which Air uses them.
+constexpr double AirCoefficients::rUniv;
+constexpr double AirCoefficients::hCoeffs[32][5];
+constexpr double AirCoefficients::cpCoeffs[52][5];
+constexpr double AirCoefficients::kCoeffs[42][5];
+constexpr double AirCoefficients::muCoeffs[24][6];
+constexpr double AirCoefficients::zCoeffs[32][5];
+constexpr uint32 AirCoefficients::hDecadeRows[8];
+constexpr uint32 AirCoefficients::cpDecadeRows[8];
+constexpr uint32 AirCoefficients::kDecadeRows[8];
+constexpr uint32 AirCoefficients::muDecadeRows[8];
+constexpr uint32 AirCoefficients::zDecadeRows[8];
+constexpr double AirCoefficients::hTmin[32];
+constexpr double AirCoefficients::cpTmin[52];
+constexpr double AirCoefficients::kTmin[42];
+constexpr double AirCoefficients::muTmin[24];
+constexpr double AirCoefficients::zTmin[32];
+
+const double (&Air::_h_coeffs)[32][5] = AirCoefficients::hCoeffs;
+const double (&Air::_cp_coeffs)[52][5] = AirCoefficients::cpCoeffs;
+const double (&Air::_k_coeffs)[42][5] = AirCoefficients::kCoeffs;
+const double (&Air::_mu_coeffs)[24][6] = AirCoefficients::muCoeffs;
+const double (&Air::_z_coeffs)[32][5] = AirCoefficients::zCoeffs;
+const uint32 (&Air::_h_decadeRows)[8] = AirCoefficients::hDecadeRows;
+const uint32 (&Air::_cp_decadeRows)[8] = AirCoefficients::cpDecadeRows;
+const uint32 (&Air::_k_decadeRows)[8] = AirCoefficients::kDecadeRows;
+const uint32 (&Air::_mu_decadeRows)[8] = AirCoefficients::muDecadeRows;
+const uint32 (&Air::_z_decadeRows)[8] = AirCoefficients::zDecadeRows;
+const double (&Air::_h_Tmin)[32] = AirCoefficients::hTmin;
+const double (&Air::_cp_Tmin)[52] = AirCoefficients::cpTmin;
+const double (&Air::_k_Tmin)[42] = AirCoefficients::kTmin;
+const double (&Air::_mu_Tmin)[24] = AirCoefficients::muTmin;
+const double (&Air::_z_Tmin)[32] = AirCoefficients::zTmin;
+
+#ifdef AIR_ENABLE_PROBES
+// The semaphores of the USDT probes (see airProbes.h).
+AIR_PROBE_SEMAPHORE(properties__entry) = 0;
+AIR_PROBE_SEMAPHORE(properties__return) = 0;
+AIR_PROBE_SEMAPHORE(range__reject) = 0;
+AIR_PROBE_SEMAPHORE(props_ph__entry) = 0;
+AIR_PROBE_SEMAPHORE(props_ph__iteration) = 0;
+AIR_PROBE_SEMAPHORE(props_ph__return) = 0;
+#endif
 
 /******************************************************
 **           Constructors / Destructors              **
@@ -85,12 +138,11 @@ const double Air::_R_univ = 8.314462175;
 
 /** Default constructor.  */
 Air::Air()
-  : _temperature(0.0), _pressure(0.0), _enthalpy(0.0), _intEnergy(0.0),
-    _density(0.0), _cp(0.0), _gamma(0.0), _k(0.0), _pr(0.0), _mu(0.0),
-    _nu(0.0), _comp(0.0), _gasConstant(0.0), _molarMass(0.0),
-    _entropy(0.0), _soundSpeed(0.0), _refraction(0.0),
-    _gibbsEnergy(0.0), _helmholtzEn(0.0), _chemPoten(0.0),
-    _schmidt(0.0), _lewis(0.0), _thermalDiff(0.0)
+  : _temperature(0.0), _pressure(0.0), _enthalpy(0.0), _density(0.0), _cp(0.0),
+    _gamma(0.0), _mu(0.0), _k(0.0), _comp(0.0), _gasConstant(0.0),
+    _molarMass(0.0), _intEnergy(0.0), _pr(0.0), _nu(0.0), _thermalDiff(0.0),
+    _entropy(0.0), _soundSpeed(0.0), _refraction(0.0), _gibbsEnergy(0.0),
+    _helmholtzEn(0.0), _chemPoten(0.0), _schmidt(0.0), _lewis(0.0)
 {}
 
 /** Copy constructor.
@@ -102,16 +154,16 @@ Air::Air()
 */
 Air::Air (const Air &copyFrom)
   : _temperature(copyFrom._temperature), _pressure(copyFrom._pressure),
-    _enthalpy(copyFrom._enthalpy), _intEnergy(copyFrom._intEnergy),
-    _density(copyFrom._density), _cp(copyFrom._cp),
-    _gamma(copyFrom._gamma), _k(copyFrom._k), _pr(copyFrom._pr),
-    _mu(copyFrom._mu), _nu(copyFrom._nu),
-    _comp(copyFrom._comp), _gasConstant(copyFrom._gasConstant),
-    _molarMass(copyFrom._molarMass), _entropy(copyFrom._entropy),
+    _enthalpy(copyFrom._enthalpy), _density(copyFrom._density),
+    _cp(copyFrom._cp), _gamma(copyFrom._gamma), _mu(copyFrom._mu),
+    _k(copyFrom._k), _comp(copyFrom._comp),
+    _gasConstant(copyFrom._gasConstant), _molarMass(copyFrom._molarMass),
+    _intEnergy(copyFrom._intEnergy), _pr(copyFrom._pr), _nu(copyFrom._nu),
+    _thermalDiff(copyFrom._thermalDiff), _entropy(copyFrom._entropy),
     _soundSpeed(copyFrom._soundSpeed), _refraction(copyFrom._refraction),
     _gibbsEnergy(copyFrom._gibbsEnergy), _helmholtzEn(copyFrom._helmholtzEn),
     _chemPoten(copyFrom._chemPoten), _schmidt(copyFrom._schmidt),
-    _lewis(copyFrom._lewis), _thermalDiff(copyFrom._thermalDiff)
+    _lewis(copyFrom._lewis)
 {}
 
 /** Initialization constructor.
@@ -129,6 +181,46 @@ Air::Air (double pressure, double temperature)
 /** Default destructor.  */
 Air::~Air() {}
 
+/******************************************************
+**                    Operators                      **
+******************************************************/
+
+/** Assignment operator.
+ *
+ *  @pre none.
+ *  @post The values of assignFrom are copied into this object.
+ *  @param assignFrom An Air object whose values are to be copied.
+ *  @return A reference to this object.
+*/
+Air & Air::operator= (const Air &assignFrom)
+{
+    _temperature = assignFrom._temperature;
+    _pressure    = assignFrom._pressure;
+    _enthalpy    = assignFrom._enthalpy;
+    _density     = assignFrom._density;
+    _cp          = assignFrom._cp;
+    _gamma       = assignFrom._gamma;
+    _mu          = assignFrom._mu;
+    _k           = assignFrom._k;
+    _comp        = assignFrom._comp;
+    _gasConstant = assignFrom._gasConstant;
+    _molarMass   = assignFrom._molarMass;
+    _intEnergy   = assignFrom._intEnergy;
+    _pr          = assignFrom._pr;
+    _nu          = assignFrom._nu;
+    _thermalDiff = assignFrom._thermalDiff;
+    _entropy     = assignFrom._entropy;
+    _soundSpeed  = assignFrom._soundSpeed;
+    _refraction  = assignFrom._refraction;
+    _gibbsEnergy = assignFrom._gibbsEnergy;
+    _helmholtzEn = assignFrom._helmholtzEn;
+    _chemPoten   = assignFrom._chemPoten;
+    _schmidt     = assignFrom._schmidt;
+    _lewis       = assignFrom._lewis;
+
+    return *this;
+}
+
 /******************************************************
 **               Accessors / Mutators                **
 ******************************************************/
@@ -345,6 +437,35 @@ double Air::getLewisNumber (void) const
 double Air::getThermalDiffusivity (void) const
 {  return _thermalDiff;  }
 
+/** Retrieve the hot properties of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return An AirState holding _temperature, _pressure, _enthalpy,
+ *          _density, _cp, _gamma, _mu, and _k.
+*/
+AirState Air::getState (void) const
+{
+    // The hot members must stay in the first 64 bytes.
+    static_assert(sizeof(AirState) == 64, "AirState is one cache line");
+    static_assert(alignof(AirState) == 64, "AirState is line aligned");
+    static_assert(offsetof(Air, _k) + sizeof(double) <= 64,
+                  "The hot members of Air exceed the first cache line");
+
+    AirState state;
+
+    state.temperature  = _temperature;
+    state.pressure     = _pressure;
+    state.enthalpy     = _enthalpy;
+    state.density      = _density;
+    state.specificHeat = _cp;
+    state.gamma        = _gamma;
+    state.viscosity    = _mu;
+    state.thermalCond  = _k;
+
+    return state;
+}
+
 ////////////////////
 //    Setters
 ////////////////////
@@ -360,17 +481,18 @@ void Air::reset (void)
     _temperature = 0.0;  // Air temperature [units: K]
     _pressure    = 0.0;  // Air pressure [units: MPa]
     _enthalpy    = 0.0;  // Air enthalpy [units: kJ/kg]
-    _intEnergy   = 0.0;  // Specific internal energy [units: kJ/kg]
     _density     = 0.0;  // Air density [units: kg/m^3]
     _cp          = 0.0;  // Specific heat [units: kJ/kg-K]
     _gamma       = 0.0;  // Ratio of specific heats [-dimensionless-]
-    _k           = 0.0;  // Thermal conductivity [units: W/m-K]
-    _pr          = 0.0;  // Prandtl number [-dimensionless-]
     _mu          = 0.0;  // Dynamic viscosity [g/cm-s]
-    _nu          = 0.0;  // Kinematic viscosity [m^2/s]
+    _k           = 0.0;  // Thermal conductivity [units: W/m-K]
     _comp        = 0.0;  // Compressibility factor [-dimensionless-]
     _gasConstant = 0.0;  // Specific gas constant [units: kJ/kg-K]
     _molarMass   = 0.0;  // The substance molar mass [units: kg/kgmol]
+    _intEnergy   = 0.0;  // Specific internal energy [units: kJ/kg]
+    _pr          = 0.0;  // Prandtl number [-dimensionless-]
+    _nu          = 0.0;  // Kinematic viscosity [m^2/s]
+    _thermalDiff = 0.0;  // Thermal diffusivity (alpha) [units: m^2/s]
     _entropy     = 0.0;  // Air specific entropy [units: kJ/kg-K]
     _soundSpeed  = 0.0;  // The speed of sound of air [units: m/s]
     _refraction  = 0.0;  // The index of refraction of air [-dimensionless-]
@@ -379,7 +501,6 @@ void Air::reset (void)
     _chemPoten   = 0.0;  // The chemical potential of air [units: kJ/kgmol]
     _schmidt     = 0.0;  // The Schmidt number (Sc) [-dimensionless-]
     _lewis       = 0.0;  // The Lewis number (Le) [-dimensionless-]
-    _thermalDiff = 0.0;  // Thermal diffusivity (alpha) [units: m^2/s]
 
     return;
 }
@@ -396,6 +517,10 @@ void Air::reset (void)
 */
 bool Air::calculateProperties (double pressure, double temperature)
 {
+    AIR_STATS_COUNT(CALLS_PROPERTIES);
+    AIR_PROBE_PROPERTIES_ENTRY(pressure, temperature);
+    AIR_PROFILE_BEGIN(pressure, temperature);
+
     // Store the input temperature value [units: K]
     _temperature = temperature;
 
@@ -413,94 +538,43 @@ bool Air::calculateProperties (double pressure, double temperature)
         || (_temperature < 0.0) || (_temperature > 30000.0)
         )
     {
+        AIR_STATS_COUNT(REJECT_RANGE);
+        AIR_PROBE_RANGE_REJECT(pressure, temperature);
+        AIR_PROFILE_END();
+
         _pressure = _pressure * 0.101325;
+
+        AIR_TRACE_PT(pressure, temperature, *this, false);
+        AIR_PROBE_PROPERTIES_RETURN(pressure, temperature, false);
         return false;
     }
 
+    // Record the pressure group and the low temperature shortcut.
+    AIR_STATS_DECADE(_getDecade(_pressure));
+
+    if (temperature <= 500.0)
+        AIR_STATS_COUNT(LOW_TEMPERATURE);
+
     // Convert the pressure back to MPa from atm.
     //   0.101325 = conversion factor MPa -> atm
     _pressure = _pressure * 0.101325;
 
+    AIR_PROFILE_MARK(STAGE_CONVERSION);
+
     _enthalpy = _calculateEnthalpy(pressure, temperature);  // Units: kJ/kg
     _cp = _calculateSpecificHeat(pressure, temperature);    // Units: kJ/kg-K
     _k = _calculateThermalCond(pressure, temperature);      // Units: W/m-K
     _mu = _calculateViscosity(pressure, temperature);       // Units: kg/m-s
     _comp = _calculateCompFactor(pressure, temperature);    // -dimensionless-
 
-    ////////////////////////////////////
     // Calculate the remaining thermodynamic properties.
-    ////////////////////////////////////
-
-    // Store the molar mass of air [units: kg/kgmol]
-    _molarMass = 28.96755 / _comp;
-
-    // Store the air gas constant in SI units [Units: kJ/(kg-K)]
-    //    8.314 = Universal gas constant [units: kJ/kgmol-K]
-    _gasConstant = _R_univ / _molarMass;
-
-    // Calculate gamma based on the cp value [-dimensionless-]
-    _gamma = _cp / (_cp - _gasConstant);
-
-    // Calculate the density [Units: kg/m^3]
-    //    1000.0 = convert MPa -> kPa
-    _density = (_pressure * 1000.0) / (_comp * _gasConstant * _temperature);
-
-    // Calculate the internal energy based on the thermodynamic relation:
-    //    h = u + p/rho
-    //    [units: kJ/kg]
-    //    1000.0 = convert MPa -> kPa
-    _intEnergy = _enthalpy - (_pressure * 1000.0 / _density);
-
-    // Calculate the thermal diffusivity [units: m^2/s]
-    //    1000.0 = convert W -> kW
-    _thermalDiff = _k / (1000.0 * _density * _cp);
-
-    // Calculate the Prandtl number (the ratio of thermal and momentum
-    // diffusivities) [-dimensionless-]
-    //    1000.0 = convert kJ -> J. (So that J/s = W)
-    _pr = _mu * _cp * 1000.0 / _k;
-
-    // Calculate the kinematic viscosity [units: m^2/s]
-    _nu = _mu / _density;
-
-    // Calculate the entropy of the state [units: kJ/kg-K]
-    _entropy = _calculateEntropy();
-
-    // Calculate the speed of sound [units: m/s]
-    //    1000.0 = convert kJ -> J
-    _soundSpeed = sqrt(_gamma * _gasConstant * _temperature * 1000.0);
+    _calculateDerivedProperties();
 
-    // Calculate the refractive index [-dimensionless-]
-    _refraction = _calculateRefractionIndex();
-
-    // Calculate the specific Gibbs free energy (enthalpy) using the relation:
-    //    G = H - TS
-    //    [units: kJ/kg]
-    _gibbsEnergy = _enthalpy - (_temperature * _entropy);
-
-    // Calculate the specific Helmholtz free energy using the relation:
-    //    F = U - TS
-    //    [units: kJ/kg]
-    _helmholtzEn = _intEnergy - (_temperature * _entropy);
-
-    // Calculate the chemical potential of the state which is defined as
-    // the Gibbs function (total) divided by the molar amount of substance.
-    // (Which is also the specific Gibbs function multiplied by the molar
-    // mass of the substance).  [units: kJ/kgmol]
-    //
-    //    ch = G / n = gm / n = gM
-    _chemPoten = _gibbsEnergy * _molarMass;
-
-    // Calculate the Schmidt number assuming an air-O2 binary diffusion
-    // coefficient which is useful for calculating catalitic
-    // effects. [-dimensionless-]
-    //
-    //    0.24 x 10^-4 = binary diffusion coefficient of O2 in air at 298 K.
-    _schmidt = _nu / 0.21E-4;
-
-    // Calculate the Lewis number. [-dimensionless-]
-    _lewis = _schmidt / _pr;
+    AIR_PROFILE_MARK(STAGE_DERIVED);
+    AIR_PROFILE_END();
 
+    AIR_TRACE_PT(pressure, temperature, *this, true);
+    AIR_PROBE_PROPERTIES_RETURN(pressure, temperature, true);
     return true;
 }
 
@@ -516,6 +590,10 @@ bool Air::calculateProperties (double pressure, double temperature)
 */
 bool Air::calculateProps_PH (double pressure, double enthalpy)
 {
+    AIR_STATS_COUNT(CALLS_PROPS_PH);
+    AIR_TRACE_ENTER();
+    AIR_PROBE_PH_ENTRY(pressure, enthalpy);
+
     // Store the input pressure.  [units: MPa]
     _pressure = pressure;
 
@@ -533,12 +611,22 @@ bool Air::calculateProps_PH (double pressure, double enthalpy)
 
     bool converged = false;
 
+#if defined(AIR_ENABLE_STATS) || defined(AIR_ENABLE_PROBES)
+    uint32 iterations = 0;
+#endif
+
     while (!converged)
     {
+#if defined(AIR_ENABLE_STATS) || defined(AIR_ENABLE_PROBES)
+        ++iterations;
+#endif
+
         // Calculate the enthalpy based on the guessed temperature
         //    [units: kJ/kg]
         calcH = _calculateEnthalpy(pressure, temperature);
 
+        AIR_PROBE_PH_ITERATION(iterations, temperature, calcH, deltaT);
+
         // Assume convergence if the enthalpy difference is
         //    sufficiently small or if the temperature
         //    differential is also small (this alleviates
@@ -566,174 +654,236 @@ bool Air::calculateProps_PH (double pressure, double enthalpy)
         }
     }
 
-    return calculateProperties(pressure, temperature);
+    AIR_STATS_PH(iterations);
+
+    bool valid = calculateProperties(pressure, temperature);
+
+    AIR_TRACE_PH(pressure, enthalpy, *this, valid);
+    AIR_PROBE_PH_RETURN(pressure, enthalpy, temperature, valid);
+    return valid;
 }
 
 /******************************************************
-**                 Helper Methods                    **
+**                Curve Fit Rows                     **
 ******************************************************/
 
-/** Logarithmicaly interpolate the thermodynamic-property
- *  surface (phi, T) between pressure contours.
+/** Look up the curve fit rows of a state.
  *
- *  @pre The object is instantiated and p1 < _pressure < p2.
- *  @post none.
- *  @param p1 The smaller pressure order-of-magnitude.
- *  @param p2 The larger pressure order-of-magnitude.
- *  @param phi_1 The thermodynamic property at p1.
- *  @param phi_2 The thermodynamic property at p2.
- *  @return The interpolated thermodynamic property.
+ *  @pre The object is instantiated.
+ *  @post rows holds the rows of the state when it uses the curve
+ *        fits; otherwise it is unchanged.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param rows The destination.
+ *  @return true The state is in range and above 500 K.
+ *  @return false The state is out of range or at or below 500 K,
+ *          where the simple relations do not use the curve fits.
 */
-double Air::_interpolate (double p1, double p2,
-                          double phi_1, double phi_2) const
+bool Air::getRows (double pressure, double temperature, Rows &rows) const
 {
-    double propValue,
-           p = _pressure / 0.101325;
+    //   0.101325 = conversion factor MPa -> atm
+    double p = pressure / 0.101325;
 
-    propValue = (((log10(phi_2) - log10(phi_1)) / (log10(p2) - log10(p1)))
-                           * (log10(p) - log10(p1))) + log10(phi_1);
+    if (   (p < 1E-4) || (p > 100.0)
+        || (temperature <= 500.0) || (temperature > 30000.0)
+        )
+        return false;
 
-    propValue = pow(10.0, propValue);
+    _getPressureOM(p, rows.pLower, rows.pUpper);
+
+    rows.log10pLower = log10(rows.pLower);
+    rows.log10pSpan = log10(rows.pUpper) - rows.log10pLower;
+
+    rows.h[0] = _get_h_row(rows.pLower, temperature);
+    rows.h[1] = _get_h_row(rows.pUpper, temperature);
+    rows.cp[0] = _get_cp_row(rows.pLower, temperature);
+    rows.cp[1] = _get_cp_row(rows.pUpper, temperature);
+    rows.k[0] = _get_k_row(rows.pLower, temperature);
+    rows.k[1] = _get_k_row(rows.pUpper, temperature);
+    rows.mu[0] = _get_mu_row(rows.pLower, temperature);
+    rows.mu[1] = _get_mu_row(rows.pUpper, temperature);
+    rows.z[0] = _get_z_row(rows.pLower, temperature);
+    rows.z[1] = _get_z_row(rows.pUpper, temperature);
+
+    // The box is the intersection of the temperature bands of the ten
+    // rows.  The last row of a group applies through 30000 K, which
+    // the range check enforces, so it does not narrow the box.
+    const uint32 *decadeRows[5] = { _h_decadeRows, _cp_decadeRows,
+                                    _k_decadeRows, _mu_decadeRows,
+                                    _z_decadeRows };
+    const double *Tmin[5] = { _h_Tmin, _cp_Tmin, _k_Tmin, _mu_Tmin,
+                              _z_Tmin };
+    const uint32 *index[5] = { rows.h, rows.cp, rows.k, rows.mu, rows.z };
+
+    rows.tLower = 500.0;
+    rows.tUpper = HUGE_VAL;
+
+    for (uint32 t = 0; t < 5; ++t)
+    {
+        for (uint32 j = 0; j < 2; ++j)
+        {
+            double tLower, tUpper;
 
-    return propValue;
+            _getRowBand(decadeRows[t], Tmin[t],
+                        (j == 0) ? rows.pLower : rows.pUpper,
+                        index[t][j], tLower, tUpper);
+
+            if (tLower > rows.tLower)
+                rows.tLower = tLower;
+
+            if ((tUpper < 30000.0) && (tUpper < rows.tUpper))
+                rows.tUpper = tUpper;
+        }
+    }
+
+    return true;
 }
 
-/** Determine the index of the enthalpy coefficient array
- *  based on the pressure and temperature.
+/** Determine whether a state is evaluated with the given rows.
  *
- *  @pre The object is instantiated and
- *       10E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @pre rows was filled by getRows.
  *  @post none.
- *  @param pressure The order-of-magnitude of the pressure of interest.
- *  @param temperature The temperature of the state in K.
- *  @return An index into the _h_coeffs array.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param rows The rows of a previous state.
+ *  @return true calculateProperties would use exactly these rows.
+ *  @return false The state needs other rows or no rows.
 */
-uint32 Air::_get_h_row (double pressure, double temperature) const
+bool Air::hasRows (double pressure, double temperature,
+                   const Rows &rows) const
 {
-    uint32 temperatureOffset,
-           pressureOffset,
-           hOffset;
+    if ((temperature < rows.tLower) || (temperature >= rows.tUpper))
+        return false;
 
-    // The initial index begins with 0
-    if ((pressure / 1E-4) < 10.0)
-        pressureOffset = 0;
+    //   0.101325 = conversion factor MPa -> atm
+    double p = pressure / 0.101325;
 
-    // There are 6 entries in the 10^-4 regime,
-    //    so we begin the 10^-3 index shifted by 6
-    else if ((pressure / 1E-3) < 10.0)
-        pressureOffset = 6;
+    if (   (p < 1E-4) || (p > 100.0)
+        || (temperature <= 500.0) || (temperature > 30000.0)
+        )
+        return false;
 
-    // There are 6 entries in the 10^-3 regime,
-    //    so we begin the 10^-2 index shifted by 12
-    else if ((pressure / 1E-2) < 10.0)
-        pressureOffset = 12;
+    // The contours are selected exactly as calculateProperties
+    // selects them, so a state on a contour takes the same pair.
+    double pLower, pUpper;
+    _getPressureOM(p, pLower, pUpper);
 
-    // There are 5 entries in the 10^-2 regime,
-    //    so we begin the 10^-1 index shifted by 17
-    else if ((pressure / 1E-1) < 10.0)
-        pressureOffset = 17;
+    return (pLower == rows.pLower);
+}
 
-    // There are 4 entries in the 10^-1 regime,
-    //    so we begin the 10^0 index shifted by 21
-    else if ((pressure / 1E0) < 10.0)
-        pressureOffset = 21;
+/** Calculate the properties of air at the given pressure and
+ *  temperature with rows that were looked up before.  The results
+ *  are identical to calculateProperties(pressure, temperature).
+ *
+ *  @pre hasRows(pressure, temperature, rows).
+ *  @post The properties are calculated with values
+ *        stored in the appropriate variables.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param rows The rows of the state.
+ *  @return none.
+*/
+void Air::calculateProperties (double pressure, double temperature,
+                               const Rows &rows)
+{
+    // The same conversions as calculateProperties, in the same order,
+    // so every intermediate value is the same.
+    //   0.101325 = conversion factor MPa -> atm
+    _temperature = temperature;
+    _pressure = (pressure / 0.101325) * 0.101325;
 
-    // There are 4 entries in the 10^0 regime,
-    //    so we begin the 10^1 index shifted by 25
-    else if ((pressure / 1E1) < 10.0)
-        pressureOffset = 25;
+    double x = log(temperature / 10000.0),
+           y = _temperature / 1000.0,
+           offset = log10(_pressure / 0.101325) - rows.log10pLower;
 
-    // There are 4 entries in the 10^1 regime,
-    //    so we begin the 10^2 index shifted by 29
-    else
-        pressureOffset = 29;
+    _enthalpy = _fitEnthalpy(rows.h, x, rows.log10pSpan, offset);
+    _cp = _fitSpecificHeat(rows.cp, x, rows.log10pSpan, offset);
+    _k = _fitThermalCond(rows.k, x, rows.log10pSpan, offset);
+    _mu = _fitViscosity(rows.mu, y, rows.log10pSpan, offset);
+    _comp = _fitCompFactor(rows.z, y, rows.log10pSpan, offset);
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-4 atm
-    ////////////////////
-    if (pressureOffset == 0)
-    {
-             if (temperature <  2250.0) temperatureOffset = 0;
-        else if (temperature <  4250.0) temperatureOffset = 1;
-        else if (temperature <  6750.0) temperatureOffset = 2;
-        else if (temperature < 10750.0) temperatureOffset = 3;
-        else if (temperature < 17750.0) temperatureOffset = 4;
-        else                            temperatureOffset = 5;
-    }
+    _calculateDerivedProperties();
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-3 atm
-    ////////////////////
-    else if (pressureOffset == 6)
-    {
-             if (temperature <  2250.0) temperatureOffset = 0;
-        else if (temperature <  4250.0) temperatureOffset = 1;
-        else if (temperature <  6750.0) temperatureOffset = 2;
-        else if (temperature < 11750.0) temperatureOffset = 3;
-        else if (temperature < 18750.0) temperatureOffset = 4;
-        else                            temperatureOffset = 5;
-    }
+    return;
+}
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-2 atm
-    ////////////////////
-    else if (pressureOffset == 12)
-    {
-             if (temperature <  2750.0) temperatureOffset = 0;
-        else if (temperature <  5250.0) temperatureOffset = 1;
-        else if (temperature <  9750.0) temperatureOffset = 2;
-        else if (temperature < 17750.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+/** Set the state from its curve fit properties and calculate the
+ *  derived properties, for evaluators that estimate the curve fits
+ *  by other means (AirTaylorCache).
+ *
+ *  @pre The arguments are the curve fit properties of a state in
+ *       the range of calculateProperties.
+ *  @post The properties are stored in the appropriate variables.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param enthalpy The enthalpy of the state (in kJ/kg).
+ *  @param specificHeat The specific heat of the state (in kJ/kg-K).
+ *  @param thermalCond The thermal conductivity (in W/m-K).
+ *  @param viscosity The dynamic viscosity (in kg/m-s).
+ *  @param compFactor The compressibility factor.
+ *  @return none.
+*/
+void Air::setPrimaryProperties (double pressure, double temperature,
+                                double enthalpy, double specificHeat,
+                                double thermalCond, double viscosity,
+                                double compFactor)
+{
+    _temperature = temperature;
+    _pressure = pressure;
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-1 atm
-    ////////////////////
-    else if (pressureOffset == 17)
-    {
-             if (temperature <  3250.0) temperatureOffset = 0;
-        else if (temperature <  6250.0) temperatureOffset = 1;
-        else if (temperature < 15250.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
+    _enthalpy = enthalpy;
+    _cp = specificHeat;
+    _k = thermalCond;
+    _mu = viscosity;
+    _comp = compFactor;
 
-    ///////////////////////////////////
-    // Pressure ~ 10^0 atm
-    ////////////////////
-    else if (pressureOffset == 21)
-    {
-             if (temperature <  3750.0) temperatureOffset = 0;
-        else if (temperature <  8250.0) temperatureOffset = 1;
-        else if (temperature < 17750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
+    _calculateDerivedProperties();
 
-    ///////////////////////////////////
-    // Pressure ~ 10^1 atm
-    ////////////////////
-    else if (pressureOffset == 25)
-    {
-             if (temperature <  4250.0) temperatureOffset = 0;
-        else if (temperature <  9250.0) temperatureOffset = 1;
-        else if (temperature < 18750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
+    return;
+}
 
-    ///////////////////////////////////
-    // Pressure ~ 10^2 atm
-    ////////////////////
-    else
-    {
-             if (temperature <  6250.0) temperatureOffset = 0;
-        else if (temperature < 12750.0) temperatureOffset = 1;
-        else                            temperatureOffset = 2;
-    }
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Logarithmicaly interpolate the thermodynamic-property
+ *  surface (phi, T) between pressure contours.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @param span log10(p2) - log10(p1) of the pressure contours p1
+ *         and p2 (in atm).
+ *  @param offset log10(p) - log10(p1) of the state pressure p.
+ *  @param phi_1 The thermodynamic property at p1.
+ *  @param phi_2 The thermodynamic property at p2.
+ *  @return The interpolated thermodynamic property.
+*/
+double Air::_interpolate (double span, double offset,
+                          double phi_1, double phi_2) const
+{
+    double propValue;
+
+    propValue = (((log10(phi_2) - log10(phi_1)) / span) * offset)
+                + log10(phi_1);
 
-    hOffset = pressureOffset + temperatureOffset;
+    propValue = pow(10.0, propValue);
 
-    return hOffset;
+    return propValue;
 }
 
+/** Determine the index of the enthalpy coefficient array
+ *  based on the pressure and temperature.
+ *
+ *  @pre The object is instantiated and
+ *       10E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param pressure The order-of-magnitude of the pressure of interest.
+ *  @param temperature The temperature of the state in K.
+ *  @return An index into the _h_coeffs array.
+*/
+uint32 Air::_get_h_row (double pressure, double temperature) const
+{  return _getRow(_h_decadeRows, _h_Tmin, pressure, temperature);  }
+
 /** Determine the index of the specific heat coefficient array
  *  based on the pressure and temperature.
  *
@@ -745,150 +895,7 @@ uint32 Air::_get_h_row (double pressure, double temperature) const
  *  @return An index into the _cp_coeffs array.
 */
 uint32 Air::_get_cp_row (double pressure, double temperature) const
-{
-    uint32 temperatureOffset,
-           pressureOffset,
-           cpOffset;
-
-    // The initial index begins with 0
-    if ((pressure / 1E-4) < 10.0)
-        pressureOffset = 0;
-
-    // There are 9 entries in the 10^-4 regime,
-    //    so we begin the 10^-3 index shifted by 9
-    else if ((pressure / 1E-3) < 10.0)
-        pressureOffset = 9;
-
-    // There are 8 entries in the 10^-3 regime,
-    //    so we begin the 10^-2 index shifted by 17
-    else if ((pressure / 1E-2) < 10.0)
-        pressureOffset = 17;
-
-    // There are 7 entries in the 10^-2 regime,
-    //    so we begin the 10^-1 index shifted by 24
-    else if ((pressure / 1E-1) < 10.0)
-        pressureOffset = 24;
-
-    // There are 8 entries in the 10^-1 regime,
-    //    so we begin the 10^0 index shifted by 32
-    else if ((pressure / 1E0) < 10.0)
-        pressureOffset = 32;
-
-    // There are 7 entries in the 10^0 regime,
-    //    so we begin the 10^1 index shifted by 39
-    else if ((pressure / 1E1) < 10.0)
-        pressureOffset = 39;
-
-    // There are 7 entries in the 10^1 regime,
-    //    so we begin the 10^2 index shifted by 46
-    else
-        pressureOffset = 46;
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-4 atm
-    ////////////////////
-    if (pressureOffset == 0)
-    {
-             if (temperature <  1250.0) temperatureOffset = 0;
-        else if (temperature <  1750.0) temperatureOffset = 1;
-        else if (temperature <  2750.0) temperatureOffset = 2;
-        else if (temperature <  4750.0) temperatureOffset = 3;
-        else if (temperature <  6250.0) temperatureOffset = 4;
-        else if (temperature <  9750.0) temperatureOffset = 5;
-        else if (temperature < 14250.0) temperatureOffset = 6;
-        else if (temperature < 19750.0) temperatureOffset = 7;
-        else                            temperatureOffset = 8;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-3 atm
-    ////////////////////
-    else if (pressureOffset == 9)
-    {
-             if (temperature <  1250.0) temperatureOffset = 0;
-        else if (temperature <  2250.0) temperatureOffset = 1;
-        else if (temperature <  3750.0) temperatureOffset = 2;
-        else if (temperature <  5250.0) temperatureOffset = 3;
-        else if (temperature <  7250.0) temperatureOffset = 4;
-        else if (temperature < 10750.0) temperatureOffset = 5;
-        else if (temperature < 17250.0) temperatureOffset = 6;
-        else                            temperatureOffset = 7;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-2 atm
-    ////////////////////
-    else if (pressureOffset == 17)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  2750.0) temperatureOffset = 1;
-        else if (temperature <  4750.0) temperatureOffset = 2;
-        else if (temperature <  6750.0) temperatureOffset = 3;
-        else if (temperature < 12750.0) temperatureOffset = 4;
-        else if (temperature < 19750.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-1 atm
-    ////////////////////
-    else if (pressureOffset == 24)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  2750.0) temperatureOffset = 1;
-        else if (temperature <  4250.0) temperatureOffset = 2;
-        else if (temperature <  6750.0) temperatureOffset = 3;
-        else if (temperature <  9750.0) temperatureOffset = 4;
-        else if (temperature < 15750.0) temperatureOffset = 5;
-        else if (temperature < 21500.0) temperatureOffset = 6;
-        else                            temperatureOffset = 7;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^0 atm
-    ////////////////////
-    else if (pressureOffset == 32)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  3250.0) temperatureOffset = 1;
-        else if (temperature <  4750.0) temperatureOffset = 2;
-        else if (temperature <  7750.0) temperatureOffset = 3;
-        else if (temperature < 11750.0) temperatureOffset = 4;
-        else if (temperature < 20500.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^1 atm
-    ////////////////////
-    else if (pressureOffset == 39)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  3250.0) temperatureOffset = 1;
-        else if (temperature <  5750.0) temperatureOffset = 2;
-        else if (temperature <  9250.0) temperatureOffset = 3;
-        else if (temperature < 13750.0) temperatureOffset = 4;
-        else if (temperature < 22500.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^2 atm
-    ////////////////////
-    else
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  3750.0) temperatureOffset = 1;
-        else if (temperature <  6750.0) temperatureOffset = 2;
-        else if (temperature < 10750.0) temperatureOffset = 3;
-        else if (temperature < 17750.0) temperatureOffset = 4;
-        else                            temperatureOffset = 5;
-    }
-
-    cpOffset = pressureOffset + temperatureOffset;
-
-    return cpOffset;
-}
+{  return _getRow(_cp_decadeRows, _cp_Tmin, pressure, temperature);  }
 
 /** Determine the index of the thermal conductivity coefficient array
  *  based on the pressure and temperature.
@@ -901,140 +908,7 @@ uint32 Air::_get_cp_row (double pressure, double temperature) const
  *  @return An index into the _k_coeffs array.
 */
 uint32 Air::_get_k_row (double pressure, double temperature) const
-{
-    uint32 temperatureOffset,
-           pressureOffset,
-           kOffset;
-
-    // The initial index begins with 0
-    if ((pressure / 1E-4) < 10.0)
-        pressureOffset = 0;
-
-    // There are 7 entries in the 10^-4 regime,
-    //    so we begin the 10^-3 index shifted by 7
-    else if ((pressure / 1E-3) < 10.0)
-        pressureOffset = 7;
-
-    // There are 7 entries in the 10^-3 regime,
-    //    so we begin the 10^-2 index shifted by 14
-    else if ((pressure / 1E-2) < 10.0)
-        pressureOffset = 14;
-
-    // There are 7 entries in the 10^-2 regime,
-    //    so we begin the 10^-1 index shifted by 21
-    else if ((pressure / 1E-1) < 10.0)
-        pressureOffset = 21;
-
-    // There are 6 entries in the 10^-1 regime,
-    //    so we begin the 10^0 index shifted by 27
-    else if ((pressure / 1E0) < 10.0)
-        pressureOffset = 27;
-
-    // There are 6 entries in the 10^0 regime,
-    //    so we begin the 10^1 index shifted by 33
-    else if ((pressure / 1E1) < 10.0)
-        pressureOffset = 33;
-
-    // There are 5 entries in the 10^1 regime,
-    //    so we begin the 10^2 index shifted by 38
-    else
-        pressureOffset = 38;
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-4 atm
-    ////////////////////
-    if (pressureOffset == 0)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  2750.0) temperatureOffset = 1;
-        else if (temperature <  4750.0) temperatureOffset = 2;
-        else if (temperature <  6250.0) temperatureOffset = 3;
-        else if (temperature < 10250.0) temperatureOffset = 4;
-        else if (temperature < 17750.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-3 atm
-    ////////////////////
-    else if (pressureOffset == 7)
-    {
-             if (temperature <  1750.0) temperatureOffset = 0;
-        else if (temperature <  2750.0) temperatureOffset = 1;
-        else if (temperature <  4750.0) temperatureOffset = 2;
-        else if (temperature <  6250.0) temperatureOffset = 3;
-        else if (temperature < 11250.0) temperatureOffset = 4;
-        else if (temperature < 18250.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-2 atm
-    ////////////////////
-    else if (pressureOffset == 14)
-    {
-             if (temperature <  2250.0) temperatureOffset = 0;
-        else if (temperature <  3250.0) temperatureOffset = 1;
-        else if (temperature <  5750.0) temperatureOffset = 2;
-        else if (temperature <  7750.0) temperatureOffset = 3;
-        else if (temperature < 12750.0) temperatureOffset = 4;
-        else if (temperature < 18750.0) temperatureOffset = 5;
-        else                            temperatureOffset = 6;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-1 atm
-    ////////////////////
-    else if (pressureOffset == 21)
-    {
-             if (temperature <  2250.0) temperatureOffset = 0;
-        else if (temperature <  4250.0) temperatureOffset = 1;
-        else if (temperature <  6750.0) temperatureOffset = 2;
-        else if (temperature <  9250.0) temperatureOffset = 3;
-        else if (temperature < 16750.0) temperatureOffset = 4;
-        else                            temperatureOffset = 5;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^0 atm
-    ////////////////////
-    else if (pressureOffset == 27)
-    {
-             if (temperature <  2250.0) temperatureOffset = 0;
-        else if (temperature <  4250.0) temperatureOffset = 1;
-        else if (temperature <  7750.0) temperatureOffset = 2;
-        else if (temperature < 10750.0) temperatureOffset = 3;
-        else if (temperature < 19250.0) temperatureOffset = 4;
-        else                            temperatureOffset = 5;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^1 atm
-    ////////////////////
-    else if (pressureOffset == 33)
-    {
-             if (temperature <  3250.0) temperatureOffset = 0;
-        else if (temperature <  5250.0) temperatureOffset = 1;
-        else if (temperature <  8750.0) temperatureOffset = 2;
-        else if (temperature < 13750.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^2 atm
-    ////////////////////
-    else
-    {
-             if (temperature <  3750.0) temperatureOffset = 0;
-        else if (temperature <  6250.0) temperatureOffset = 1;
-        else if (temperature < 10750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
-
-    kOffset = pressureOffset + temperatureOffset;
-
-    return kOffset;
-}
+{  return _getRow(_k_decadeRows, _k_Tmin, pressure, temperature);  }
 
 /** Determine the index of the viscosity coefficient array
  *  based on the pressure and temperature.
@@ -1047,124 +921,7 @@ uint32 Air::_get_k_row (double pressure, double temperature) const
  *  @return An index into the _mu_coeffs array.
 */
 uint32 Air::_get_mu_row (double pressure, double temperature) const
-{
-    uint32 temperatureOffset,
-           pressureOffset,
-           muOffset;
-
-    // The initial index begins with 0
-    if ((pressure / 1E-4) < 10.0)
-        pressureOffset = 0;
-
-    // There are 4 entries in the 10^-4 regime,
-    //    so we begin the 10^-3 index shifted by 4
-    else if ((pressure / 1E-3) < 10.0)
-        pressureOffset = 4;
-
-    // There are 4 entries in the 10^-3 regime,
-    //    so we begin the 10^-2 index shifted by 8
-    else if ((pressure / 1E-2) < 10.0)
-        pressureOffset = 8;
-
-    // There are 4 entries in the 10^-2 regime,
-    //    so we begin the 10^-1 index shifted by 12
-    else if ((pressure / 1E-1) < 10.0)
-        pressureOffset = 12;
-
-    // There are 4 entries in the 10^-1 regime,
-    //    so we begin the 10^0 index shifted by 16
-    else if ((pressure / 1E0) < 10.0)
-        pressureOffset = 16;
-
-    // There are 3 entries in the 10^0 regime,
-    //    so we begin the 10^1 index shifted by 19
-    else if ((pressure / 1E1) < 10.0)
-        pressureOffset = 19;
-
-    // There are 3 entries in the 10^1 regime,
-    //    so we begin the 10^2 index shifted by 22
-    else
-        pressureOffset = 22;
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-4 atm
-    ////////////////////
-    if (pressureOffset == 0)
-    {
-             if (temperature <  7750.0) temperatureOffset = 0;
-        else if (temperature < 10750.0) temperatureOffset = 1;
-        else if (temperature < 16750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-3 atm
-    ////////////////////
-    else if (pressureOffset == 4)
-    {
-             if (temperature <  8250.0) temperatureOffset = 0;
-        else if (temperature < 12250.0) temperatureOffset = 1;
-        else if (temperature < 18750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-2 atm
-    ////////////////////
-    else if (pressureOffset == 8)
-    {
-             if (temperature <  8750.0) temperatureOffset = 0;
-        else if (temperature < 14250.0) temperatureOffset = 1;
-        else if (temperature < 19750.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-1 atm
-    ////////////////////
-    else if (pressureOffset == 12)
-    {
-             if (temperature <  9750.0) temperatureOffset = 0;
-        else if (temperature < 16750.0) temperatureOffset = 1;
-        else if (temperature < 24500.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^0 atm
-    ////////////////////
-    else if (pressureOffset == 16)
-    {
-             if (temperature < 11250.0) temperatureOffset = 0;
-        else if (temperature < 19750.0) temperatureOffset = 1;
-        else                            temperatureOffset = 2;
-    }
-
-    ///////////////////////////////////
-    // Pressure ~ 10^1 atm
-    ////////////////////
-    else if (pressureOffset == 19)
-    {
-             if (temperature < 12750.0) temperatureOffset = 0;
-        else if (temperature < 21500.0) temperatureOffset = 1;
-        else                            temperatureOffset = 2;
-    }
-
-
-    ///////////////////////////////////
-    // Pressure ~ 10^2 atm
-    ////////////////////
-    else
-    {
-             if (temperature < 15250.0) temperatureOffset = 0;
-        else                            temperatureOffset = 1;
-    }
-
-
-    muOffset = pressureOffset + temperatureOffset;
-
-    return muOffset;
-}
+{  return _getRow(_mu_decadeRows, _mu_Tmin, pressure, temperature);  }
 
 /** Determine the index of the compressibility coefficient array
  *  based on the pressure and temperature.
@@ -1177,129 +934,76 @@ uint32 Air::_get_mu_row (double pressure, double temperature) const
  *  @return An index into the _z_coeffs array.
 */
 uint32 Air::_get_z_row (double pressure, double temperature) const
-{
-    uint32 temperatureOffset,
-           pressureOffset,
-           zOffset;
+{  return _getRow(_z_decadeRows, _z_Tmin, pressure, temperature);  }
 
-    // The initial index begins with 0
-    if ((pressure / 1E-4) < 10.0)
-        pressureOffset = 0;
-
-    // There are 5 entries in the 10^-4 regime,
-    //    so we begin the 10^-3 index shifted by 5
-    else if ((pressure / 1E-3) < 10.0)
-        pressureOffset = 5;
-
-    // There are 5 entries in the 10^-3 regime,
-    //    so we begin the 10^-2 index shifted by 10
-    else if ((pressure / 1E-2) < 10.0)
-        pressureOffset = 10;
-
-    // There are 5 entries in the 10^-2 regime,
-    //    so we begin the 10^-1 index shifted by 15
-    else if ((pressure / 1E-1) < 10.0)
-        pressureOffset = 15;
-
-    // There are 5 entries in the 10^-1 regime,
-    //    so we begin the 10^0 index shifted by 20
-    else if ((pressure / 1E0) < 10.0)
-        pressureOffset = 20;
-
-    // There are 5 entries in the 10^0 regime,
-    //    so we begin the 10^1 index shifted by 25
-    else if ((pressure / 1E1) < 10.0)
-        pressureOffset = 25;
-
-    // There are 4 entries in the 10^1 regime,
-    //    so we begin the 10^2 index shifted by 29
-    else
-        pressureOffset = 29;
-
-    ///////////////////////////////////
-    // Pressure ~ 10^-4 atm
-    ////////////////////
-    if (pressureOffset == 0)
-    {
-             if (temperature <  2750.0) temperatureOffset = 0;
-        else if (temperature <  5750.0) temperatureOffset = 1;
-        else if (temperature <  8750.0) temperatureOffset = 2;
-        else if (temperature < 17750.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+/** Determine the pressure order-of-magnitude group of the
+ *  coefficient tables.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The group index (0 for 10^-4 atm through 6 for 10^2 atm).
+*/
+uint32 Air::_getDecade (double pressure) const
+{  return AirCoefficients::decade(pressure);  }
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-3 atm
-    ////////////////////
-    else if (pressureOffset == 5)
-    {
-             if (temperature <  3250.0) temperatureOffset = 0;
-        else if (temperature <  6750.0) temperatureOffset = 1;
-        else if (temperature <  9750.0) temperatureOffset = 2;
-        else if (temperature < 19750.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+/** Determine the index of a coefficient array based on the
+ *  pressure and temperature.
+ *
+ *  @pre The object is instantiated and
+ *       10E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param decadeRows The first row of each pressure group of the
+ *         table followed by the table length.
+ *  @param Tmin The lower temperature limit of each row in K.
+ *  @param pressure The order-of-magnitude of the pressure of interest.
+ *  @param temperature The temperature of the state in K.
+ *  @return An index into the coefficient array.
+*/
+uint32 Air::_getRow (const uint32 decadeRows[8], const double Tmin[],
+                     double pressure, double temperature) const
+{
+    uint32 decade = _getDecade(pressure),
+           row = decadeRows[decade];
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-2 atm
-    ////////////////////
-    else if (pressureOffset == 10)
-    {
-             if (temperature <  3250.0) temperatureOffset = 0;
-        else if (temperature <  7250.0) temperatureOffset = 1;
-        else if (temperature < 11750.0) temperatureOffset = 2;
-        else if (temperature < 21500.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+    // Advance to the last row of the group whose lower
+    // temperature limit does not exceed the temperature.
+    while (   ((row + 1) < decadeRows[decade + 1])
+           && (temperature >= Tmin[row + 1]))
+        ++row;
 
-    ///////////////////////////////////
-    // Pressure ~ 10^-1 atm
-    ////////////////////
-    else if (pressureOffset == 15)
-    {
-             if (temperature <  3750.0) temperatureOffset = 0;
-        else if (temperature <  8250.0) temperatureOffset = 1;
-        else if (temperature < 13750.0) temperatureOffset = 2;
-        else if (temperature < 23500.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+    return row;
+}
 
-    ///////////////////////////////////
-    // Pressure ~ 10^0 atm
-    ////////////////////
-    else if (pressureOffset == 20)
-    {
-             if (temperature <  5750.0) temperatureOffset = 0;
-        else if (temperature <  9250.0) temperatureOffset = 1;
-        else if (temperature < 15750.0) temperatureOffset = 2;
-        else if (temperature < 23500.0) temperatureOffset = 3;
-        else                            temperatureOffset = 4;
-    }
+/** Determine the temperature interval in which a row of a
+ *  coefficient array applies.
+ *
+ *  @pre row was returned by _getRow for the same table and pressure.
+ *  @post none.
+ *  @param decadeRows The first row of each pressure group of the
+ *         table followed by the table length.
+ *  @param Tmin The lower temperature limit of each row in K.
+ *  @param pressure The order-of-magnitude of the pressure of interest.
+ *  @param row The index into the coefficient array.
+ *  @param tLower The lowest temperature of the row in K (inclusive).
+ *  @param tUpper The highest temperature of the row in K (exclusive,
+ *         except for the last row of a group, which ends at 30000 K).
+ *  @return none.
+*/
+void Air::_getRowBand (const uint32 decadeRows[8], const double Tmin[],
+                       double pressure, uint32 row,
+                       double &tLower, double &tUpper) const
+{
+    uint32 decade = _getDecade(pressure);
 
-    ///////////////////////////////////
-    // Pressure ~ 10^1 atm
-    ////////////////////
-    else if (pressureOffset == 25)
-    {
-             if (temperature <  5750.0) temperatureOffset = 0;
-        else if (temperature <  9750.0) temperatureOffset = 1;
-        else if (temperature < 17250.0) temperatureOffset = 2;
-        else                            temperatureOffset = 3;
-    }
+    tLower = Tmin[row];
 
-    ///////////////////////////////////
-    // Pressure ~ 10^2 atm
-    ////////////////////
+    if ((row + 1) < decadeRows[decade + 1])
+        tUpper = Tmin[row + 1];
     else
-    {
-             if (temperature <  8750.0) temperatureOffset = 0;
-        else if (temperature < 17750.0) temperatureOffset = 1;
-        else                            temperatureOffset = 2;
-    }
-
-    zOffset = pressureOffset + temperatureOffset;
+        tUpper = 30000.0;
 
-    return zOffset;
+    return;
 }
 
 /** Determine the upper and lower order of magnitudes
@@ -1360,20 +1064,25 @@ void Air::_getPressureOM (double pressure,
 */
 double Air::_calculateEnthalpy (double pressure, double temperature) const
 {
-    double enth1;
+    double enthalpy;
 
     double p1,  // Smaller order-of-magnitude [units: atm]
            p2;  // Larger order-of-magnitude  [units: atm]
 
-    double x;     // Independent variable for curve fit relations.
-    double h[2];  // order-of-magnitude values for enthalpy.
+    double x;  // Independent variable for curve fit relations.
 
     uint32 index[2];  // Stores the indices into the coefficient tables.
 
     // The reference states that for temperatures below 500 K,
     // simpler relations may be used to generate properties.
     if (temperature <= 500.0)
-        enth1 = 0.24E-3 * temperature;  // Units: kcal/g
+    {
+        double enth1 = 0.24E-3 * temperature;  // Units: kcal/g
+
+        // Convert enthalpy from kcal/g -> kJ/kg (see _fitEnthalpy)
+        enthalpy = enth1 * 1000.0 * 1000.0 / 238.8459;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
+    }
 
     else
     {
@@ -1381,44 +1090,38 @@ double Air::_calculateEnthalpy (double pressure, double temperature) const
         // so we need to convert MPa to atm.
         //   0.101325 = conversion factor MPa -> atm
         pressure /= 0.101325;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Determine the correct order-of-magnitude values
         // for evaluating the properties
         _getPressureOM(pressure, p1, p2);
+        AIR_PROFILE_MARK(STAGE_PRESSURE_OM);
 
         // The enthalpy, specific heat, and thermal conductivity
         // curve fits use the natural log of temperature as the
         // independent variable.
         x = log(temperature / 10000.0);
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
 
         // Based on the magnitude of the input pressure
-        // and the temperature range, return an enthalpy
-        // table location index
+        // and the temperature range, return the
+        // table location indices
         index[0] = _get_h_row(p1, temperature);
         index[1] = _get_h_row(p2, temperature);
 
-        for (uint32 i = 0; i < 2; ++i)
-        {
-            h[i] =  (_h_coeffs[index[i]][0] * pow(x, 4.0))
-                  + (_h_coeffs[index[i]][1] * pow(x, 3.0))
-                  + (_h_coeffs[index[i]][2] * pow(x, 2.0))
-                  + (_h_coeffs[index[i]][3] * x)
-                  +  _h_coeffs[index[i]][4];
+        AIR_STATS_ROW(TABLE_H, index[0]);
+        AIR_STATS_ROW(TABLE_H, index[1]);
+        AIR_PROFILE_MARK(STAGE_ROW_LOOKUP);
 
-            h[i] = exp(h[i]);  // [Units: kcal/g]
-        }
+        // The log-linear interpolation between the pressure contours
+        // needs the logs of the contours and of the state pressure.
+        double span = log10(p2) - log10(p1),
+               offset = log10(_pressure / 0.101325) - log10(p1);
+        AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-        // Evaluate the properties by using log-linear interpolation
-        // between the pressure intervals specified
-        enth1 = _interpolate(p1, p2, h[0], h[1]);   // units: kcal/g
+        enthalpy = _fitEnthalpy(index, x, span, offset);
     }
 
-    // Convert enthalpy from kcal/g -> kJ/kg
-    //    1000.0   = convert g -> kg
-    //    1000.0   = convert kcal -> cal
-    //    238.8459 = convert cal -> kJ
-    double enthalpy = enth1 * 1000.0 * 1000.0 / 238.8459;
-
     return enthalpy;
 }
 
@@ -1433,13 +1136,12 @@ double Air::_calculateEnthalpy (double pressure, double temperature) const
 */
 double Air::_calculateSpecificHeat (double pressure, double temperature) const
 {
-    double cp1;
+    double specificHeat;
 
     double p1,  // Smaller order-of-magnitude [units: atm]
            p2;  // Larger order-of-magnitude  [units: atm]
 
-    double x;      // Independent variable for curve fit relations.
-    double cp[2];  // order-of-magnitude values for cp.
+    double x;  // Independent variable for curve fit relations.
 
     uint32 index[2];  // Stores the indices into the coefficient tables.
 
@@ -1449,7 +1151,12 @@ double Air::_calculateSpecificHeat (double pressure, double temperature) const
     {
         // The reference states that for temperatures below
         // 500 K, use the constant value cp = 0.24 cal/(g-K)
-        cp1 = 0.24;  // Units: cal/(g-K)
+        double cp1 = 0.24;  // Units: cal/(g-K)
+
+        // Convert specific heat from cal/g-K to kJ/kg-K
+        // (see _fitSpecificHeat)
+        specificHeat = cp1 * 1000.0 / 238.8459;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
     }
 
     else
@@ -1458,43 +1165,38 @@ double Air::_calculateSpecificHeat (double pressure, double temperature) const
         // so we need to convert MPa to atm.
         //   0.101325 = conversion factor MPa -> atm
         pressure /= 0.101325;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Determine the correct order-of-magnitude values
         // for evaluating the properties
         _getPressureOM(pressure, p1, p2);
+        AIR_PROFILE_MARK(STAGE_PRESSURE_OM);
 
         // The enthalpy, specific heat, and thermal conductivity
         // curve fits use the natural log of temperature as the
         // independent variable.
         x = log(temperature / 10000.0);
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
 
         // Based on the magnitude of the input pressure
-        // and the temperature range, return a specific heat
-        // table location index
+        // and the temperature range, return the
+        // table location indices
         index[0] = _get_cp_row(p1, temperature);
         index[1] = _get_cp_row(p2, temperature);
 
-        for (uint32 i = 0; i < 2; ++i)
-        {
-            cp[i] =  (_cp_coeffs[index[i]][0] * pow(x, 4.0))
-                   + (_cp_coeffs[index[i]][1] * pow(x, 3.0))
-                   + (_cp_coeffs[index[i]][2] * pow(x, 2.0))
-                   + (_cp_coeffs[index[i]][3] * x)
-                   +  _cp_coeffs[index[i]][4];
+        AIR_STATS_ROW(TABLE_CP, index[0]);
+        AIR_STATS_ROW(TABLE_CP, index[1]);
+        AIR_PROFILE_MARK(STAGE_ROW_LOOKUP);
 
-            cp[i] = exp(cp[i]);  // [Units: cal/(g-K)]
-        }
+        // The log-linear interpolation between the pressure contours
+        // needs the logs of the contours and of the state pressure.
+        double span = log10(p2) - log10(p1),
+               offset = log10(_pressure / 0.101325) - log10(p1);
+        AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-        // Evaluate the properties by using log-linear interpolation
-        // between the pressure intervals specified
-        cp1 = _interpolate(p1, p2, cp[0], cp[1]); // units: cal/g-K
+        specificHeat = _fitSpecificHeat(index, x, span, offset);
     }
 
-    // Convert specific heat from cal/g-K to kJ/kg-K
-    //    1000.0   = convert g -> kg
-    //    238.8459 = convert cal -> kJ
-    double specificHeat = cp1 * 1000.0 / 238.8459;
-
     return specificHeat;
 }
 
@@ -1509,13 +1211,12 @@ double Air::_calculateSpecificHeat (double pressure, double temperature) const
 */
 double Air::_calculateThermalCond (double pressure, double temperature) const
 {
-    double k1;
+    double thermalCond;
 
     double p1,  // Smaller order-of-magnitude [units: atm]
            p2;  // Larger order-of-magnitude  [units: atm]
 
-    double x;     // Independent variable for curve fit relations.
-    double k[2];  // order-of-magnitude values for thermal cond.
+    double x;  // Independent variable for curve fit relations.
 
     uint32 index[2];  // Stores the indices into the coefficient tables.
 
@@ -1525,7 +1226,14 @@ double Air::_calculateThermalCond (double pressure, double temperature) const
     {
         // If the temperature is less than 500 K, use Sutherland's
         // thermal conductivity law...  [Units: cal/(cm-s-K)]
-        k1 = 5.9776E-6 * (pow(_temperature, 1.5) / (_temperature + 194.4));
+        double k1 = 5.9776E-6 * (pow(_temperature, 1.5)
+                                 / (_temperature + 194.4));
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
+
+        // Convert thermal conductivity from cal/cm-s-K to W/m-K
+        // (see _fitThermalCond)
+        thermalCond = k1 * 100.0 / 0.2388459;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
     }
 
     else
@@ -1534,44 +1242,38 @@ double Air::_calculateThermalCond (double pressure, double temperature) const
         // so we need to convert MPa to atm.
         //   0.101325 = conversion factor MPa -> atm
         pressure /= 0.101325;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Determine the correct order-of-magnitude values
         // for evaluating the properties
         _getPressureOM(pressure, p1, p2);
+        AIR_PROFILE_MARK(STAGE_PRESSURE_OM);
 
         // The enthalpy, specific heat, and thermal conductivity
         // curve fits use the natural log of temperature as the
         // independent variable.
         x = log(temperature / 10000.0);
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
 
         // Based on the magnitude of the input pressure
-        // and the temperature range, return a therm. cond.
-        // table location index
+        // and the temperature range, return the
+        // table location indices
         index[0] = _get_k_row(p1, temperature);
         index[1] = _get_k_row(p2, temperature);
 
-        for (uint32 i = 0; i < 2; ++i)
-        {
-            k[i] =  (_k_coeffs[index[i]][0] * pow(x, 4.0))
-                  + (_k_coeffs[index[i]][1] * pow(x, 3.0))
-                  + (_k_coeffs[index[i]][2] * pow(x, 2.0))
-                  + (_k_coeffs[index[i]][3] * x)
-                  +  _k_coeffs[index[i]][4];
+        AIR_STATS_ROW(TABLE_K, index[0]);
+        AIR_STATS_ROW(TABLE_K, index[1]);
+        AIR_PROFILE_MARK(STAGE_ROW_LOOKUP);
 
-            k[i] = exp(k[i]);  // [Units: cal/(cm-s-K)]
-        }
+        // The log-linear interpolation between the pressure contours
+        // needs the logs of the contours and of the state pressure.
+        double span = log10(p2) - log10(p1),
+               offset = log10(_pressure / 0.101325) - log10(p1);
+        AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-        // Evaluate the properties by using log-linear interpolation
-        // between the pressure intervals specified
-        k1 = _interpolate(p1, p2, k[0], k[1]);   // units: cal/cm-s-K
+        thermalCond = _fitThermalCond(index, x, span, offset);
     }
 
-    // Convert thermal conductivity from cal/cm-s-K to W/m-K
-    //    100.0     = convert cm -> m
-    //    0.2388459 = convert cal -> J
-    //    1 J/s     = 1 W
-    double thermalCond = k1 * 100.0 / 0.2388459;
-
     return thermalCond;
 }
 
@@ -1591,8 +1293,7 @@ double Air::_calculateCompFactor (double pressure, double temperature) const
     double p1,  // Smaller order-of-magnitude [units: atm]
            p2;  // Larger order-of-magnitude  [units: atm]
 
-    double x;     // Independent variable for curve fit relations.
-    double z[2];  // order-of-magnitude values for compressibility.
+    double x;  // Independent variable for curve fit relations.
 
     uint32 index[2];  // Stores the indices into the coefficient tables.
 
@@ -1611,33 +1312,35 @@ double Air::_calculateCompFactor (double pressure, double temperature) const
         // so we need to convert MPa to atm.
         //   0.101325 = conversion factor MPa -> atm
         pressure /= 0.101325;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Determine the correct order-of-magnitude values
         // for evaluating the properties
         _getPressureOM(pressure, p1, p2);
+        AIR_PROFILE_MARK(STAGE_PRESSURE_OM);
 
         // The compressibility factor and viscosity curve fits
         // use a scaled temperature as the independent value.
         x = _temperature / 1000.0;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Based on the magnitude of the input pressure
-        // and the temperature range, return a comp. factor
-        // table location index
+        // and the temperature range, return the
+        // table location indices
         index[0] = _get_z_row(p1, temperature);
         index[1] = _get_z_row(p2, temperature);
 
-        for (uint32 i = 0; i < 2; ++i)
-        {
-            z[i] =   _z_coeffs[index[i]][0]
-                  + (_z_coeffs[index[i]][1] * x)
-                  + (_z_coeffs[index[i]][2] * pow(x, 2.0))
-                  + (_z_coeffs[index[i]][3] * pow(x, 3.0))
-                  + (_z_coeffs[index[i]][4] * pow(x, 4.0));
-        }
+        AIR_STATS_ROW(TABLE_Z, index[0]);
+        AIR_STATS_ROW(TABLE_Z, index[1]);
+        AIR_PROFILE_MARK(STAGE_ROW_LOOKUP);
+
+        // The log-linear interpolation between the pressure contours
+        // needs the logs of the contours and of the state pressure.
+        double span = log10(p2) - log10(p1),
+               offset = log10(_pressure / 0.101325) - log10(p1);
+        AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-        // Evaluate the properties by using log-linear interpolation
-        // between the pressure intervals specified
-        comp = _interpolate(p1, p2, z[0], z[1]);   // -dimensionless-
+        comp = _fitCompFactor(index, x, span, offset);
     }
 
     return comp;
@@ -1654,13 +1357,12 @@ double Air::_calculateCompFactor (double pressure, double temperature) const
 */
 double Air::_calculateViscosity (double pressure, double temperature) const
 {
-    double mu1;
+    double viscosity;
 
     double p1,  // Smaller order-of-magnitude [units: atm]
            p2;  // Larger order-of-magnitude  [units: atm]
 
-    double x;      // Independent variable for curve fit relations.
-    double mu[2];  // order-of-magnitude values for viscosity.
+    double x;  // Independent variable for curve fit relations.
 
     uint32 index[2];  // Stores the indices into the coefficient tables.
 
@@ -1671,7 +1373,13 @@ double Air::_calculateViscosity (double pressure, double temperature) const
         // If the computed film temperature is less than 500 K,
         // we compute the viscosity using Sutherland's Viscosity Law...
         // [Units: poise (g/cm-s)]
-        mu1 = 1.4584E-5 * (pow(_temperature, 1.5) / (_temperature + 110.33));
+        double mu1 = 1.4584E-5 * (pow(_temperature, 1.5)
+                                  / (_temperature + 110.33));
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
+
+        // Convert viscosity from poise to kg/m-s (see _fitViscosity)
+        viscosity = mu1 * 100.0 / 1000.0;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
     }
 
     else
@@ -1680,114 +1388,261 @@ double Air::_calculateViscosity (double pressure, double temperature) const
         // so we need to convert MPa to atm.
         //   0.101325 = conversion factor MPa -> atm
         pressure /= 0.101325;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Determine the correct order-of-magnitude values
         // for evaluating the properties
         _getPressureOM(pressure, p1, p2);
+        AIR_PROFILE_MARK(STAGE_PRESSURE_OM);
 
         // The compressibility factor and viscosity curve fits
         // use a scaled temperature as the independent value.
         x = _temperature / 1000.0;
+        AIR_PROFILE_MARK(STAGE_CONVERSION);
 
         // Based on the magnitude of the input pressure
-        // and the temperature range, return a viscosity
-        // table location index
+        // and the temperature range, return the
+        // table location indices
         index[0] = _get_mu_row(p1, temperature);
         index[1] = _get_mu_row(p2, temperature);
 
-        for (uint32 i = 0; i < 2; ++i)
-        {
-            mu[i] =   _mu_coeffs[index[i]][0]
-                  + (_mu_coeffs[index[i]][1] * x)
-                  + (_mu_coeffs[index[i]][2] * pow(x, 2.0))
-                  + (_mu_coeffs[index[i]][3] * pow(x, 3.0))
-                  + (_mu_coeffs[index[i]][4] * pow(x, 4.0))
-                  + (_mu_coeffs[index[i]][5] * pow(x, 5.0));
-        }
+        AIR_STATS_ROW(TABLE_MU, index[0]);
+        AIR_STATS_ROW(TABLE_MU, index[1]);
+        AIR_PROFILE_MARK(STAGE_ROW_LOOKUP);
 
-        // Evaluate the properties by using log-linear interpolation
-        // between the pressure intervals specified
-        mu1 = _interpolate(p1, p2, mu[0], mu[1]); // units: poise
-    }
+        // The log-linear interpolation between the pressure contours
+        // needs the logs of the contours and of the state pressure.
+        double span = log10(p2) - log10(p1),
+               offset = log10(_pressure / 0.101325) - log10(p1);
+        AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-    // Convert viscosity from poise to kg/m-s
-    //    1000.0 = convert g -> kg
-    //    100.0  = convert cm -> m
-    double viscosity = mu1 * 100.0 / 1000.0;
+        viscosity = _fitViscosity(index, x, span, offset);
+    }
 
     return viscosity;
 }
 
-/** Calculate the entropy of the state using the stored pressure,
- *  temperature, specific heat, and gas constant.
+/** Evaluate the enthalpy curve fit with the given rows.
  *
- *  @pre The object is instantited and the values for _pressure,
- *       _temperature, _gasConstant, and _cp have been calculated.
+ *  @pre The object is instantiated and 500 < T <= 30000 K.
  *  @post none.
- *  @return A double precision value containing the calculated
- *          entropy value [units: kJ/kg-K].
+ *  @param index The rows at the lower and upper pressure contours.
+ *  @param x The independent variable, ln(T / 10000).
+ *  @param span log10(p2) - log10(p1) of the pressure contours.
+ *  @param offset log10(p) - log10(p1) of the state pressure.
+ *  @return The enthalpy in units of kJ/kg.
 */
-double Air::_calculateEntropy (void) const
+double Air::_fitEnthalpy (const uint32 index[2], double x,
+                          double span, double offset) const
 {
-    /******************************************************
-    **  REFERENCES                                       **
-    ** ------------------------------------------------- **
-    **  1.) Moran, Michael J., Howard N. Shapiro.        **
-    **      "Fundamentals of Engineering                 **
-    **      Thermodynamics".  5th Edition.  John Wiley   **
-    **      and Sons.  Hoboken, NJ,  2004.               **
-    **      ISBN 0-471-27471-2.                          **
-    **                                                   **
-    ******************************************************/
-
-    double entropy;
-
-    // Reference temperature, pressure, and entropy values.
-    // (From Table A-22, Ref 1.)
-    static const double T0 = 300.0,     // Ref. temperature, 300 K.
-                        p0 = 0.101325,  // Ref. pressure 0.101325 MPa (1 atm).
-                        s0 = 1.70203;   // Ref. entropy [units: kJ/kg-K].
-
-    // Calculate the entropy of the gas state.  This equation assumes a
-    // thermally and calorically perfect gas, (it is a limitation) but
-    // it's a pretty good assumption for most air cases.
-    //
-    //    (From Equation 6.23, Ref 1.)
+    double h[2];  // order-of-magnitude values
+
+    for (uint32 i = 0; i < 2; ++i)
+    {
+        h[i] =  (_h_coeffs[index[i]][0] * pow(x, 4.0))
+              + (_h_coeffs[index[i]][1] * pow(x, 3.0))
+              + (_h_coeffs[index[i]][2] * pow(x, 2.0))
+              + (_h_coeffs[index[i]][3] * x)
+              +  _h_coeffs[index[i]][4];
+        AIR_PROFILE_MARK(STAGE_POLYNOMIAL);
+
+        h[i] = exp(h[i]);  // [Units: kcal/g]
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
+    }
 
-    entropy =   (_cp * log(_temperature / T0))        // Caloric component.
-              - (_gasConstant * log(_pressure / p0))  // enthalpic component.
-              + s0;                                   // Reference offset.
+    // Evaluate the properties by using log-linear interpolation
+    // between the pressure intervals specified
+    double enth1 = _interpolate(span, offset, h[0], h[1]);
+    AIR_PROFILE_MARK(STAGE_INTERPOLATE);
 
-    return entropy;
+    // Convert enthalpy from kcal/g -> kJ/kg
+    //    1000.0   = convert g -> kg
+    //    1000.0   = convert kcal -> cal
+    //    238.8459 = convert cal -> kJ
+    double enthalpy = enth1 * 1000.0 * 1000.0 / 238.8459;
+
+    AIR_PROFILE_MARK(STAGE_CONVERSION);
+
+    return enthalpy;
 }
 
-/** Calculate the refractive index of air using the calculated density.
+/** Evaluate the specific heat curve fit with the given rows.
  *
- *  @pre The object is instantiated and the value for _density
- *       has been computed.
+ *  @pre The object is instantiated and 500 < T <= 30000 K.
  *  @post none.
- *  @return A double precision value for the calculated index of
- *          refraction of air [-dimensionless-].
+ *  @param index The rows at the lower and upper pressure contours.
+ *  @param x The independent variable, ln(T / 10000).
+ *  @param span log10(p2) - log10(p1) of the pressure contours.
+ *  @param offset log10(p) - log10(p1) of the state pressure.
+ *  @return The specific heat in units of kJ/kg-K.
 */
-double Air::_calculateRefractionIndex (void) const
+double Air::_fitSpecificHeat (const uint32 index[2], double x,
+                              double span, double offset) const
 {
-    /******************************************************
-    **  REFERENCES                                       **
-    ** ------------------------------------------------- **
-    **  1.) Liepmann, H. W., A. Roshko.  "Elements of    **
-    **      Gasdynamics".  Dover Publications.  2001.    **
-    **      (original copyright: New York.  John Wiley & **
-    **      Sons.  1957.)  ISBN 978-0-486-41963-3.       **
-    **                                                   **
-    ******************************************************/
-
-    double refIndex;
-
-    static const double beta = 0.000292,            // Ref 1.
-                        rho0 = 1.2925694365458342;  // @ STP [units: kg/m^3].
-
-    // Calculate the refractive index. [-dimensionless-].
-    refIndex = 1.0 + (beta * _density / rho0);
-
-    return refIndex;
-}
\ No newline at end of file
+    double cp[2];  // order-of-magnitude values
+
+    for (uint32 i = 0; i < 2; ++i)
+    {
+        cp[i] =  (_cp_coeffs[index[i]][0] * pow(x, 4.0))
+              + (_cp_coeffs[index[i]][1] * pow(x, 3.0))
+              + (_cp_coeffs[index[i]][2] * pow(x, 2.0))
+              + (_cp_coeffs[index[i]][3] * x)
+              +  _cp_coeffs[index[i]][4];
+        AIR_PROFILE_MARK(STAGE_POLYNOMIAL);
+
+        cp[i] = exp(cp[i]);  // [Units: cal/(g-K)]
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
+    }
+
+    // Evaluate the properties by using log-linear interpolation
+    // between the pressure intervals specified
+    double cp1 = _interpolate(span, offset, cp[0], cp[1]);
+    AIR_PROFILE_MARK(STAGE_INTERPOLATE);
+
+    // Convert specific heat from cal/g-K to kJ/kg-K
+    //    1000.0   = convert g -> kg
+    //    238.8459 = convert cal -> kJ
+    double specificHeat = cp1 * 1000.0 / 238.8459;
+
+    AIR_PROFILE_MARK(STAGE_CONVERSION);
+
+    return specificHeat;
+}
+
+/** Evaluate the thermal cond. curve fit with the given rows.
+ *
+ *  @pre The object is instantiated and 500 < T <= 30000 K.
+ *  @post none.
+ *  @param index The rows at the lower and upper pressure contours.
+ *  @param x The independent variable, ln(T / 10000).
+ *  @param span log10(p2) - log10(p1) of the pressure contours.
+ *  @param offset log10(p) - log10(p1) of the state pressure.
+ *  @return The thermal conductivity in units of W/m-K.
+*/
+double Air::_fitThermalCond (const uint32 index[2], double x,
+                             double span, double offset) const
+{
+    double k[2];  // order-of-magnitude values
+
+    for (uint32 i = 0; i < 2; ++i)
+    {
+        k[i] =  (_k_coeffs[index[i]][0] * pow(x, 4.0))
+              + (_k_coeffs[index[i]][1] * pow(x, 3.0))
+              + (_k_coeffs[index[i]][2] * pow(x, 2.0))
+              + (_k_coeffs[index[i]][3] * x)
+              +  _k_coeffs[index[i]][4];
+        AIR_PROFILE_MARK(STAGE_POLYNOMIAL);
+
+        k[i] = exp(k[i]);  // [Units: cal/(cm-s-K)]
+        AIR_PROFILE_MARK(STAGE_TRANSCENDENTAL);
+    }
+
+    // Evaluate the properties by using log-linear interpolation
+    // between the pressure intervals specified
+    double k1 = _interpolate(span, offset, k[0], k[1]);
+    AIR_PROFILE_MARK(STAGE_INTERPOLATE);
+
+    // Convert thermal conductivity from cal/cm-s-K to W/m-K
+    //    100.0     = convert cm -> m
+    //    0.2388459 = convert cal -> J
+    //    1 J/s     = 1 W
+    double thermalCond = k1 * 100.0 / 0.2388459;
+
+    AIR_PROFILE_MARK(STAGE_CONVERSION);
+
+    return thermalCond;
+}
+
+/** Evaluate the compressibility curve fit with the given rows.
+ *
+ *  @pre The object is instantiated and 500 < T <= 30000 K.
+ *  @post none.
+ *  @param index The rows at the lower and upper pressure contours.
+ *  @param x The independent variable, T / 1000.
+ *  @param span log10(p2) - log10(p1) of the pressure contours.
+ *  @param offset log10(p) - log10(p1) of the state pressure.
+ *  @return The compressibility factor.
+*/
+double Air::_fitCompFactor (const uint32 index[2], double x,
+                            double span, double offset) const
+{
+    double z[2];  // order-of-magnitude values
+
+    for (uint32 i = 0; i < 2; ++i)
+    {
+        z[i] =   _z_coeffs[index[i]][0]
+              + (_z_coeffs[index[i]][1] * x)
+              + (_z_coeffs[index[i]][2] * pow(x, 2.0))
+              + (_z_coeffs[index[i]][3] * pow(x, 3.0))
+              + (_z_coeffs[index[i]][4] * pow(x, 4.0));
+    }
+
+    AIR_PROFILE_MARK(STAGE_POLYNOMIAL);
+
+    // Evaluate the properties by using log-linear interpolation
+    // between the pressure intervals specified
+    double comp = _interpolate(span, offset, z[0], z[1]);
+    AIR_PROFILE_MARK(STAGE_INTERPOLATE);
+
+    return comp;
+}
+
+/** Evaluate the viscosity curve fit with the given rows.
+ *
+ *  @pre The object is instantiated and 500 < T <= 30000 K.
+ *  @post none.
+ *  @param index The rows at the lower and upper pressure contours.
+ *  @param x The independent variable, T / 1000.
+ *  @param span log10(p2) - log10(p1) of the pressure contours.
+ *  @param offset log10(p) - log10(p1) of the state pressure.
+ *  @return The viscosity in units of kg/m-s.
+*/
+double Air::_fitViscosity (const uint32 index[2], double x,
+                           double span, double offset) const
+{
+    double mu[2];  // order-of-magnitude values
+
+    for (uint32 i = 0; i < 2; ++i)
+    {
+        mu[i] =   _mu_coeffs[index[i]][0]
+               + (_mu_coeffs[index[i]][1] * x)
+               + (_mu_coeffs[index[i]][2] * pow(x, 2.0))
+               + (_mu_coeffs[index[i]][3] * pow(x, 3.0))
+               + (_mu_coeffs[index[i]][4] * pow(x, 4.0))
+               + (_mu_coeffs[index[i]][5] * pow(x, 5.0));
+    }
+
+    AIR_PROFILE_MARK(STAGE_POLYNOMIAL);
+
+    // Evaluate the properties by using log-linear interpolation
+    // between the pressure intervals specified
+    double mu1 = _interpolate(span, offset, mu[0], mu[1]);
+    AIR_PROFILE_MARK(STAGE_INTERPOLATE);
+
+    // Convert viscosity from poise to kg/m-s
+    //    1000.0 = convert g -> kg
+    //    100.0  = convert cm -> m
+    double viscosity = mu1 * 100.0 / 1000.0;
+
+    AIR_PROFILE_MARK(STAGE_CONVERSION);
+
+    return viscosity;
+}
+
+/** Calculate the derived thermodynamic and transport properties
+ *  from the stored primary (curve fit) properties.
+ *
+ *  @pre The object is instantiated and the values for _pressure,
+ *       _temperature, _enthalpy, _cp, _k, _mu, and _comp have
+ *       been calculated.
+ *  @post The remaining properties are calculated with values
+ *        stored in the appropriate variables.
+ *  @return none.
+*/
+void Air::_calculateDerivedProperties (void)
+{
+    // The property set evaluators share these calculations.
+    calculateDerived<ALL_PROPERTIES>(*this);
+
+    return;
+}
@@ -84,6 +84,29 @@
 //    Simplifying type definitions
 ///////////////////////////////////////
 typedef unsigned int uint32;
+typedef unsigned long long uint64;
+
+/**
+ *  @struct AirState The hot properties of an equilibrium air state (the
+ *          first 64 bytes of Air) as a cache line aligned value type,
+ *          for large per-cell arrays that do not need the rarely used
+ *          derived properties.  Before C++17, operator new and
+ *          std::allocator only guarantee alignof(std::max_align_t), so
+ *          C++11 callers must allocate AirState arrays with an aligned
+ *          allocator (posix_memalign, aligned_alloc) for every element
+ *          to sit in one line.
+*/
+struct alignas(64) AirState
+{
+    double temperature,   // Air temperature [units: K]
+           pressure,      // Air pressure [units: MPa]
+           enthalpy,      // Air enthalpy [units: kJ/kg]
+           density,       // Air density [units: kg/m^3]
+           specificHeat,  // Specific heat [units: kJ/kg-K]
+           gamma,         // Ratio of specific heats [-dimensionless-]
+           viscosity,     // Dynamic viscosity [units: kg/m-s]
+           thermalCond;   // Thermal conductivity [units: W/m-K]
+};
 
 /**
  *  @class Air An ADT to calculate and store the thermodynamic and
@@ -122,6 +145,19 @@ class Air
     /** Default destructor.  */
     ~Air();
 
+    /******************************************************
+    **                    Operators                      **
+    ******************************************************/
+
+    /** Assignment operator.
+     *
+     *  @pre none.
+     *  @post The values of assignFrom are copied into this object.
+     *  @param assignFrom An Air object whose values are to be copied.
+     *  @return A reference to this object.
+    */
+    Air & operator= (const Air &assignFrom);
+
     /******************************************************
     **               Accessors / Mutators                **
     ******************************************************/
@@ -315,6 +351,15 @@ class Air
     */
     double getThermalDiffusivity (void) const;
 
+    /** Retrieve the hot properties of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return An AirState holding _temperature, _pressure, _enthalpy,
+     *          _density, _cp, _gamma, _mu, and _k.
+    */
+    AirState getState (void) const;
+
     ////////////////////
     //    Setters
     ////////////////////
@@ -351,24 +396,310 @@ class Air
     */
     bool calculateProps_PH (double pressure, double enthalpy);
 
+    /******************************************************
+    **                Curve Fit Rows                     **
+    ******************************************************/
+
+    /**
+     *  @struct Rows The pressure contours and coefficient rows with
+     *          which calculateProperties evaluates a state, and the
+     *          box of states that use the same ones.  Evaluators of
+     *          coherent sequences (AirStream) keep one between calls.
+    */
+    struct Rows
+    {
+        double pLower,       // Lower pressure contour [units: atm]
+               pUpper,       // Upper pressure contour [units: atm]
+               log10pLower,  // log10(pLower)
+               log10pSpan,   // log10(pUpper) - log10(pLower)
+               tLower,       // Lowest temperature (inclusive) [units: K]
+               tUpper;       // Highest temperature (exclusive) [units: K]
+        uint32 h[2],         // The rows of each table at pLower, pUpper
+               cp[2],
+               k[2],
+               mu[2],
+               z[2];
+    };
+
+    /** Look up the curve fit rows of a state.
+     *
+     *  @pre The object is instantiated.
+     *  @post rows holds the rows of the state when it uses the curve
+     *        fits; otherwise it is unchanged.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param rows The destination.
+     *  @return true The state is in range and above 500 K.
+     *  @return false The state is out of range or at or below 500 K,
+     *          where the simple relations do not use the curve fits.
+    */
+    bool getRows (double pressure, double temperature, Rows &rows) const;
+
+    /** Determine whether a state is evaluated with the given rows.
+     *
+     *  @pre rows was filled by getRows.
+     *  @post none.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param rows The rows of a previous state.
+     *  @return true calculateProperties would use exactly these rows.
+     *  @return false The state needs other rows or no rows.
+    */
+    bool hasRows (double pressure, double temperature,
+                  const Rows &rows) const;
+
+    /** Calculate the properties of air at the given pressure and
+     *  temperature with rows that were looked up before.  The results
+     *  are identical to calculateProperties(pressure, temperature).
+     *
+     *  @pre hasRows(pressure, temperature, rows).
+     *  @post The properties are calculated with values
+     *        stored in the appropriate variables.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param rows The rows of the state.
+     *  @return none.
+    */
+    void calculateProperties (double pressure, double temperature,
+                              const Rows &rows);
+
+    /** Set the state from its curve fit properties and calculate the
+     *  derived properties, for evaluators that estimate the curve fits
+     *  by other means (AirTaylorCache).
+     *
+     *  @pre The arguments are the curve fit properties of a state in
+     *       the range of calculateProperties.
+     *  @post The properties are stored in the appropriate variables.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param enthalpy The enthalpy of the state (in kJ/kg).
+     *  @param specificHeat The specific heat of the state (in kJ/kg-K).
+     *  @param thermalCond The thermal conductivity (in W/m-K).
+     *  @param viscosity The dynamic viscosity (in kg/m-s).
+     *  @param compFactor The compressibility factor.
+     *  @return none.
+    */
+    void setPrimaryProperties (double pressure, double temperature,
+                               double enthalpy, double specificHeat,
+                               double thermalCond, double viscosity,
+                               double compFactor);
+
+    /******************************************************
+    **            Compile-Time Property Sets             **
+    ******************************************************/
+
+    // Each property tag names one output of calculateProperties for
+    // Air::Evaluator (airEvaluator.h).  MASK is the bit of the property
+    // and REQUIRES adds the bits of every property it is derived from,
+    // so the tags are listed in the order of calculateDerived.
+
+    struct Enthalpy
+    {
+        static const uint32 MASK = 1u << 0, REQUIRES = MASK;
+        static double get (const Air &state);
+    };
+
+    struct SpecificHeat
+    {
+        static const uint32 MASK = 1u << 1, REQUIRES = MASK;
+        static double get (const Air &state);
+    };
+
+    struct ThermalConductivity
+    {
+        static const uint32 MASK = 1u << 2, REQUIRES = MASK;
+        static double get (const Air &state);
+    };
+
+    struct DynamicViscosity
+    {
+        static const uint32 MASK = 1u << 3, REQUIRES = MASK;
+        static double get (const Air &state);
+    };
+
+    struct CompressibilityFactor
+    {
+        static const uint32 MASK = 1u << 4, REQUIRES = MASK;
+        static double get (const Air &state);
+    };
+
+    struct MolarMass
+    {
+        static const uint32 MASK = 1u << 5,
+                            REQUIRES = MASK | CompressibilityFactor::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct GasConstant
+    {
+        static const uint32 MASK = 1u << 6,
+                            REQUIRES = MASK | MolarMass::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct Gamma
+    {
+        static const uint32 MASK = 1u << 7,
+                            REQUIRES = MASK | SpecificHeat::REQUIRES
+                                            | GasConstant::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct Density
+    {
+        static const uint32 MASK = 1u << 8,
+                            REQUIRES = MASK | GasConstant::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct InternalEnergy
+    {
+        static const uint32 MASK = 1u << 9,
+                            REQUIRES = MASK | Enthalpy::REQUIRES
+                                            | Density::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct ThermalDiffusivity
+    {
+        static const uint32 MASK = 1u << 10,
+                            REQUIRES = MASK | ThermalConductivity::REQUIRES
+                                            | SpecificHeat::REQUIRES
+                                            | Density::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct PrandtlNumber
+    {
+        static const uint32 MASK = 1u << 11,
+                            REQUIRES = MASK | DynamicViscosity::REQUIRES
+                                            | SpecificHeat::REQUIRES
+                                            | ThermalConductivity::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct KinematicViscosity
+    {
+        static const uint32 MASK = 1u << 12,
+                            REQUIRES = MASK | DynamicViscosity::REQUIRES
+                                            | Density::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct Entropy
+    {
+        static const uint32 MASK = 1u << 13,
+                            REQUIRES = MASK | SpecificHeat::REQUIRES
+                                            | GasConstant::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct SoundSpeed
+    {
+        static const uint32 MASK = 1u << 14,
+                            REQUIRES = MASK | Gamma::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct RefractionIndex
+    {
+        static const uint32 MASK = 1u << 15,
+                            REQUIRES = MASK | Density::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct GibbsFreeEnergy
+    {
+        static const uint32 MASK = 1u << 16,
+                            REQUIRES = MASK | Enthalpy::REQUIRES
+                                            | Entropy::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct HelmholtzFreeEnergy
+    {
+        static const uint32 MASK = 1u << 17,
+                            REQUIRES = MASK | InternalEnergy::REQUIRES
+                                            | Entropy::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct ChemicalPotential
+    {
+        static const uint32 MASK = 1u << 18,
+                            REQUIRES = MASK | GibbsFreeEnergy::REQUIRES
+                                            | MolarMass::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct SchmidtNumber
+    {
+        static const uint32 MASK = 1u << 19,
+                            REQUIRES = MASK | KinematicViscosity::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    struct LewisNumber
+    {
+        static const uint32 MASK = 1u << 20,
+                            REQUIRES = MASK | SchmidtNumber::REQUIRES
+                                            | PrandtlNumber::REQUIRES;
+        static double get (const Air &state);
+    };
+
+    // Shorthand for the viscosity of the transport kernels.
+    typedef DynamicViscosity Viscosity;
+
+    // Every output of calculateProperties.
+    static const uint32 ALL_PROPERTIES = (1u << 21) - 1;
+
+    /** An evaluator of the property set Properties (a list of the tags
+     *  above) that only calculates the curve fits and derived
+     *  properties those outputs need (defined in airEvaluator.h).
+    */
+    template <typename... Properties>
+    class Evaluator;
+
+    /** Calculate the derived properties of the set PROPERTIES (the
+     *  MASK bits of the property tags, closed under REQUIRES) from the
+     *  stored primary properties of an Air or AirPrecision state, in the
+     *  precision of the state (defined in airEvaluator.h).  Air and
+     *  AirPrecision share this pipeline, so they have the same outputs.
+     *
+     *  @pre The values for _pressure, _temperature, and the primary
+     *       properties in PROPERTIES of state have been calculated.
+     *  @post The derived properties in PROPERTIES are calculated with
+     *        values stored in the appropriate variables of state.
+     *  @param state An Air or AirPrecision state.
+     *  @return none.
+    */
+    template <uint32 PROPERTIES, typename State>
+    static void calculateDerived (State &state);
+
   private:
     /******************************************************
     **                     Members                       **
     ******************************************************/
+    // The hot state fills the first 64 bytes of the object (one cache
+    // line when the object is 64-byte aligned, which Air does not
+    // require); it is the part copied into an AirState.
     double _temperature,  // Air temperature [units: K]
            _pressure,     // Air pressure [units: MPa]
            _enthalpy,     // Air enthalpy [units: kJ/kg]
-           _intEnergy,    // Specific internal energy [units: kJ/kg]
            _density,      // Air density [units: kg/m^3]
            _cp,           // Specific heat [units: kJ/kg-K]
            _gamma,        // Ratio of specific heats [-dimensionless-]
-           _k,            // Thermal conductivity [units: W/m-K]
-           _pr,           // Prandtl number [-dimensionless-]
            _mu,           // Dynamic viscosity [kg/m-s]
-           _nu,           // Kinematic viscosity [m^2/s]
-           _comp,         // Compressibility factor [-dimensionless-]
+           _k;            // Thermal conductivity [units: W/m-K]
+
+    // The remaining derived properties, in decreasing order of use.
+    double _comp,         // Compressibility factor [-dimensionless-]
            _gasConstant,  // Specific gas constant [units: kJ/kg-K]
            _molarMass,    // The substance molar mass [units: kg/kgmol]
+           _intEnergy,    // Specific internal energy [units: kJ/kg]
+           _pr,           // Prandtl number [-dimensionless-]
+           _nu,           // Kinematic viscosity [m^2/s]
+           _thermalDiff,  // Thermal diffusivity (alpha) [units: m^2/s]
            _entropy,      // Air specific entropy [units: kJ/kg-K]
            _soundSpeed,   // The speed of sound of air [units: m/s]
            _refraction,   // The index of refraction of air [-dimensionless-]
@@ -376,17 +707,31 @@ class Air
            _helmholtzEn,  // The specific Helmholtz free energy [units: kJ/kg]
            _chemPoten,    // The chemical potential of air [units: kJ/kgmol]
            _schmidt,      // The Schmidt number (Sc) [-dimensionless-]
-           _lewis,        // The Lewis number (Le) [-dimensionless-]
-           _thermalDiff;  // Thermal diffusivity (alpha) [units: m^2/s]
+           _lewis;        // The Lewis number (Le) [-dimensionless-]
 
     static const double _R_univ;  // Universal gas constant [units: kJ/kgmol-K]
 
-    // These coefficients are initialized in "airCoefficients.h"
-    static const double _h_coeffs[32][5];
-    static const double _cp_coeffs[52][5];
-    static const double _k_coeffs[42][5];
-    static const double _mu_coeffs[24][6];
-    static const double _z_coeffs[32][5];
+    // These coefficients are the AirCoefficients tables of
+    // "airCoefficients.h" (bound in air.cpp)
+    static const double (&_h_coeffs)[32][5];
+    static const double (&_cp_coeffs)[52][5];
+    static const double (&_k_coeffs)[42][5];
+    static const double (&_mu_coeffs)[24][6];
+    static const double (&_z_coeffs)[32][5];
+
+    // The pressure groups and temperature breakpoints of each
+    // coefficient table (also bound in air.cpp)
+    static const uint32 (&_h_decadeRows)[8];
+    static const uint32 (&_cp_decadeRows)[8];
+    static const uint32 (&_k_decadeRows)[8];
+    static const uint32 (&_mu_decadeRows)[8];
+    static const uint32 (&_z_decadeRows)[8];
+
+    static const double (&_h_Tmin)[32];
+    static const double (&_cp_Tmin)[52];
+    static const double (&_k_Tmin)[42];
+    static const double (&_mu_Tmin)[24];
+    static const double (&_z_Tmin)[32];
 
     /******************************************************
     **                 Helper Methods                    **
@@ -397,13 +742,14 @@ class Air
      *
      *  @pre The object is instantiated.
      *  @post none.
-     *  @param p1 The smaller pressure order-of-magnitude.
-     *  @param p2 The larger pressure order-of-magnitude.
+     *  @param span log10(p2) - log10(p1) of the pressure contours p1
+     *         and p2 (in atm).
+     *  @param offset log10(p) - log10(p1) of the state pressure p.
      *  @param phi_1 The thermodynamic property at p1.
      *  @param phi_2 The thermodynamic property at p2.
      *  @return The interpolated thermodynamic property.
     */
-    double _interpolate (double p1, double p2,
+    double _interpolate (double span, double offset,
                          double phi_1, double phi_2) const;
 
     /** Determine the index of the enthalpy coefficient array
@@ -466,6 +812,51 @@ class Air
     */
     uint32 _get_z_row (double pressure, double temperature) const;
 
+    /** Determine the pressure order-of-magnitude group of the
+     *  coefficient tables.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param pressure The pressure of interest in atm.
+     *  @return The group index (0 for 10^-4 atm through 6 for 10^2 atm).
+    */
+    uint32 _getDecade (double pressure) const;
+
+    /** Determine the index of a coefficient array based on the
+     *  pressure and temperature.
+     *
+     *  @pre The object is instantiated and
+     *       10E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param decadeRows The first row of each pressure group of the
+     *         table followed by the table length.
+     *  @param Tmin The lower temperature limit of each row in K.
+     *  @param pressure The order-of-magnitude of the pressure of interest.
+     *  @param temperature The temperature of the state in K.
+     *  @return An index into the coefficient array.
+    */
+    uint32 _getRow (const uint32 decadeRows[8], const double Tmin[],
+                    double pressure, double temperature) const;
+
+    /** Determine the temperature interval in which a row of a
+     *  coefficient array applies.
+     *
+     *  @pre row was returned by _getRow for the same table and pressure.
+     *  @post none.
+     *  @param decadeRows The first row of each pressure group of the
+     *         table followed by the table length.
+     *  @param Tmin The lower temperature limit of each row in K.
+     *  @param pressure The order-of-magnitude of the pressure of interest.
+     *  @param row The index into the coefficient array.
+     *  @param tLower The lowest temperature of the row in K (inclusive).
+     *  @param tUpper The highest temperature of the row in K (exclusive,
+     *         except for the last row of a group, which ends at 30000 K).
+     *  @return none.
+    */
+    void _getRowBand (const uint32 decadeRows[8], const double Tmin[],
+                      double pressure, uint32 row,
+                      double &tLower, double &tUpper) const;
+
     /** Determine the upper and lower order of magnitudes
      *  based on the input pressure.
      *
@@ -534,26 +925,82 @@ class Air
     */
     double _calculateViscosity (double pressure, double temperature) const;
 
-    /** Calculate the entropy of the state using the stored pressure,
-     *  temperature, specific heat, and gas constant.
+    /** Evaluate the enthalpy curve fit with the given rows.
      *
-     *  @pre The object is instantited and the values for _pressure,
-     *       _temperature, _gasConstant, and _cp have been calculated.
+     *  @pre The object is instantiated and 500 < T <= 30000 K.
      *  @post none.
-     *  @return A double precision value containing the calculated
-     *          entropy value [units: kJ/kg-K].
+     *  @param index The rows at the lower and upper pressure contours.
+     *  @param x The independent variable, ln(T / 10000).
+     *  @param span log10(p2) - log10(p1) of the pressure contours.
+     *  @param offset log10(p) - log10(p1) of the state pressure.
+     *  @return The enthalpy in units of kJ/kg.
     */
-    double _calculateEntropy (void) const;
+    double _fitEnthalpy (const uint32 index[2], double x,
+                         double span, double offset) const;
 
-    /** Calculate the refractive index of air using the calculated density.
+    /** Evaluate the specific heat curve fit with the given rows.
      *
-     *  @pre The object is instantiated and the value for _density
-     *       has been computed.
+     *  @pre The object is instantiated and 500 < T <= 30000 K.
      *  @post none.
-     *  @return A double precision value for the calculated index of
-     *          refraction of air [-dimensionless-].
+     *  @param index The rows at the lower and upper pressure contours.
+     *  @param x The independent variable, ln(T / 10000).
+     *  @param span log10(p2) - log10(p1) of the pressure contours.
+     *  @param offset log10(p) - log10(p1) of the state pressure.
+     *  @return The specific heat in units of kJ/kg-K.
+    */
+    double _fitSpecificHeat (const uint32 index[2], double x,
+                             double span, double offset) const;
+
+    /** Evaluate the thermal cond. curve fit with the given rows.
+     *
+     *  @pre The object is instantiated and 500 < T <= 30000 K.
+     *  @post none.
+     *  @param index The rows at the lower and upper pressure contours.
+     *  @param x The independent variable, ln(T / 10000).
+     *  @param span log10(p2) - log10(p1) of the pressure contours.
+     *  @param offset log10(p) - log10(p1) of the state pressure.
+     *  @return The thermal conductivity in units of W/m-K.
+    */
+    double _fitThermalCond (const uint32 index[2], double x,
+                            double span, double offset) const;
+
+    /** Evaluate the compressibility curve fit with the given rows.
+     *
+     *  @pre The object is instantiated and 500 < T <= 30000 K.
+     *  @post none.
+     *  @param index The rows at the lower and upper pressure contours.
+     *  @param x The independent variable, T / 1000.
+     *  @param span log10(p2) - log10(p1) of the pressure contours.
+     *  @param offset log10(p) - log10(p1) of the state pressure.
+     *  @return The compressibility factor.
+    */
+    double _fitCompFactor (const uint32 index[2], double x,
+                           double span, double offset) const;
+
+    /** Evaluate the viscosity curve fit with the given rows.
+     *
+     *  @pre The object is instantiated and 500 < T <= 30000 K.
+     *  @post none.
+     *  @param index The rows at the lower and upper pressure contours.
+     *  @param x The independent variable, T / 1000.
+     *  @param span log10(p2) - log10(p1) of the pressure contours.
+     *  @param offset log10(p) - log10(p1) of the state pressure.
+     *  @return The viscosity in units of kg/m-s.
+    */
+    double _fitViscosity (const uint32 index[2], double x,
+                          double span, double offset) const;
+
+    /** Calculate the derived thermodynamic and transport properties
+     *  from the stored primary (curve fit) properties.
+     *
+     *  @pre The object is instantiated and the values for _pressure,
+     *       _temperature, _enthalpy, _cp, _k, _mu, and _comp have
+     *       been calculated.
+     *  @post The remaining properties are calculated with values
+     *        stored in the appropriate variables.
+     *  @return none.
     */
-    double _calculateRefractionIndex (void) const;
+    void _calculateDerivedProperties (void);
 
 };  // end class Air
 
@@ -0,0 +1,362 @@
+/******************************************************************************
+||  airAsync.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Asynchronous batch evaluation for the equilibrium air ADT.  Batches    ||
+||    of (P, T) or (P, h) pairs are submitted to a background thread pool    ||
+||    and evaluated in place into caller-owned buffers; completion is        ||
+||    reported through a std::future, a callback, or (in C++20) a co_await   ||
+||    expression, so property evaluation can overlap other work.             ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airAsync.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airAsync.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airAsync.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/******************************************************
+**                  Pool Internals                   **
+******************************************************/
+
+/**
+ *  @struct AirAsyncJob One submission: its buffers, the chunks still
+ *          running, and how completion is reported.
+*/
+struct AirAsyncJob
+{
+    AirBatch batch;
+    uint32 input;
+    const double *states;
+    double *values;
+    unsigned char *valid;
+    std::atomic<size_t> remaining,     // Chunks not yet evaluated
+                        evaluated;     // Non-NaN states so far
+    bool usePromise;
+    std::promise<size_t> promise;
+    AirAsync::Callback done;
+
+    AirAsyncJob (const AirBatch &columns)
+      : batch(columns), remaining(0), evaluated(0), usePromise(false)
+    {}
+
+    /** Deliver the result (called once, by the last chunk).  */
+    void complete (void)
+    {
+        if (usePromise)
+            promise.set_value(evaluated.load());
+        else
+            done(evaluated.load());
+    }
+};
+
+/**
+ *  @struct AirAsync::Pool The threads and the queue of chunks.
+*/
+struct AirAsync::Pool
+{
+    /** A range of states of one job.  */
+    struct Chunk
+    {
+        std::shared_ptr<AirAsyncJob> job;
+        size_t first,
+               count;
+    };
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable work,      // A chunk was queued (or stop)
+                            idle;      // pending dropped to zero
+    std::deque<Chunk> chunks;
+    size_t pending;                    // Jobs not yet completed
+    bool stop;
+
+    Pool() : pending(0), stop(false) {}
+
+    /** Split a job into chunks and queue them.  */
+    void enqueue (const std::shared_ptr<AirAsyncJob> &job, size_t count,
+                  size_t grain)
+    {
+        // At least one chunk per thread when the batch allows, but no
+        // chunk so small that the queue overhead shows.
+        size_t perThread = (count + threads.size() - 1) / threads.size(),
+               size = std::max<size_t>(1, std::min(grain,
+                                       std::max<size_t>(32, perThread))),
+               n = (count + size - 1) / size;
+
+        job->remaining = n;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (size_t first = 0; first < count; first += size)
+        {
+            Chunk chunk;
+            chunk.job = job;
+            chunk.first = first;
+            chunk.count = std::min(size, count - first);
+            chunks.push_back(chunk);
+        }
+
+        ++pending;
+
+        if (n == 1)
+            work.notify_one();
+        else
+            work.notify_all();
+    }
+
+    /** Pool thread: evaluate chunks until stopped.  */
+    void run (void)
+    {
+        for (;;)
+        {
+            Chunk chunk;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work.wait(lock, [this] { return stop || !chunks.empty(); });
+
+                if (chunks.empty())
+                    return;
+
+                chunk = chunks.front();
+                chunks.pop_front();
+            }
+
+            AirAsyncJob &job = *chunk.job;
+            size_t columns = job.batch.getNumColumns();
+
+            job.evaluated += job.batch.evaluate(job.input,
+                                 job.states + 2 * chunk.first, chunk.count,
+                                 job.values + chunk.first * columns,
+                                 job.valid ? job.valid + chunk.first : NULL);
+
+            if (job.remaining.fetch_sub(1) == 1)
+            {
+                job.complete();
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (--pending == 0)
+                    idle.notify_all();
+            }
+        }
+    }
+};
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (one thread per hardware thread).  */
+AirAsync::AirAsync()
+  : _pool(new Pool()), _grain(1024)
+{  _start(0);  }
+
+/** Initialization constructor.
+ *
+ *  @pre none.
+ *  @post The pool threads are started.
+ *  @param threads The number of pool threads (0: one per hardware
+ *         thread).
+ *  @param grain The largest number of states in one chunk.
+*/
+AirAsync::AirAsync (uint32 threads, size_t grain)
+  : _pool(new Pool()), _grain(grain ? grain : 1)
+{  _start(threads);  }
+
+/** Default destructor (waits for every submission).  */
+AirAsync::~AirAsync()
+{
+    wait();
+
+    {
+        std::lock_guard<std::mutex> lock(_pool->mutex);
+        _pool->stop = true;
+        _pool->work.notify_all();
+    }
+
+    for (size_t i = 0; i < _pool->threads.size(); ++i)
+        _pool->threads[i].join();
+
+    delete _pool;
+}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Retrieve the number of pool threads.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The thread count.
+*/
+uint32 AirAsync::getThreads (void) const
+{  return uint32(_pool->threads.size());  }
+
+/** Retrieve the largest number of states in one chunk.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _grain.
+*/
+size_t AirAsync::getGrain (void) const
+{  return _grain;  }
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Submit a batch; the result is delivered through a future.
+ *
+ *  @pre The buffers satisfy AirBatch::evaluate() and outlive the
+ *       submission.
+ *  @post The batch is queued.
+ *  @param batch The output columns (copied).
+ *  @param input AirBatch::INPUT_PT or AirBatch::INPUT_PH.
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional per-state flags (see AirBatch).
+ *  @return A future of the number of evaluated states.
+*/
+std::future<size_t> AirAsync::submit (const AirBatch &batch, uint32 input,
+                                      const double *states, size_t count,
+                                      double *values, unsigned char *valid)
+{
+    std::shared_ptr<AirAsyncJob> job(new AirAsyncJob(batch));
+
+    job->input = input;
+    job->states = states;
+    job->values = values;
+    job->valid = valid;
+    job->usePromise = true;
+
+    std::future<size_t> result = job->promise.get_future();
+
+    if (count == 0)
+        job->promise.set_value(0);
+    else
+        _pool->enqueue(job, count, _grain);
+
+    return result;
+}
+
+/** Submit a batch; the result is delivered to a callback.
+ *
+ *  @pre As for the future form; done does not throw.
+ *  @post The batch is queued.
+ *  @param batch The output columns (copied).
+ *  @param input AirBatch::INPUT_PT or AirBatch::INPUT_PH.
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional per-state flags (or NULL).
+ *  @param done Called once on a pool thread after the last row is
+ *         written (immediately, on this thread, when count is 0).
+ *  @return none.
+*/
+void AirAsync::submit (const AirBatch &batch, uint32 input,
+                       const double *states, size_t count, double *values,
+                       unsigned char *valid, const Callback &done)
+{
+    if (count == 0)
+    {
+        done(0);
+        return;
+    }
+
+    std::shared_ptr<AirAsyncJob> job(new AirAsyncJob(batch));
+
+    job->input = input;
+    job->states = states;
+    job->values = values;
+    job->valid = valid;
+    job->done = done;
+
+    _pool->enqueue(job, count, _grain);
+    return;
+}
+
+/** Wait until every submission so far has completed.
+ *
+ *  @pre Not called from a callback.
+ *  @post No submission is pending.
+ *  @return none.
+*/
+void AirAsync::wait (void)
+{
+    std::unique_lock<std::mutex> lock(_pool->mutex);
+    _pool->idle.wait(lock, [this] { return _pool->pending == 0; });
+
+    return;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Start the pool threads.
+ *
+ *  @pre _pool holds no threads.
+ *  @post threads (or one per hardware thread) threads are running.
+ *  @param threads The requested number of threads.
+ *  @return none.
+*/
+void AirAsync::_start (uint32 threads)
+{
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (uint32 i = 0; i < threads; ++i)
+        _pool->threads.push_back(std::thread(&Pool::run, _pool));
+
+    return;
+}
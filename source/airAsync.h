@@ -0,0 +1,253 @@
+/******************************************************************************
+||  airAsync.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Asynchronous batch evaluation for the equilibrium air ADT.  Batches    ||
+||    of (P, T) or (P, h) pairs are submitted to a background thread pool    ||
+||    and evaluated in place into caller-owned buffers; completion is        ||
+||    reported through a std::future, a callback, or (in C++20) a co_await   ||
+||    expression, so property evaluation can overlap other work.             ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airAsync.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airAsync.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_ASYNC_H
+#define _GH_DEF_AIR_ASYNC_H
+
+#include "airBatch.h"
+
+#include <functional>
+#include <future>
+
+// The awaitable is only declared for C++20 coroutine compilers; the
+// library itself is built without it.
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#include <coroutine>
+#define AIR_ASYNC_COROUTINES
+#endif
+
+/**
+ *  @class AirAsync A thread pool that evaluates AirBatch submissions in
+ *         the background.
+ *
+ *  A submission names caller-owned buffers: the input pairs and the
+ *  output rows (and optional valid flags) are used in place and must
+ *  stay alive, and untouched by the caller, until the submission
+ *  completes.  Large submissions are split into chunks of grain states
+ *  that the pool threads evaluate in parallel; the completion (future,
+ *  callback, or coroutine resumption) happens once, on the pool thread
+ *  that finishes the last chunk, and reports the number of evaluated
+ *  (non-NaN) states.  Callbacks and resumed coroutines run on a pool
+ *  thread, so they should be short and must not throw.
+ *
+ *  The destructor completes every submission before joining the
+ *  threads.
+*/
+class AirAsync
+{
+  public:
+    /** A completion callback; receives the number of evaluated states.  */
+    typedef std::function<void (size_t)> Callback;
+
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (one thread per hardware thread).  */
+    AirAsync();
+
+    /** Initialization constructor.
+     *
+     *  @pre none.
+     *  @post The pool threads are started.
+     *  @param threads The number of pool threads (0: one per hardware
+     *         thread).
+     *  @param grain The largest number of states in one chunk.
+    */
+    AirAsync (uint32 threads, size_t grain = 1024);
+
+    /** Default destructor (waits for every submission).  */
+    ~AirAsync();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Retrieve the number of pool threads.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The thread count.
+    */
+    uint32 getThreads (void) const;
+
+    /** Retrieve the largest number of states in one chunk.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _grain.
+    */
+    size_t getGrain (void) const;
+
+    /******************************************************
+    **                 Public Methods                    **
+    ******************************************************/
+
+    /** Submit a batch; the result is delivered through a future.
+     *
+     *  @pre The buffers satisfy AirBatch::evaluate() and outlive the
+     *       submission.
+     *  @post The batch is queued.
+     *  @param batch The output columns (copied).
+     *  @param input AirBatch::INPUT_PT or AirBatch::INPUT_PH.
+     *  @param states The interleaved input pairs.
+     *  @param count The number of states.
+     *  @param values The destination rows.
+     *  @param valid Optional per-state flags (see AirBatch).
+     *  @return A future of the number of evaluated states.
+    */
+    std::future<size_t> submit (const AirBatch &batch, uint32 input,
+                                const double *states, size_t count,
+                                double *values,
+                                unsigned char *valid = NULL);
+
+    /** Submit a batch; the result is delivered to a callback.
+     *
+     *  @pre As for the future form; done does not throw.
+     *  @post The batch is queued.
+     *  @param batch The output columns (copied).
+     *  @param input AirBatch::INPUT_PT or AirBatch::INPUT_PH.
+     *  @param states The interleaved input pairs.
+     *  @param count The number of states.
+     *  @param values The destination rows.
+     *  @param valid Optional per-state flags (or NULL).
+     *  @param done Called once on a pool thread after the last row is
+     *         written (immediately, on this thread, when count is 0).
+     *  @return none.
+    */
+    void submit (const AirBatch &batch, uint32 input, const double *states,
+                 size_t count, double *values, unsigned char *valid,
+                 const Callback &done);
+
+    /** Wait until every submission so far has completed.
+     *
+     *  @pre Not called from a callback.
+     *  @post No submission is pending.
+     *  @return none.
+    */
+    void wait (void);
+
+#ifdef AIR_ASYNC_COROUTINES
+    /**
+     *  @class Awaiter The awaitable of evaluate(): co_await submits the
+     *         batch, suspends, and resumes on the pool thread that
+     *         completes it with the number of evaluated states.
+    */
+    class Awaiter
+    {
+      public:
+        Awaiter (AirAsync &pool, const AirBatch &batch, uint32 input,
+                 const double *states, size_t count, double *values,
+                 unsigned char *valid)
+          : _pool(pool), _batch(batch), _input(input), _states(states),
+            _count(count), _values(values), _valid(valid), _evaluated(0)
+        {}
+
+        bool await_ready (void) const noexcept
+        {  return _count == 0;  }
+
+        void await_suspend (std::coroutine_handle<> handle)
+        {
+            _pool.submit(_batch, _input, _states, _count, _values, _valid,
+                         [this, handle] (size_t evaluated)
+                         {
+                             _evaluated = evaluated;
+                             handle.resume();
+                         });
+        }
+
+        size_t await_resume (void) const noexcept
+        {  return _evaluated;  }
+
+      private:
+        AirAsync &_pool;
+        const AirBatch &_batch;
+        uint32 _input;
+        const double *_states;
+        size_t _count;
+        double *_values;
+        unsigned char *_valid;
+        size_t _evaluated;
+    };
+
+    /** Evaluate a batch with co_await (C++20).
+     *
+     *  @pre As for submit(); batch outlives the co_await.
+     *  @post none.
+     *  @return The awaitable; co_await yields the evaluated count.
+    */
+    Awaiter evaluate (const AirBatch &batch, uint32 input,
+                      const double *states, size_t count, double *values,
+                      unsigned char *valid = NULL)
+    {  return Awaiter(*this, batch, input, states, count, values, valid);  }
+#endif
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    struct Pool;              // Threads, queue, and pending count
+    Pool *_pool;
+    size_t _grain;            // Largest number of states per chunk
+
+    /** Start the pool threads.  */
+    void _start (uint32 threads);
+
+    // Not copyable.
+    AirAsync (const AirAsync &);
+    AirAsync & operator= (const AirAsync &);
+
+};  // end class AirAsync
+
+#endif
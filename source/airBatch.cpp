@@ -0,0 +1,957 @@
+/******************************************************************************
+||  airBatch.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Batch evaluation of the equilibrium air ADT.  A batch is an array of   ||
+||    (pressure, temperature) or (pressure, enthalpy) pairs; the selected    ||
+||    property columns of every state are written to a caller-owned          ||
+||    row-major array, with NaN rows for the states that cannot be           ||
+||    evaluated.  The streaming tools and servers build on this interface.   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airBatch.h                                                             ||
+||    airCoefficients.h                                                      ||
+||    airPrecision.h                                                         ||
+||    airStream.h                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airBatch.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+#include "airCoefficients.h"
+#include "airPrecision.h"
+#include "airStream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// The enthalpy of the first guess T = h / 1.005 at the top of the range.
+const double AirBatch::MAX_PH_ENTHALPY = 1.005 * 30000.0;   // [kJ/kg]
+
+// States hashed together by the duplicate detection; duplicates in
+// different blocks are evaluated once per block.  The hash table has at
+// least two slots per state (a power of two), at most 512 kB, which stays
+// in the L2 cache; smaller batches get a table of their own size.
+static const size_t COALESCE_BLOCK = 65536;
+static const uint32 COALESCE_MIN_BITS = 4;       // log2 of the least slots
+
+// States binned together by the regime schedule.
+static const size_t SCHEDULE_BLOCK = 65536;
+
+// A block is sorted only when more than 1 in SCHEDULE_COHERENT
+// neighbouring states change regime; a more coherent block already
+// reuses its rows through an AirStream in input order.
+static const size_t SCHEDULE_COHERENT = 16;
+
+// The shortcut, two bands per coefficient row, and out of range.
+static_assert(AirBatch::NUM_REGIMES
+              == 2 + 2 * (  sizeof(AirCoefficients::hCoeffs)
+                            / sizeof(AirCoefficients::hCoeffs[0])
+                          + sizeof(AirCoefficients::cpCoeffs)
+                            / sizeof(AirCoefficients::cpCoeffs[0])
+                          + sizeof(AirCoefficients::kCoeffs)
+                            / sizeof(AirCoefficients::kCoeffs[0])
+                          + sizeof(AirCoefficients::muCoeffs)
+                            / sizeof(AirCoefficients::muCoeffs[0])
+                          + sizeof(AirCoefficients::zCoeffs)
+                            / sizeof(AirCoefficients::zCoeffs[0])),
+              "NUM_REGIMES does not match the coefficient tables");
+
+/**
+ *  @class StreamState An Air state evaluated through an AirStream, so
+ *         that the states of one regime reuse its coefficient rows.
+*/
+class StreamState : public Air
+{
+  public:
+    bool calculateProperties (double pressure, double temperature)
+    {  return _stream.calculateProperties(pressure, temperature, *this);  }
+
+  private:
+    AirStream _stream;
+};
+
+/******************************************************
+**                 Helper Functions                  **
+******************************************************/
+
+/** Evaluate a batch of states with the evaluator State in the
+ *  precision Real.
+ *
+ *  @pre states holds 2 * count values and values has room for
+ *       count * numColumns values.
+ *  @post The property rows are written to values.
+ *  @param columns The property of each output column.
+ *  @param numColumns The number of output columns.
+ *  @param input The meaning of the second member of each pair
+ *         (INPUT_PT or INPUT_PH).
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional; receives 1 for each evaluated state and
+ *         0 for each NaN row.
+ *  @return The number of states that were evaluated.
+*/
+template <typename State, typename Real>
+static size_t evaluateRows (const uint32 *columns, uint32 numColumns,
+                            uint32 input, const Real *states, size_t count,
+                            Real *values, unsigned char *valid)
+{
+    const Real NaN = std::numeric_limits<Real>::quiet_NaN();
+    const Real maxSecond = (input == AirBatch::INPUT_PH) ?
+        Real(AirBatch::MAX_PH_ENTHALPY) : std::numeric_limits<Real>::max();
+
+    State state;
+    size_t evaluated = 0;
+
+    for (size_t i = 0; i < count; ++i, values += numColumns)
+    {
+        Real pressure = states[2 * i],
+             second = states[2 * i + 1];
+
+        // The range checks of the ADT pass NaN, so non-finite inputs
+        // are rejected here.
+        bool ok = (pressure - pressure == Real(0)) &&
+                  (second - second == Real(0)) && (second <= maxSecond);
+
+        if (ok)
+        {
+            ok = (input == AirBatch::INPUT_PH) ?
+                 state.calculateProps_PH(pressure, second) :
+                 state.calculateProperties(pressure, second);
+        }
+
+        if (valid)
+            valid[i] = ok ? 1 : 0;
+
+        if (!ok)
+        {
+            for (uint32 c = 0; c < numColumns; ++c)
+                values[c] = NaN;
+
+            continue;
+        }
+
+        ++evaluated;
+
+        for (uint32 c = 0; c < numColumns; ++c)
+        {
+            switch (columns[c])
+            {
+              case AirBatch::PRESSURE:
+                values[c] = state.getPressure();  break;
+              case AirBatch::TEMPERATURE:
+                values[c] = state.getTemperature();  break;
+              case AirBatch::ENTHALPY:
+                values[c] = state.getEnthalpy();  break;
+              case AirBatch::SPECIFIC_HEAT:
+                values[c] = state.getSpecificHeat();  break;
+              case AirBatch::GAMMA:
+                values[c] = state.getGamma();  break;
+              case AirBatch::DENSITY:
+                values[c] = state.getDensity();  break;
+              case AirBatch::ENTROPY:
+                values[c] = state.getEntropy();  break;
+              case AirBatch::SOUND_SPEED:
+                values[c] = state.getSoundSpeed();  break;
+              case AirBatch::THERMAL_COND:
+                values[c] = state.getThermalConductivity();  break;
+              case AirBatch::VISCOSITY:
+                values[c] = state.getDynamicViscosity();  break;
+              case AirBatch::PRANDTL:
+                values[c] = state.getPrandtlNumber();  break;
+              default:
+                values[c] = state.getCompressibilityFactor();  break;
+            }
+        }
+    }
+
+    return evaluated;
+}
+
+/** Evaluate a batch of (pressure, temperature) pairs bin by bin.  Each
+ *  block of SCHEDULE_BLOCK states is binned by AirBatch::regime with a
+ *  stable counting sort, the binned pairs are gathered and evaluated
+ *  through one AirStream (which loads the rows of each bin once), and
+ *  the rows are scattered back to input order.  A block whose
+ *  neighbouring states seldom change regime skips the sort and is
+ *  evaluated through the AirStream in input order.  AirStream matches
+ *  Air bit for bit, so the rows do not depend on the order.
+ *
+ *  @pre As evaluateRows.
+ *  @post The property rows are written to values.
+ *  @param columns The property of each output column.
+ *  @param numColumns The number of output columns.
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional; receives 1 for each evaluated state and
+ *         0 for each NaN row.
+ *  @return The number of states that were evaluated.
+*/
+static size_t scheduleRows (const uint32 *columns, uint32 numColumns,
+                            const double *states, size_t count,
+                            double *values, unsigned char *valid)
+{
+    // The sort buffers are only allocated once a block needs them.
+    size_t capacity = std::min(count, SCHEDULE_BLOCK);
+    std::vector<uint32> keys(capacity),    // Regime of each state
+                        order;             // State of each sorted slot
+    std::vector<double> pairs,
+                        rows;
+    std::vector<unsigned char> ok;
+
+    size_t evaluated = 0;
+
+    for (size_t first = 0; first < count; first += SCHEDULE_BLOCK)
+    {
+        size_t block = std::min(SCHEDULE_BLOCK, count - first);
+        const double *in = states + 2 * first;
+        uint32 start[AirBatch::NUM_REGIMES + 1] = { 0 };
+
+        size_t changes = 0;
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            keys[i] = AirBatch::regime(in[2 * i], in[2 * i + 1]);
+            ++start[keys[i] + 1];
+            changes += (i > 0) && (keys[i] != keys[i - 1]);
+        }
+
+        if (changes * SCHEDULE_COHERENT <= block)
+        {
+            double *out = values + first * numColumns;
+
+            evaluated += evaluateRows<StreamState>(columns, numColumns,
+                                                   AirBatch::INPUT_PT, in,
+                                                   block, out, valid ?
+                                                   valid + first : NULL);
+            continue;
+        }
+
+        if (order.empty())
+        {
+            order.resize(capacity);
+            pairs.resize(2 * capacity);
+            rows.resize(capacity * numColumns);
+            ok.resize(capacity);
+        }
+
+        for (uint32 r = 0; r < AirBatch::NUM_REGIMES; ++r)
+            start[r + 1] += start[r];
+
+        for (size_t i = 0; i < block; ++i)
+            order[start[keys[i]]++] = uint32(i);
+
+        for (size_t k = 0; k < block; ++k)
+        {
+            pairs[2 * k] = in[2 * order[k]];
+            pairs[2 * k + 1] = in[2 * order[k] + 1];
+        }
+
+        evaluated += evaluateRows<StreamState>(columns, numColumns,
+                                               AirBatch::INPUT_PT, &pairs[0],
+                                               block, &rows[0], &ok[0]);
+
+        for (size_t k = 0; k < block; ++k)
+        {
+            size_t i = first + order[k];
+            const double *row = &rows[k * numColumns];
+
+            for (uint32 c = 0; c < numColumns; ++c)
+                values[i * numColumns + c] = row[c];
+
+            if (valid)
+                valid[i] = ok[k];
+        }
+    }
+
+    return evaluated;
+}
+
+/** Evaluate a batch of states in double precision in the selected
+ *  order (the regime schedule applies to INPUT_PT).
+ *
+ *  @pre As evaluateRows.
+ *  @post The property rows are written to values.
+ *  @param schedule The Schedule.
+ *  @return The number of states that were evaluated.
+*/
+static size_t orderedRows (uint32 schedule, const uint32 *columns,
+                           uint32 numColumns, uint32 input,
+                           const double *states, size_t count,
+                           double *values, unsigned char *valid)
+{
+    if (   (schedule == AirBatch::SCHEDULE_REGIME)
+        && (input == AirBatch::INPUT_PT))
+        return scheduleRows(columns, numColumns, states, count, values,
+                            valid);
+
+    return evaluateRows<Air>(columns, numColumns, input, states, count,
+                             values, valid);
+}
+
+/** Evaluate a batch of states in single precision, in input order.
+ *
+ *  @pre As evaluateRows.
+ *  @post The property rows are written to values.
+ *  @param schedule Unused; AirFloat has no cached-row evaluator.
+ *  @return The number of states that were evaluated.
+*/
+static size_t orderedRows (uint32 /* schedule */, const uint32 *columns,
+                           uint32 numColumns, uint32 input,
+                           const float *states, size_t count,
+                           float *values, unsigned char *valid)
+{
+    return evaluateRows<AirFloat>(columns, numColumns, input, states,
+                                  count, values, valid);
+}
+
+/** The comparison bits of an input, rounded to the nearest multiple of
+ *  2^drop units in the last place (which keeps the relative spacing of
+ *  the mantissa bits that are not dropped).
+ *
+ *  @pre drop < 52.
+ *  @post none.
+ *  @param value The input.
+ *  @param drop The number of low mantissa bits that are rounded off.
+ *  @return The bits of the rounded value.
+*/
+static inline uint64 coalesceBits (double value, uint32 drop)
+{
+    uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    if (drop)
+        bits = (bits + (uint64(1) << (drop - 1))) & ~((uint64(1) << drop) - 1);
+
+    return bits;
+}
+
+/** The comparison bits of a single precision input.
+ *
+ *  @pre drop < 23.
+ *  @post none.
+ *  @param value The input.
+ *  @param drop The number of low mantissa bits that are rounded off.
+ *  @return The bits of the rounded value.
+*/
+static inline uint64 coalesceBits (float value, uint32 drop)
+{
+    uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    if (drop)
+        bits = (bits + (uint32(1) << (drop - 1))) & ~((uint32(1) << drop) - 1);
+
+    return bits;
+}
+
+/** The number of mantissa bits dropped by the duplicate detection.
+ *
+ *  @pre quantum is in (0, 1) for COALESCE_QUANTIZED.
+ *  @post none.
+ *  @param mode The Coalesce mode.
+ *  @param quantum The relative quantum of COALESCE_QUANTIZED.
+ *  @param mantissaBits The mantissa bits of the precision (52 or 23).
+ *  @return The bits to be dropped (0 for an exact comparison).
+*/
+static uint32 coalesceDrop (uint32 mode, double quantum,
+                            uint32 mantissaBits)
+{
+    if (mode != AirBatch::COALESCE_QUANTIZED)
+        return 0;
+
+    // Keep the mantissa bits finer than the quantum.
+    double keep = std::ceil(-std::log2(quantum));
+
+    if (keep >= mantissaBits)
+        return 0;
+
+    return mantissaBits - uint32(std::max(keep, 0.0));
+}
+
+/** Evaluate a batch of states once per distinct input pair.  Each block
+ *  of COALESCE_BLOCK states is hashed (after skipping runs of equal
+ *  pairs), the distinct pairs are gathered and evaluated in the
+ *  selected order, and the rows are scattered back to every state.
+ *
+ *  @pre As evaluateRows.
+ *  @post The property rows are written to values.
+ *  @param columns The property of each output column.
+ *  @param numColumns The number of output columns.
+ *  @param input The meaning of the second member of each pair
+ *         (INPUT_PT or INPUT_PH).
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional; receives 1 for each evaluated state and
+ *         0 for each NaN row.
+ *  @param drop The mantissa bits dropped before the comparison.
+ *  @param schedule The Schedule of the distinct pairs.
+ *  @return The number of states that were evaluated.
+*/
+template <typename Real>
+static size_t coalesceRows (const uint32 *columns, uint32 numColumns,
+                            uint32 input, const Real *states, size_t count,
+                            Real *values, unsigned char *valid,
+                            uint32 drop, uint32 schedule)
+{
+    // A single state has nothing to share its row with.
+    if (count < 2)
+        return orderedRows(schedule, columns, numColumns, input, states,
+                           count, values, valid);
+
+    // The table is sized for the largest block of this batch.
+    size_t capacity = std::min(count, COALESCE_BLOCK);
+    uint32 bits = COALESCE_MIN_BITS;
+
+    while ((size_t(1) << bits) < 2 * capacity)
+        ++bits;
+
+    const size_t mask = (size_t(1) << bits) - 1;
+    const uint32 shift = 64 - bits;
+
+    std::vector<uint32> table(mask + 1),         // Distinct pair + 1
+                        distinct(capacity),      // Pair of each state
+                        filled;                  // Occupied slots
+    std::vector<uint64> keys;                    // Bits of each pair
+    std::vector<Real> pairs, rows;               // Gathered pairs, rows
+    std::vector<unsigned char> ok;               // Row of each pair valid
+
+    filled.reserve(capacity);
+    keys.reserve(2 * capacity);
+    pairs.reserve(2 * capacity);
+
+    size_t evaluated = 0;
+
+    for (size_t first = 0; first < count; first += COALESCE_BLOCK)
+    {
+        size_t block = std::min(COALESCE_BLOCK, count - first);
+        const Real *in = states + 2 * first;
+
+        // Only the slots of the previous block are cleared.
+        for (size_t k = 0; k < filled.size(); ++k)
+            table[filled[k]] = 0;
+
+        filled.clear();
+        keys.clear();
+        pairs.clear();
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            uint64 p = coalesceBits(in[2 * i], drop),
+                   t = coalesceBits(in[2 * i + 1], drop);
+
+            // Runs of equal pairs skip the hash table.
+            if (i && (p == keys[2 * distinct[i - 1]])
+                  && (t == keys[2 * distinct[i - 1] + 1]))
+            {
+                distinct[i] = distinct[i - 1];
+                continue;
+            }
+
+            // Multiplicative hashing with linear probing; the table is
+            // at most half full.
+            size_t slot = size_t(((p * 0x9E3779B97F4A7C15ULL)
+                                  ^ (t * 0xC2B2AE3D27D4EB4FULL)) >> shift);
+
+            for (;; slot = (slot + 1) & mask)
+            {
+                uint32 entry = table[slot];
+
+                if (entry == 0)
+                {
+                    entry = uint32(keys.size() / 2 + 1);
+                    table[slot] = entry;
+                    filled.push_back(uint32(slot));
+
+                    keys.push_back(p);
+                    keys.push_back(t);
+                    pairs.push_back(in[2 * i]);
+                    pairs.push_back(in[2 * i + 1]);
+                }
+                else if ((keys[2 * (entry - 1)] != p)
+                         || (keys[2 * (entry - 1) + 1] != t))
+                    continue;
+
+                distinct[i] = entry - 1;
+                break;
+            }
+        }
+
+        size_t numDistinct = pairs.size() / 2;
+
+        rows.resize(numDistinct * numColumns);
+        ok.resize(numDistinct);
+
+        orderedRows(schedule, columns, numColumns, input, &pairs[0],
+                    numDistinct, &rows[0], &ok[0]);
+
+        Real *out = values + first * numColumns;
+
+        for (size_t i = 0; i < block; ++i, out += numColumns)
+        {
+            const Real *row = &rows[distinct[i] * numColumns];
+
+            for (uint32 c = 0; c < numColumns; ++c)
+                out[c] = row[c];
+
+            if (valid)
+                valid[first + i] = ok[distinct[i]];
+
+            evaluated += ok[distinct[i]];
+        }
+    }
+
+    return evaluated;
+}
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (every property, in enum order).  */
+AirBatch::AirBatch()
+  : _numColumns(NUM_PROPERTIES), _coalesce(COALESCE_NONE), _quantum(0.0),
+    _schedule(SCHEDULE_INPUT)
+{
+    for (uint32 i = 0; i < NUM_PROPERTIES; ++i)
+        _columns[i] = i;
+}
+
+/** Copy constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created from the copied values.
+ *  @param copyFrom An AirBatch object whose columns are copied.
+ *  @return none.
+*/
+AirBatch::AirBatch (const AirBatch &copyFrom)
+  : _numColumns(copyFrom._numColumns), _coalesce(copyFrom._coalesce),
+    _quantum(copyFrom._quantum), _schedule(copyFrom._schedule)
+{
+    std::memcpy(_columns, copyFrom._columns, sizeof(_columns));
+}
+
+/** Default destructor.  */
+AirBatch::~AirBatch() {}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+////////////////////
+//    Getters
+////////////////////
+
+/** Retrieve the number of output columns.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _numColumns.
+*/
+uint32 AirBatch::getNumColumns (void) const
+{  return _numColumns;  }
+
+/** Retrieve the property of an output column.
+ *
+ *  @pre column < getNumColumns().
+ *  @post none.
+ *  @param column The output column.
+ *  @return The Property written to the column.
+*/
+uint32 AirBatch::getColumn (uint32 column) const
+{  return _columns[column];  }
+
+/** Retrieve the duplicate input detection.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _coalesce (a Coalesce).
+*/
+uint32 AirBatch::getCoalesce (void) const
+{  return _coalesce;  }
+
+/** Retrieve the relative quantum of COALESCE_QUANTIZED.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _quantum.
+*/
+double AirBatch::getQuantum (void) const
+{  return _quantum;  }
+
+/** Retrieve the evaluation order.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _schedule (a Schedule).
+*/
+uint32 AirBatch::getSchedule (void) const
+{  return _schedule;  }
+
+////////////////////
+//    Setters
+////////////////////
+
+/** Select the output columns.
+ *
+ *  @pre Every entry of properties is below NUM_PROPERTIES.
+ *  @post The columns are replaced; a property may appear twice.
+ *  @param properties The property of each column.
+ *  @param count The number of columns (1 to MAX_COLUMNS).
+ *  @return true The columns were selected.
+ *  @return false count or a property is out of range; the columns
+ *          are unchanged.
+*/
+bool AirBatch::setColumns (const uint32 *properties, uint32 count)
+{
+    if (count == 0 || count > MAX_COLUMNS)
+        return false;
+
+    for (uint32 i = 0; i < count; ++i)
+        if (properties[i] >= NUM_PROPERTIES)
+            return false;
+
+    std::memcpy(_columns, properties, count * sizeof(uint32));
+    _numColumns = count;
+    return true;
+}
+
+/** Select the output columns by name.
+ *
+ *  @pre list is a NUL-terminated, comma-separated list of the names
+ *       returned by propertyName() (or "all").
+ *  @post The columns are replaced.
+ *  @param list The list of property names.
+ *  @return true The columns were selected.
+ *  @return false A name is unknown or the list is empty or too
+ *          long; the columns are unchanged.
+*/
+bool AirBatch::setColumns (const char *list)
+{
+    uint32 columns[MAX_COLUMNS];
+    uint32 count = 0;
+
+    if (std::strcmp(list, "all") == 0)
+    {
+        for (uint32 i = 0; i < NUM_PROPERTIES; ++i)
+            columns[i] = i;
+
+        return setColumns(columns, NUM_PROPERTIES);
+    }
+
+    const char *name = list;
+
+    for (;;)
+    {
+        const char *end = std::strchr(name, ',');
+        size_t length = end ? (size_t)(end - name) : std::strlen(name);
+
+        if (count == MAX_COLUMNS ||
+            !findProperty(name, length, columns[count]))
+            return false;
+
+        ++count;
+
+        if (!end)
+            break;
+
+        name = end + 1;
+    }
+
+    return setColumns(columns, count);
+}
+
+/** Select the duplicate input detection.  The states of a batch are
+ *  hashed in blocks of 65536; each distinct pair of a block
+ *  (and each run of equal pairs) is evaluated once and its row is
+ *  copied to the duplicates.  Under COALESCE_QUANTIZED the inputs
+ *  are rounded to about quantum relative before they are compared,
+ *  and the duplicates receive the row of the first such state.
+ *
+ *  @pre The object is instantiated.
+ *  @post _coalesce and _quantum are updated.
+ *  @param mode The Coalesce mode.
+ *  @param quantum The relative quantum of COALESCE_QUANTIZED
+ *         (0 < quantum < 1; ignored by the other modes).
+ *  @return true The detection was selected.
+ *  @return false mode or quantum is out of range; nothing is
+ *          changed.
+*/
+bool AirBatch::setCoalesce (uint32 mode, double quantum)
+{
+    if (mode > COALESCE_QUANTIZED)
+        return false;
+
+    if ((mode == COALESCE_QUANTIZED) && !((quantum > 0.0) && (quantum < 1.0)))
+        return false;
+
+    _coalesce = mode;
+    _quantum = (mode == COALESCE_QUANTIZED) ? quantum : 0.0;
+    return true;
+}
+
+/** Select the evaluation order.  Under SCHEDULE_REGIME the states
+ *  of each block of 65536 are binned by regime() with a counting
+ *  sort and evaluated bin by bin through an AirStream, which loads
+ *  the coefficient rows of a bin once; the rows are written back in
+ *  input order.  The schedule applies to double precision INPUT_PT
+ *  batches; other batches keep the input order.
+ *
+ *  A block whose neighbouring states seldom change regime (a flow
+ *  profile, or states at or below 500 K) is not sorted; it goes
+ *  through the AirStream in input order.  AirStream matches Air bit
+ *  for bit, so both schedules give the same rows.
+ *
+ *  @pre The object is instantiated.
+ *  @post _schedule is updated.
+ *  @param schedule The Schedule.
+ *  @return true The order was selected.
+ *  @return false schedule is out of range; nothing is changed.
+*/
+bool AirBatch::setSchedule (uint32 schedule)
+{
+    if (schedule > SCHEDULE_REGIME)
+        return false;
+
+    _schedule = schedule;
+    return true;
+}
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Evaluate a batch of states.
+ *
+ *  @pre states holds 2 * count values and values has room for
+ *       count * getNumColumns() values.
+ *  @post The property rows are written to values.
+ *  @param input The meaning of the second member of each pair
+ *         (INPUT_PT or INPUT_PH).
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional; receives 1 for each evaluated state and
+ *         0 for each NaN row.
+ *  @return The number of states that were evaluated.
+*/
+size_t AirBatch::evaluate (uint32 input, const double *states,
+                           size_t count, double *values,
+                           unsigned char *valid) const
+{
+    if (_coalesce != COALESCE_NONE)
+        return coalesceRows(_columns, _numColumns, input, states, count,
+                            values, valid,
+                            coalesceDrop(_coalesce, _quantum, 52),
+                            _schedule);
+
+    return orderedRows(_schedule, _columns, _numColumns, input, states,
+                       count, values, valid);
+}
+
+/** Evaluate a batch of states in single precision (AirFloat).
+ *
+ *  @pre states holds 2 * count values and values has room for
+ *       count * getNumColumns() values.
+ *  @post The property rows are written to values.
+ *  @param input The meaning of the second member of each pair
+ *         (INPUT_PT or INPUT_PH).
+ *  @param states The interleaved input pairs.
+ *  @param count The number of states.
+ *  @param values The destination rows.
+ *  @param valid Optional; receives 1 for each evaluated state and
+ *         0 for each NaN row.
+ *  @return The number of states that were evaluated.
+*/
+size_t AirBatch::evaluate (uint32 input, const float *states,
+                           size_t count, float *values,
+                           unsigned char *valid) const
+{
+    if (_coalesce != COALESCE_NONE)
+        return coalesceRows(_columns, _numColumns, input, states, count,
+                            values, valid,
+                            coalesceDrop(_coalesce, _quantum, 23),
+                            _schedule);
+
+    return orderedRows(_schedule, _columns, _numColumns, input, states,
+                       count, values, valid);
+}
+
+/** Retrieve the name of a property.
+ *
+ *  @pre property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property.
+ *  @return The lower case name (e.g. "density").
+*/
+const char * AirBatch::propertyName (uint32 property)
+{
+    static const char *names[NUM_PROPERTIES] =
+    {
+        "pressure", "temperature", "enthalpy", "specific_heat", "gamma",
+        "density", "entropy", "sound_speed", "thermal_cond", "viscosity",
+        "prandtl", "comp_factor"
+    };
+
+    return names[property];
+}
+
+/** Find a property by name.
+ *
+ *  @pre name holds at least length characters.
+ *  @post none.
+ *  @param name The name (not necessarily NUL-terminated).
+ *  @param length The number of characters in name.
+ *  @param property Receives the property.
+ *  @return true The name is known.
+*/
+bool AirBatch::findProperty (const char *name, size_t length,
+                             uint32 &property)
+{
+    for (uint32 i = 0; i < NUM_PROPERTIES; ++i)
+    {
+        const char *candidate = propertyName(i);
+
+        if (std::strlen(candidate) == length &&
+            std::strncmp(candidate, name, length) == 0)
+        {
+            property = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Determine the regime of a state: its pressure decade and the
+ *  temperature band in which the coefficient rows of every curve
+ *  fit at the two bracketing pressure contours are fixed.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure [units: MPa].
+ *  @param temperature The temperature [units: K].
+ *  @return 0 for T <= 500 K, NUM_REGIMES - 1 outside the range of
+ *          the ADT, and a distinct value in between for each band.
+*/
+uint32 AirBatch::regime (double pressure, double temperature)
+{
+    // The bands are merged once, on the first call.
+    static double lower[NUM_REGIMES];
+    static uint32 first[8];
+    static const bool merged = _regimeBands(lower, first);
+    (void) merged;
+
+    // 0.101325 = conversion factor MPa -> atm
+    pressure /= 0.101325;
+
+    // The comparisons also reject NaN.
+    if (!(   (pressure >= 1E-4) && (pressure <= 100.0)
+          && (temperature >= 0.0) && (temperature <= 30000.0)))
+        return NUM_REGIMES - 1;
+
+    if (temperature <= 500.0)
+        return 0;
+
+    uint32 decade = AirCoefficients::decade(pressure);
+    const double *begin = lower + first[decade],
+                 *end = lower + first[decade + 1];
+    uint32 band = uint32(std::upper_bound(begin, end, temperature) - begin);
+
+    return 1 + first[decade] + ((band > 0) ? band - 1 : 0);
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Merge the temperature breakpoints of the coefficient tables at
+ *  the two pressure contours of every decade into bands.
+ *
+ *  @pre lower has room for NUM_REGIMES values.
+ *  @post lower holds the sorted lower limits of the bands of each
+ *        decade, starting at first[decade]; first[7] is the count.
+ *  @param lower The lower temperature limit of each band [K].
+ *  @param first The first band of each decade.
+ *  @return true.
+*/
+bool AirBatch::_regimeBands (double *lower, uint32 first[8])
+{
+    const uint32 *decadeRows[5] = { AirCoefficients::hDecadeRows,
+                                    AirCoefficients::cpDecadeRows,
+                                    AirCoefficients::kDecadeRows,
+                                    AirCoefficients::muDecadeRows,
+                                    AirCoefficients::zDecadeRows };
+    const double *Tmin[5] = { AirCoefficients::hTmin,
+                              AirCoefficients::cpTmin,
+                              AirCoefficients::kTmin,
+                              AirCoefficients::muTmin,
+                              AirCoefficients::zTmin };
+
+    uint32 count = 0;
+
+    for (uint32 decade = 0; decade < 7; ++decade)
+    {
+        // The pressure contours at either end of the decade.
+        uint32 groups[2] = { decade, std::min(decade + 1, 6u) };
+        double *band = lower + count;
+        uint32 n = 0;
+
+        first[decade] = count;
+
+        for (uint32 g = 0; g < 2; ++g)
+            for (uint32 t = 0; t < 5; ++t)
+                for (uint32 row = decadeRows[t][groups[g]];
+                     row < decadeRows[t][groups[g] + 1]; ++row)
+                    band[n++] = Tmin[t][row];
+
+        std::sort(band, band + n);
+        count += uint32(std::unique(band, band + n) - band);
+    }
+
+    first[7] = count;
+    return true;
+}
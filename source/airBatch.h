@@ -0,0 +1,368 @@
+/******************************************************************************
+||  airBatch.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Batch evaluation of the equilibrium air ADT.  A batch is an array of   ||
+||    (pressure, temperature) or (pressure, enthalpy) pairs; the selected    ||
+||    property columns of every state are written to a caller-owned          ||
+||    row-major array, with NaN rows for the states that cannot be           ||
+||    evaluated.  The streaming tools and servers build on this interface.   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airBatch.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airBatch.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_BATCH_H
+#define _GH_DEF_AIR_BATCH_H
+
+#include "air.h"
+
+#include <cstddef>
+
+/**
+ *  @class AirBatch Evaluates arrays of states and writes the selected
+ *         property columns of each state to a row-major array.
+ *
+ *  The states are interleaved pairs: (pressure [MPa], temperature [K])
+ *  for INPUT_PT and (pressure [MPa], enthalpy [kJ/kg]) for INPUT_PH.
+ *  Row i of the result holds getNumColumns() values of state i, in the
+ *  units of the Air accessors.  A state that cannot be evaluated (out of
+ *  range, not finite, or an enthalpy above MAX_PH_ENTHALPY) gives a row
+ *  of NaN.  evaluate() is const and keeps no state between calls, so
+ *  one AirBatch may be shared by any number of threads.
+*/
+class AirBatch
+{
+  public:
+    /** The properties that can be selected as output columns.  */
+    enum Property
+    {
+        PRESSURE,
+        TEMPERATURE,
+        ENTHALPY,
+        SPECIFIC_HEAT,
+        GAMMA,
+        DENSITY,
+        ENTROPY,
+        SOUND_SPEED,
+        THERMAL_COND,
+        VISCOSITY,
+        PRANDTL,
+        COMP_FACTOR,
+        NUM_PROPERTIES
+    };
+
+    /** The second member of each input pair.  */
+    enum Input
+    {
+        INPUT_PT,    // (pressure, temperature)
+        INPUT_PH     // (pressure, enthalpy)
+    };
+
+    /** The detection of duplicate input pairs by evaluate().  */
+    enum Coalesce
+    {
+        COALESCE_NONE,       // Evaluate every state.
+        COALESCE_EXACT,      // Evaluate each distinct pair once.
+        COALESCE_QUANTIZED   // Pairs equal to a relative quantum share
+                             // the evaluation of the first of them.
+    };
+
+    /** The order in which evaluate() visits the states.  */
+    enum Schedule
+    {
+        SCHEDULE_INPUT,      // Input order.
+        SCHEDULE_REGIME      // Grouped by regime() (a counting sort).
+    };
+
+    // Bound on the values returned by regime(): the T <= 500 K
+    // shortcut, at most one band per coefficient row at the two
+    // pressure contours of each decade, and out of range.
+    static const uint32 NUM_REGIMES = 2 + 2 * 182;
+
+    // Largest number of output columns.
+    static const uint32 MAX_COLUMNS = 2 * NUM_PROPERTIES;
+
+    // calculateProps_PH starts its search at T = h / 1.005; above this
+    // enthalpy [kJ/kg] the first guess leaves the curve fit range and
+    // the search does not terminate, so such states are rejected.
+    static const double MAX_PH_ENTHALPY;
+
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (every property, in enum order).  */
+    AirBatch();
+
+    /** Copy constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created from the copied values.
+     *  @param copyFrom An AirBatch object whose columns are copied.
+     *  @return none.
+    */
+    AirBatch (const AirBatch &copyFrom);
+
+    /** Default destructor.  */
+    ~AirBatch();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    ////////////////////
+    //    Getters
+    ////////////////////
+
+    /** Retrieve the number of output columns.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _numColumns.
+    */
+    uint32 getNumColumns (void) const;
+
+    /** Retrieve the property of an output column.
+     *
+     *  @pre column < getNumColumns().
+     *  @post none.
+     *  @param column The output column.
+     *  @return The Property written to the column.
+    */
+    uint32 getColumn (uint32 column) const;
+
+    /** Retrieve the duplicate input detection.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _coalesce (a Coalesce).
+    */
+    uint32 getCoalesce (void) const;
+
+    /** Retrieve the relative quantum of COALESCE_QUANTIZED.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _quantum.
+    */
+    double getQuantum (void) const;
+
+    /** Retrieve the evaluation order.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _schedule (a Schedule).
+    */
+    uint32 getSchedule (void) const;
+
+    ////////////////////
+    //    Setters
+    ////////////////////
+
+    /** Select the output columns.
+     *
+     *  @pre Every entry of properties is below NUM_PROPERTIES.
+     *  @post The columns are replaced; a property may appear twice.
+     *  @param properties The property of each column.
+     *  @param count The number of columns (1 to MAX_COLUMNS).
+     *  @return true The columns were selected.
+     *  @return false count or a property is out of range; the columns
+     *          are unchanged.
+    */
+    bool setColumns (const uint32 *properties, uint32 count);
+
+    /** Select the output columns by name.
+     *
+     *  @pre list is a NUL-terminated, comma-separated list of the names
+     *       returned by propertyName() (or "all").
+     *  @post The columns are replaced.
+     *  @param list The list of property names.
+     *  @return true The columns were selected.
+     *  @return false A name is unknown or the list is empty or too
+     *          long; the columns are unchanged.
+    */
+    bool setColumns (const char *list);
+
+    /** Select the duplicate input detection.  The states of a batch are
+     *  hashed in blocks of 65536; each distinct pair of a block
+     *  (and each run of equal pairs) is evaluated once and its row is
+     *  copied to the duplicates.  Under COALESCE_QUANTIZED the inputs
+     *  are rounded to about quantum relative before they are compared,
+     *  and the duplicates receive the row of the first such state.
+     *
+     *  @pre The object is instantiated.
+     *  @post _coalesce and _quantum are updated.
+     *  @param mode The Coalesce mode.
+     *  @param quantum The relative quantum of COALESCE_QUANTIZED
+     *         (0 < quantum < 1; ignored by the other modes).
+     *  @return true The detection was selected.
+     *  @return false mode or quantum is out of range; nothing is
+     *          changed.
+    */
+    bool setCoalesce (uint32 mode, double quantum = 0.0);
+
+    /** Select the evaluation order.  Under SCHEDULE_REGIME the states
+     *  of each block of 65536 are binned by regime() with a counting
+     *  sort and evaluated bin by bin through an AirStream, which loads
+     *  the coefficient rows of a bin once; the rows are written back in
+     *  input order.  The schedule applies to double precision INPUT_PT
+     *  batches; other batches keep the input order.
+     *
+     *  A block whose neighbouring states seldom change regime (a flow
+     *  profile, or states at or below 500 K) is not sorted; it goes
+     *  through the AirStream in input order.  AirStream matches Air bit
+     *  for bit, so both schedules give the same rows.
+     *
+     *  @pre The object is instantiated.
+     *  @post _schedule is updated.
+     *  @param schedule The Schedule.
+     *  @return true The order was selected.
+     *  @return false schedule is out of range; nothing is changed.
+    */
+    bool setSchedule (uint32 schedule);
+
+    /******************************************************
+    **                 Public Methods                    **
+    ******************************************************/
+
+    /** Evaluate a batch of states.
+     *
+     *  @pre states holds 2 * count values and values has room for
+     *       count * getNumColumns() values.
+     *  @post The property rows are written to values.
+     *  @param input The meaning of the second member of each pair
+     *         (INPUT_PT or INPUT_PH).
+     *  @param states The interleaved input pairs.
+     *  @param count The number of states.
+     *  @param values The destination rows.
+     *  @param valid Optional; receives 1 for each evaluated state and
+     *         0 for each NaN row.
+     *  @return The number of states that were evaluated.
+    */
+    size_t evaluate (uint32 input, const double *states, size_t count,
+                     double *values, unsigned char *valid = NULL) const;
+
+    /** Evaluate a batch of states in single precision (AirFloat).
+     *  The rows agree with the double precision rows to about 1E-5
+     *  relative, well inside the error of the curve fits.
+     *
+     *  @pre states holds 2 * count values and values has room for
+     *       count * getNumColumns() values.
+     *  @post The property rows are written to values.
+     *  @param input The meaning of the second member of each pair
+     *         (INPUT_PT or INPUT_PH).
+     *  @param states The interleaved input pairs.
+     *  @param count The number of states.
+     *  @param values The destination rows.
+     *  @param valid Optional; receives 1 for each evaluated state and
+     *         0 for each NaN row.
+     *  @return The number of states that were evaluated.
+    */
+    size_t evaluate (uint32 input, const float *states, size_t count,
+                     float *values, unsigned char *valid = NULL) const;
+
+    /** Retrieve the name of a property.
+     *
+     *  @pre property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property.
+     *  @return The lower case name (e.g. "density").
+    */
+    static const char * propertyName (uint32 property);
+
+    /** Find a property by name.
+     *
+     *  @pre name holds at least length characters.
+     *  @post none.
+     *  @param name The name (not necessarily NUL-terminated).
+     *  @param length The number of characters in name.
+     *  @param property Receives the property.
+     *  @return true The name is known.
+    */
+    static bool findProperty (const char *name, size_t length,
+                              uint32 &property);
+
+    /** Determine the regime of a state: its pressure decade and the
+     *  temperature band in which the coefficient rows of every curve
+     *  fit at the two bracketing pressure contours are fixed.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param pressure The pressure [units: MPa].
+     *  @param temperature The temperature [units: K].
+     *  @return 0 for T <= 500 K, NUM_REGIMES - 1 outside the range of
+     *          the ADT, and a distinct value in between for each band.
+    */
+    static uint32 regime (double pressure, double temperature);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    uint32 _numColumns;               // Number of output columns.
+    uint32 _columns[MAX_COLUMNS];     // Property of each column.
+
+    uint32 _coalesce;                 // Duplicate detection (Coalesce).
+    double _quantum;                  // Relative quantum of the inputs.
+    uint32 _schedule;                 // Evaluation order (Schedule).
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Merge the temperature breakpoints of the coefficient tables at
+     *  the two pressure contours of every decade into bands.
+     *
+     *  @pre lower has room for NUM_REGIMES values.
+     *  @post lower holds the sorted lower limits of the bands of each
+     *        decade, starting at first[decade]; first[7] is the count.
+     *  @param lower The lower temperature limit of each band [K].
+     *  @param first The first band of each decade.
+     *  @return true.
+    */
+    static bool _regimeBands (double *lower, uint32 first[8]);
+
+};  // end class AirBatch
+
+#endif
@@ -0,0 +1,1273 @@
+/******************************************************************************
+||  airConstexpr.h      (definition file)                                    ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Compile-time evaluation of the equilibrium air ADT.  The curve fits    ||
+||    of airCoefficients.h are evaluated by constexpr functions (with        ||
+||    constexpr exp, log, and sqrt), so that a state at fixed conditions,    ||
+||    or a whole property table on a fixed grid, is computed by the          ||
+||    compiler and placed in read-only data.                                 ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airCoefficients.h                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airConstexpr.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_CONSTEXPR_H
+#define _GH_DEF_AIR_CONSTEXPR_H
+
+#include "air.h"
+#include "airCoefficients.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ *  @struct AirIndexList A list of indices 0, 1, ... N - 1 (generated
+ *          by AirIndexRange<N>) that is expanded into the nodes of a
+ *          baked table.
+*/
+template <uint32... I>
+struct AirIndexList
+{};
+
+template <typename Lower, typename Upper>
+struct AirIndexJoin;
+
+template <uint32... I, uint32... J>
+struct AirIndexJoin<AirIndexList<I...>, AirIndexList<J...> >
+{
+    typedef AirIndexList<I..., (uint32(sizeof...(I)) + J)...> type;
+};
+
+// The range is built by halves, so the template depth is log2(N).
+template <uint32 N>
+struct AirIndexRange
+{
+    typedef typename AirIndexJoin<typename AirIndexRange<N / 2>::type,
+                                  typename AirIndexRange<N - N / 2>::type
+                                 >::type type;
+};
+
+template <>
+struct AirIndexRange<0>
+{
+    typedef AirIndexList<> type;
+};
+
+template <>
+struct AirIndexRange<1>
+{
+    typedef AirIndexList<0> type;
+};
+
+/**
+ *  @class AirConstexpr Evaluates the curve fits of Air in constant
+ *         expressions.
+ *
+ *  Every function is a C++11 constexpr function (a single return
+ *  statement; loops are written as recursion), so it can be called
+ *  with constant arguments to fold a state into the program, or at run
+ *  time like any other function.  The fits, pressure groups, and
+ *  temperature breakpoints are the AirCoefficients tables used by Air.
+ *  The elementary functions are series with argument reduction and
+ *  agree with the C library to a few units in the last place; the
+ *  pressure interpolation of the exponential fits is done in log space
+ *  (log10(exp(x)) is not taken).  Pressures are in MPa and the units
+ *  follow the Air accessors.
+ *
+ *  The functions are much slower than Air at run time; they are meant
+ *  for the compiler (see AirBakedTable).
+*/
+class AirConstexpr
+{
+  public:
+    /**
+     *  @struct State The properties of one state, as calculated by
+     *          Air::calculateProperties.  Every property is NaN when
+     *          the state is outside the range of the ADT.
+    */
+    struct State
+    {
+        double temperature,   // Temperature [units: K]
+               pressure,      // Pressure [units: MPa]
+               enthalpy,      // Specific enthalpy [units: kJ/kg]
+               intEnergy,     // Specific internal energy [units: kJ/kg]
+               density,       // Density [units: kg/m^3]
+               specificHeat,  // Specific heat (cp) [units: kJ/kg-K]
+               gamma,         // Ratio of specific heats [-dimensionless-]
+               thermalCond,   // Thermal conductivity [units: W/m-K]
+               prandtl,       // Prandtl number [-dimensionless-]
+               viscosity,     // Dynamic viscosity [units: kg/m-s]
+               kinViscosity,  // Kinematic viscosity [units: m^2/s]
+               compFactor,    // Compressibility factor [-dimensionless-]
+               gasConstant,   // Specific gas constant [units: kJ/kg-K]
+               molarMass,     // Molar mass [units: kg/kgmol]
+               entropy,       // Specific entropy [units: kJ/kg-K]
+               soundSpeed;    // Speed of sound [units: m/s]
+    };
+
+    /**
+     *  @struct Values A fixed number of values (a literal type, so that
+     *          a whole table can be returned by a constexpr function).
+    */
+    template <uint32 N>
+    struct Values
+    {
+        double value[N];
+    };
+
+    /******************************************************
+    **                   Properties                      **
+    ******************************************************/
+
+    /** Determine whether a state is inside the range of the ADT.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return true 1E-4 <= P <= 100 atm and 0 <= T <= 30000 K.
+    */
+    static constexpr bool isValid (double pressure, double temperature);
+
+    /** Calculate the enthalpy at the given pressure and temperature.
+     *
+     *  @pre isValid(pressure, temperature).
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The enthalpy [units: kJ/kg].
+    */
+    static constexpr double enthalpy (double pressure, double temperature);
+
+    /** Calculate the specific heat at the given pressure and temperature.
+     *
+     *  @pre isValid(pressure, temperature).
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The specific heat [units: kJ/kg-K].
+    */
+    static constexpr double specificHeat (double pressure,
+                                          double temperature);
+
+    /** Calculate the thermal conductivity at the given pressure and
+     *  temperature.
+     *
+     *  @pre isValid(pressure, temperature).
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The thermal conductivity [units: W/m-K].
+    */
+    static constexpr double thermalConductivity (double pressure,
+                                                 double temperature);
+
+    /** Calculate the dynamic viscosity at the given pressure and
+     *  temperature.
+     *
+     *  @pre isValid(pressure, temperature).
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The dynamic viscosity [units: kg/m-s].
+    */
+    static constexpr double dynamicViscosity (double pressure,
+                                              double temperature);
+
+    /** Calculate the compressibility factor at the given pressure and
+     *  temperature.
+     *
+     *  @pre isValid(pressure, temperature).
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The compressibility factor [-dimensionless-].
+    */
+    static constexpr double compressibilityFactor (double pressure,
+                                                   double temperature);
+
+    /** Calculate the properties of air at the given pressure and
+     *  temperature.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @return The state (NaN properties outside the ADT range).
+    */
+    static constexpr State state (double pressure, double temperature);
+
+    /** Tabulate one property on a fixed grid.
+     *
+     *  Grid supplies the node counts NP and NT (static const uint32,
+     *  at least 2 each) and the bounds LOG_P_MIN, LOG_P_MAX (log10 of
+     *  the pressure in MPa), T_MIN and T_MAX (in K) as static constexpr
+     *  doubles.  The nodes are placed as in AirTable::generate.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The NP x NT values, T varying fastest.
+    */
+    template <typename Grid, double State::*Property>
+    static constexpr Values<Grid::NP * Grid::NT> bake (void);
+
+    /******************************************************
+    **               Elementary Functions                **
+    ******************************************************/
+
+    /** The exponential function.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param x The argument.
+     *  @return e^x.
+    */
+    static constexpr double exp (double x);
+
+    /** The natural logarithm.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param x The argument.
+     *  @return ln(x) (NaN for negative x).
+    */
+    static constexpr double log (double x);
+
+    /** The common logarithm.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param x The argument.
+     *  @return log10(x) (NaN for negative x).
+    */
+    static constexpr double log10 (double x);
+
+    /** The common antilogarithm.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param x The argument.
+     *  @return 10^x.
+    */
+    static constexpr double pow10 (double x);
+
+    /** The square root.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param x The argument.
+     *  @return The square root of x (NaN for negative x).
+    */
+    static constexpr double sqrt (double x);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    // ln(2) split so that k * _LN2_HI is exact for |k| < 2^20.
+    static constexpr double _LN2_HI = 6.93147180369123816490E-01,
+                            _LN2_LO = 1.90821492927058770002E-10;
+
+    static constexpr double _LN2 = 0.693147180559945309417,
+                            _LN10 = 2.30258509299404568402,
+                            _SQRT2 = 1.41421356237309504880,
+                            _SQRT_HALF = 0.707106781186547524401;
+
+    // Powers of two used to reduce the logarithm argument: 2^64, 2^-64.
+    static constexpr double _TWO_64 = 18446744073709551616.0,
+                            _TWO_M64 = 5.42101086242752217004E-20;
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    static constexpr double _nan (void);
+    static constexpr double _infinity (void);
+
+    // exp: e^x = 2^k e^r with r = x - k ln(2), |r| <= ln(2) / 2.
+    static constexpr int _roundToInt (double x);
+    static constexpr int _floorToInt (double x);
+    static constexpr double _expReduced (double x, int k);
+    static constexpr double _expSeries (double r, uint32 n);
+    static constexpr double _square (double x);
+    static constexpr double _pow2 (uint32 n);
+    static constexpr double _scale2 (double x, int k);
+
+    // log: x = 2^e m with sqrt(1/2) <= m < sqrt(2), and
+    // ln(m) = 2 atanh(s), s = (m - 1) / (m + 1).
+    static constexpr double _logReduced (double m, int e);
+    static constexpr double _atanhSeries (double s2, uint32 n);
+
+    // pow10: 10^x = 10^n e^((x - n) ln(10)), n = floor(x).
+    static constexpr double _pow10Reduced (double x, int n);
+    static constexpr double _pow10Int (uint32 n);
+
+    static constexpr double _sqrtNewton (double x, double guess,
+                                         uint32 steps);
+
+    // The row lookups and the pressure interpolation of Air.
+    static constexpr uint32 _decade (double pressure);
+    static constexpr double _lowerOM (double pressure);
+    static constexpr double _upperOM (double pressure);
+    static constexpr uint32 _advanceRow (uint32 end, const double *Tmin,
+                                         uint32 row, double temperature);
+    static constexpr uint32 _row (const uint32 *decadeRows,
+                                  const double *Tmin, double pressure,
+                                  double temperature);
+    static constexpr double _interpolateLog (double pressure, double p1,
+                                             double p2, double log10Phi1,
+                                             double log10Phi2);
+
+    // The curve fits (pressure in atm, results in the reference units).
+    static constexpr double _horner (const double *coeffs, uint32 terms,
+                                     double x);
+    static constexpr double _expPoly (const double *coeffs, double x);
+    static constexpr double _logFit (const double (*coeffs)[5],
+                                     const uint32 *decadeRows,
+                                     const double *Tmin, double pressure,
+                                     double temperature);
+    static constexpr double _logFitAt (const double (*coeffs)[5],
+                                       const uint32 *decadeRows,
+                                       const double *Tmin, double pressure,
+                                       double temperature, double x);
+
+    template <uint32 TERMS>
+    static constexpr double _polyFit (const double (*coeffs)[TERMS],
+                                      const uint32 *decadeRows,
+                                      const double *Tmin, double pressure,
+                                      double temperature);
+
+    // The derived properties, one intermediate value at a time.
+    static constexpr State _invalid (double pressure, double temperature);
+    static constexpr State _derive (double pressure, double temperature,
+                                    double h, double cp, double k,
+                                    double mu, double z);
+    static constexpr State _deriveGas (double pressure, double temperature,
+                                       double h, double cp, double k,
+                                       double mu, double z,
+                                       double molarMass);
+    static constexpr State _deriveState (double pressure,
+                                         double temperature, double h,
+                                         double cp, double k, double mu,
+                                         double z, double molarMass,
+                                         double gasConstant,
+                                         double density, double gamma);
+
+    // The table nodes.
+    static constexpr double _axis (double low, double high, uint32 n,
+                                   uint32 i);
+    static constexpr double _clampPressure (double pressure);
+
+    template <typename Grid, double State::*Property>
+    static constexpr double _node (uint32 index);
+
+    template <typename Grid, double State::*Property, uint32... I>
+    static constexpr Values<sizeof...(I)> _bake (const AirIndexList<I...> &);
+
+};  // end class AirConstexpr
+
+/**
+ *  @class AirBakedTable A property table on a fixed grid that is
+ *         computed by the compiler.
+ *
+ *  The values are a constexpr static member, so they are placed in
+ *  read-only data with no generation cost or startup work, and are
+ *  interpolated bilinearly in (log10 P, T) like an AirTable.  Grid is
+ *  described at AirConstexpr::bake; Property selects the member of
+ *  AirConstexpr::State.  Each node costs the compiler a few thousand
+ *  constexpr operations, so large grids need a larger
+ *  -fconstexpr-ops-limit (GCC) or -fconstexpr-steps (Clang).
+*/
+template <typename Grid, double AirConstexpr::State::*Property>
+class AirBakedTable
+{
+  public:
+    static const uint32 NP = Grid::NP,
+                        NT = Grid::NT,
+                        SIZE = Grid::NP * Grid::NT;
+
+    // The nodes, isobar by isobar with T varying fastest.
+    static constexpr AirConstexpr::Values<Grid::NP * Grid::NT> values =
+        AirConstexpr::bake<Grid, Property>();
+
+    /** Interpolate the property at the given state.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @return The property, NaN outside the grid.
+    */
+    static double value (double pressure, double temperature);
+
+  private:
+    static_assert((Grid::NP >= 2) && (Grid::NT >= 2),
+                  "a baked table needs at least 2 x 2 nodes");
+
+};  // end class AirBakedTable
+
+/******************************************************
+**                   Properties                      **
+******************************************************/
+
+/** Determine whether a state is inside the range of the ADT.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return true 1E-4 <= P <= 100 atm and 0 <= T <= 30000 K.
+*/
+constexpr bool AirConstexpr::isValid (double pressure, double temperature)
+{
+    //   0.101325 = conversion factor MPa -> atm
+    return    ((pressure / 0.101325) >= 1E-4)
+           && ((pressure / 0.101325) <= 100.0)
+           && (temperature >= 0.0) && (temperature <= 30000.0);
+}
+
+/** Calculate the enthalpy at the given pressure and temperature.
+ *
+ *  @pre isValid(pressure, temperature).
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The enthalpy [units: kJ/kg].
+*/
+constexpr double AirConstexpr::enthalpy (double pressure, double temperature)
+{
+    // Below 500 K: h = 0.24E-3 T kcal/g.  kcal/g -> kJ/kg as in Air.
+    return ((temperature <= 500.0)
+            ? 0.24E-3 * temperature
+            : _logFit(AirCoefficients::hCoeffs, AirCoefficients::hDecadeRows,
+                      AirCoefficients::hTmin, pressure / 0.101325,
+                      temperature))
+           * 1000.0 * 1000.0 / 238.8459;
+}
+
+/** Calculate the specific heat at the given pressure and temperature.
+ *
+ *  @pre isValid(pressure, temperature).
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The specific heat [units: kJ/kg-K].
+*/
+constexpr double AirConstexpr::specificHeat (double pressure,
+                                             double temperature)
+{
+    // Below 500 K: cp = 0.24 cal/g-K.  cal/g-K -> kJ/kg-K as in Air.
+    return ((temperature <= 500.0)
+            ? 0.24
+            : _logFit(AirCoefficients::cpCoeffs,
+                      AirCoefficients::cpDecadeRows, AirCoefficients::cpTmin,
+                      pressure / 0.101325, temperature))
+           * 1000.0 / 238.8459;
+}
+
+/** Calculate the thermal conductivity at the given pressure and
+ *  temperature.
+ *
+ *  @pre isValid(pressure, temperature).
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The thermal conductivity [units: W/m-K].
+*/
+constexpr double AirConstexpr::thermalConductivity (double pressure,
+                                                    double temperature)
+{
+    // Below 500 K: Sutherland's law.  cal/cm-s-K -> W/m-K as in Air.
+    return ((temperature <= 500.0)
+            ? 5.9776E-6 * (temperature * sqrt(temperature)
+                           / (temperature + 194.4))
+            : _logFit(AirCoefficients::kCoeffs, AirCoefficients::kDecadeRows,
+                      AirCoefficients::kTmin, pressure / 0.101325,
+                      temperature))
+           * 100.0 / 0.2388459;
+}
+
+/** Calculate the dynamic viscosity at the given pressure and
+ *  temperature.
+ *
+ *  @pre isValid(pressure, temperature).
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The dynamic viscosity [units: kg/m-s].
+*/
+constexpr double AirConstexpr::dynamicViscosity (double pressure,
+                                                 double temperature)
+{
+    // Below 500 K: Sutherland's law.  poise -> kg/m-s as in Air.
+    return ((temperature <= 500.0)
+            ? 1.4584E-5 * (temperature * sqrt(temperature)
+                           / (temperature + 110.33))
+            : _polyFit<6>(AirCoefficients::muCoeffs,
+                          AirCoefficients::muDecadeRows,
+                          AirCoefficients::muTmin, pressure / 0.101325,
+                          temperature))
+           * 100.0 / 1000.0;
+}
+
+/** Calculate the compressibility factor at the given pressure and
+ *  temperature.
+ *
+ *  @pre isValid(pressure, temperature).
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The compressibility factor [-dimensionless-].
+*/
+constexpr double AirConstexpr::compressibilityFactor (double pressure,
+                                                      double temperature)
+{
+    // Below 500 K the compressibility factor is unity.
+    return (temperature <= 500.0)
+           ? 1.0
+           : _polyFit<5>(AirCoefficients::zCoeffs,
+                         AirCoefficients::zDecadeRows,
+                         AirCoefficients::zTmin, pressure / 0.101325,
+                         temperature);
+}
+
+/** Calculate the properties of air at the given pressure and
+ *  temperature.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The state (NaN properties outside the ADT range).
+*/
+constexpr AirConstexpr::State AirConstexpr::state (double pressure,
+                                                   double temperature)
+{
+    return isValid(pressure, temperature)
+           ? _derive(pressure, temperature,
+                     enthalpy(pressure, temperature),
+                     specificHeat(pressure, temperature),
+                     thermalConductivity(pressure, temperature),
+                     dynamicViscosity(pressure, temperature),
+                     compressibilityFactor(pressure, temperature))
+           : _invalid(pressure, temperature);
+}
+
+/** Tabulate one property on a fixed grid.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The NP x NT values, T varying fastest.
+*/
+template <typename Grid, double AirConstexpr::State::*Property>
+constexpr AirConstexpr::Values<Grid::NP * Grid::NT> AirConstexpr::bake (void)
+{
+    return _bake<Grid, Property>(
+               typename AirIndexRange<Grid::NP * Grid::NT>::type());
+}
+
+/******************************************************
+**               Elementary Functions                **
+******************************************************/
+
+/** The exponential function.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The argument.
+ *  @return e^x.
+*/
+constexpr double AirConstexpr::exp (double x)
+{
+    return (x != x)                ? x
+         : (x > 709.782712893384)  ? _infinity()
+         : (x < -745.133219101941) ? 0.0
+         : _expReduced(x, _roundToInt(x / _LN2));
+}
+
+/** The natural logarithm.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The argument.
+ *  @return ln(x) (NaN for negative x).
+*/
+constexpr double AirConstexpr::log (double x)
+{
+    return ((x != x) || (x < 0.0)) ? _nan()
+         : (x == 0.0)              ? -_infinity()
+         : (x == _infinity())      ? x
+         : _logReduced(x, 0);
+}
+
+/** The common logarithm.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The argument.
+ *  @return log10(x) (NaN for negative x).
+*/
+constexpr double AirConstexpr::log10 (double x)
+{  return log(x) / _LN10;  }
+
+/** The common antilogarithm.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The argument.
+ *  @return 10^x.
+*/
+constexpr double AirConstexpr::pow10 (double x)
+{
+    return (x != x)          ? x
+         : (x > 308.3)       ? _infinity()
+         : (x < -323.4)      ? 0.0
+         : _pow10Reduced(x, _floorToInt(x));
+}
+
+/** The square root.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The argument.
+ *  @return The square root of x (NaN for negative x).
+*/
+constexpr double AirConstexpr::sqrt (double x)
+{
+    // Two Newton steps from exp(ln(x) / 2) round the estimate.
+    return ((x != x) || (x < 0.0))           ? _nan()
+         : ((x == 0.0) || (x == _infinity())) ? x
+         : _sqrtNewton(x, exp(0.5 * log(x)), 2);
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** A quiet NaN.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return NaN.
+*/
+constexpr double AirConstexpr::_nan (void)
+{  return std::numeric_limits<double>::quiet_NaN();  }
+
+/** Positive infinity.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return +inf.
+*/
+constexpr double AirConstexpr::_infinity (void)
+{  return std::numeric_limits<double>::infinity();  }
+
+/** Round to the nearest integer (halves away from zero).
+ *
+ *  @pre |x| < 2^31.
+ *  @post none.
+ *  @param x The value.
+ *  @return The nearest integer.
+*/
+constexpr int AirConstexpr::_roundToInt (double x)
+{  return int((x < 0.0) ? (x - 0.5) : (x + 0.5));  }
+
+/** Round down to an integer.
+ *
+ *  @pre |x| < 2^31.
+ *  @post none.
+ *  @param x The value.
+ *  @return The largest integer not above x.
+*/
+constexpr int AirConstexpr::_floorToInt (double x)
+{  return int(x) - ((x < double(int(x))) ? 1 : 0);  }
+
+/** The exponential of a reduced argument.
+ *
+ *  @pre k is the nearest integer to x / ln(2).
+ *  @post none.
+ *  @param x The argument.
+ *  @param k The power of two of the result.
+ *  @return e^x.
+*/
+constexpr double AirConstexpr::_expReduced (double x, int k)
+{  return _scale2(_expSeries((x - k * _LN2_HI) - k * _LN2_LO, 1), k);  }
+
+/** The Taylor series of e^r from the term r^(n - 1) / (n - 1)! on,
+ *  divided by that term (Horner's rule, 17 terms).
+ *
+ *  @pre |r| <= ln(2) / 2.
+ *  @post none.
+ *  @param r The reduced argument.
+ *  @param n The index of the first term.
+ *  @return 1 + r / n (1 + r / (n + 1) (...)).
+*/
+constexpr double AirConstexpr::_expSeries (double r, uint32 n)
+{  return (n > 17) ? 1.0 : 1.0 + r / n * _expSeries(r, n + 1);  }
+
+/** The square of a value.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param x The value.
+ *  @return x^2.
+*/
+constexpr double AirConstexpr::_square (double x)
+{  return x * x;  }
+
+/** An integer power of two.
+ *
+ *  @pre n <= 1023.
+ *  @post none.
+ *  @param n The exponent.
+ *  @return 2^n.
+*/
+constexpr double AirConstexpr::_pow2 (uint32 n)
+{  return (n == 0) ? 1.0 : _square(_pow2(n / 2)) * ((n % 2) ? 2.0 : 1.0);  }
+
+/** Multiply by an integer power of two.
+ *
+ *  @pre -1075 <= k <= 1024.
+ *  @post none.
+ *  @param x The value.
+ *  @param k The exponent.
+ *  @return x 2^k (in two steps, so that 2^k itself may overflow).
+*/
+constexpr double AirConstexpr::_scale2 (double x, int k)
+{
+    return (k >= 0) ? x * _pow2(uint32(k / 2)) * _pow2(uint32(k - k / 2))
+                    : x / _pow2(uint32(-k / 2)) / _pow2(uint32(-k + k / 2));
+}
+
+/** The natural logarithm of a positive finite value.
+ *
+ *  @pre m > 0 and finite.
+ *  @post none.
+ *  @param m The value, divided by 2^e.
+ *  @param e The powers of two taken out of the value so far.
+ *  @return ln(m 2^e).
+*/
+constexpr double AirConstexpr::_logReduced (double m, int e)
+{
+    return (m >= _TWO_64)      ? _logReduced(m * _TWO_M64, e + 64)
+         : (m < _TWO_M64)      ? _logReduced(m * _TWO_64, e - 64)
+         : (m >= 256.0)        ? _logReduced(m / 256.0, e + 8)
+         : (m < 1.0 / 256.0)   ? _logReduced(m * 256.0, e - 8)
+         : (m >= _SQRT2)       ? _logReduced(m * 0.5, e + 1)
+         : (m < _SQRT_HALF)    ? _logReduced(m * 2.0, e - 1)
+         : e * _LN2_HI + ((m - 1.0) / (m + 1.0)
+                          * _atanhSeries(_square((m - 1.0) / (m + 1.0)), 0)
+                          + e * _LN2_LO);
+}
+
+/** The series 2 atanh(s) / s = 2 (1 + s^2 / 3 + s^4 / 5 + ...) from the
+ *  term n on (Horner's rule, 13 terms).
+ *
+ *  @pre s2 <= 0.03.
+ *  @post none.
+ *  @param s2 The square of s.
+ *  @param n The index of the first term.
+ *  @return 2 / (2n + 1) + s2 (2 / (2n + 3) + s2 (...)).
+*/
+constexpr double AirConstexpr::_atanhSeries (double s2, uint32 n)
+{
+    return (n >= 12) ? 2.0 / (2 * n + 1)
+                     : 2.0 / (2 * n + 1) + s2 * _atanhSeries(s2, n + 1);
+}
+
+/** The common antilogarithm of a reduced argument.
+ *
+ *  @pre n = floor(x), -324 <= n <= 308.
+ *  @post none.
+ *  @param x The argument.
+ *  @param n The integer part of the argument.
+ *  @return 10^x.
+*/
+constexpr double AirConstexpr::_pow10Reduced (double x, int n)
+{
+    return (n >= 0) ? _pow10Int(uint32(n)) * exp((x - n) * _LN10)
+                    : exp((x - n) * _LN10) / _pow10Int(uint32(-n));
+}
+
+/** An integer power of ten (exact up to 10^22).
+ *
+ *  @pre n <= 308.
+ *  @post none.
+ *  @param n The exponent.
+ *  @return 10^n.
+*/
+constexpr double AirConstexpr::_pow10Int (uint32 n)
+{
+    return (n == 0) ? 1.0
+                    : _square(_pow10Int(n / 2)) * ((n % 2) ? 10.0 : 1.0);
+}
+
+/** Refine a square root with Newton's method.
+ *
+ *  @pre x > 0 and guess is close to its square root.
+ *  @post none.
+ *  @param x The argument.
+ *  @param guess The current estimate.
+ *  @param steps The number of remaining steps.
+ *  @return The refined square root.
+*/
+constexpr double AirConstexpr::_sqrtNewton (double x, double guess,
+                                            uint32 steps)
+{
+    return (steps == 0) ? guess
+                        : _sqrtNewton(x, 0.5 * (guess + x / guess),
+                                      steps - 1);
+}
+
+/** Determine the pressure order-of-magnitude group of the
+ *  coefficient tables (AirCoefficients::decade).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The group index (0 for 10^-4 atm through 6 for 10^2 atm).
+*/
+constexpr uint32 AirConstexpr::_decade (double pressure)
+{  return AirCoefficients::decade(pressure);  }
+
+/** The lower order of magnitude of a pressure (Air::_getPressureOM).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The lower order of magnitude pressure in atm.
+*/
+constexpr double AirConstexpr::_lowerOM (double pressure)
+{
+    return ((pressure / 1E-4) < 10.0) ? 1E-4
+         : ((pressure / 1E-3) < 10.0) ? 1E-3
+         : ((pressure / 1E-2) < 10.0) ? 1E-2
+         : ((pressure / 1E-1) < 10.0) ? 1E-1
+         : ((pressure / 1E0)  < 10.0) ? 1E0
+         :                              1E1;
+}
+
+/** The upper order of magnitude of a pressure (Air::_getPressureOM).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The upper order of magnitude pressure in atm.
+*/
+constexpr double AirConstexpr::_upperOM (double pressure)
+{
+    return ((pressure / 1E-4) < 10.0) ? 1E-3
+         : ((pressure / 1E-3) < 10.0) ? 1E-2
+         : ((pressure / 1E-2) < 10.0) ? 1E-1
+         : ((pressure / 1E-1) < 10.0) ? 1E0
+         : ((pressure / 1E0)  < 10.0) ? 1E1
+         :                              1E2;
+}
+
+/** Advance to the last row of a group whose lower temperature limit
+ *  does not exceed the temperature.
+ *
+ *  @pre row is in the group that ends before row end.
+ *  @post none.
+ *  @param end The first row after the group.
+ *  @param Tmin The lower temperature limit of each row in K.
+ *  @param row The current row.
+ *  @param temperature The temperature of the state in K.
+ *  @return The row of the temperature.
+*/
+constexpr uint32 AirConstexpr::_advanceRow (uint32 end, const double *Tmin,
+                                            uint32 row, double temperature)
+{
+    return (((row + 1) < end) && (temperature >= Tmin[row + 1]))
+           ? _advanceRow(end, Tmin, row + 1, temperature)
+           : row;
+}
+
+/** Determine the index of a coefficient array based on the
+ *  pressure and temperature (Air::_getRow).
+ *
+ *  @pre 10E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param decadeRows The first row of each pressure group of the
+ *         table followed by the table length.
+ *  @param Tmin The lower temperature limit of each row in K.
+ *  @param pressure The order-of-magnitude of the pressure of interest.
+ *  @param temperature The temperature of the state in K.
+ *  @return An index into the coefficient array.
+*/
+constexpr uint32 AirConstexpr::_row (const uint32 *decadeRows,
+                                     const double *Tmin, double pressure,
+                                     double temperature)
+{
+    return _advanceRow(decadeRows[_decade(pressure) + 1], Tmin,
+                       decadeRows[_decade(pressure)], temperature);
+}
+
+/** Logarithmically interpolate a property between the pressure
+ *  orders of magnitude (Air::_interpolate).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of the state in atm.
+ *  @param p1 The lower order of magnitude pressure in atm.
+ *  @param p2 The upper order of magnitude pressure in atm.
+ *  @param log10Phi1 log10 of the property at p1.
+ *  @param log10Phi2 log10 of the property at p2.
+ *  @return The interpolated property.
+*/
+constexpr double AirConstexpr::_interpolateLog (double pressure, double p1,
+                                                double p2, double log10Phi1,
+                                                double log10Phi2)
+{
+    return pow10(((log10Phi2 - log10Phi1) / (log10(p2) - log10(p1)))
+                 * (log10(pressure) - log10(p1)) + log10Phi1);
+}
+
+/** Evaluate a polynomial in ascending powers (Horner's rule).
+ *
+ *  @pre coeffs has terms values.
+ *  @post none.
+ *  @param coeffs The coefficients, constant term first.
+ *  @param terms The number of coefficients.
+ *  @param x The independent variable.
+ *  @return The polynomial.
+*/
+constexpr double AirConstexpr::_horner (const double *coeffs, uint32 terms,
+                                        double x)
+{
+    return (terms == 1) ? coeffs[0]
+                        : coeffs[0] + x * _horner(coeffs + 1, terms - 1, x);
+}
+
+/** Evaluate the exponent of an exponential curve fit row.
+ *
+ *  @pre coeffs is a row of the h, cp, or k tables.
+ *  @post none.
+ *  @param coeffs The row (highest power first).
+ *  @param x ln(T / 10000).
+ *  @return The natural log of the property.
+*/
+constexpr double AirConstexpr::_expPoly (const double *coeffs, double x)
+{
+    return coeffs[4]
+           + x * (coeffs[3] + x * (coeffs[2] + x * (coeffs[1]
+           + x * coeffs[0])));
+}
+
+/** Evaluate an exponential curve fit (enthalpy, specific heat, thermal
+ *  conductivity) and interpolate it between the pressure groups.
+ *
+ *  @pre 500 < T <= 30000 K, 1E-4 <= P <= 100 atm.
+ *  @post none.
+ *  @param coeffs The coefficient table.
+ *  @param decadeRows The pressure groups of the table.
+ *  @param Tmin The temperature breakpoints of the table.
+ *  @param pressure The pressure of the state in atm.
+ *  @param temperature The temperature of the state in K.
+ *  @return The property in the units of the reference.
+*/
+constexpr double AirConstexpr::_logFit (const double (*coeffs)[5],
+                                        const uint32 *decadeRows,
+                                        const double *Tmin, double pressure,
+                                        double temperature)
+{
+    return _logFitAt(coeffs, decadeRows, Tmin, pressure, temperature,
+                     log(temperature / 10000.0));
+}
+
+/** Evaluate an exponential curve fit at a known ln(T / 10000).
+ *
+ *  @pre 500 < T <= 30000 K, 1E-4 <= P <= 100 atm.
+ *  @post none.
+ *  @param coeffs The coefficient table.
+ *  @param decadeRows The pressure groups of the table.
+ *  @param Tmin The temperature breakpoints of the table.
+ *  @param pressure The pressure of the state in atm.
+ *  @param temperature The temperature of the state in K.
+ *  @param x ln(T / 10000).
+ *  @return The property in the units of the reference.
+*/
+constexpr double AirConstexpr::_logFitAt (const double (*coeffs)[5],
+                                          const uint32 *decadeRows,
+                                          const double *Tmin,
+                                          double pressure,
+                                          double temperature, double x)
+{
+    // log10(exp(y)) = y / ln(10)
+    return _interpolateLog(
+               pressure, _lowerOM(pressure), _upperOM(pressure),
+               _expPoly(coeffs[_row(decadeRows, Tmin, _lowerOM(pressure),
+                                    temperature)], x) / _LN10,
+               _expPoly(coeffs[_row(decadeRows, Tmin, _upperOM(pressure),
+                                    temperature)], x) / _LN10);
+}
+
+/** Evaluate a polynomial curve fit (viscosity, compressibility) and
+ *  interpolate it between the pressure groups.
+ *
+ *  @pre 500 < T <= 30000 K, 1E-4 <= P <= 100 atm.
+ *  @post none.
+ *  @param coeffs The coefficient table.
+ *  @param decadeRows The pressure groups of the table.
+ *  @param Tmin The temperature breakpoints of the table.
+ *  @param pressure The pressure of the state in atm.
+ *  @param temperature The temperature of the state in K.
+ *  @return The property in the units of the reference.
+*/
+template <uint32 TERMS>
+constexpr double AirConstexpr::_polyFit (const double (*coeffs)[TERMS],
+                                         const uint32 *decadeRows,
+                                         const double *Tmin,
+                                         double pressure, double temperature)
+{
+    return _interpolateLog(
+               pressure, _lowerOM(pressure), _upperOM(pressure),
+               log10(_horner(coeffs[_row(decadeRows, Tmin,
+                                         _lowerOM(pressure), temperature)],
+                             TERMS, temperature / 1000.0)),
+               log10(_horner(coeffs[_row(decadeRows, Tmin,
+                                         _upperOM(pressure), temperature)],
+                             TERMS, temperature / 1000.0)));
+}
+
+/** A state outside the range of the ADT.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @return The state with NaN properties.
+*/
+constexpr AirConstexpr::State AirConstexpr::_invalid (double pressure,
+                                                      double temperature)
+{
+    return State{ temperature, pressure, _nan(), _nan(), _nan(), _nan(),
+                  _nan(), _nan(), _nan(), _nan(), _nan(), _nan(), _nan(),
+                  _nan(), _nan(), _nan() };
+}
+
+/** Calculate the derived properties from the curve fit properties
+ *  (Air::_calculateDerivedProperties).
+ *
+ *  @pre The curve fit properties belong to the state.
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @param h The enthalpy [units: kJ/kg].
+ *  @param cp The specific heat [units: kJ/kg-K].
+ *  @param k The thermal conductivity [units: W/m-K].
+ *  @param mu The dynamic viscosity [units: kg/m-s].
+ *  @param z The compressibility factor [-dimensionless-].
+ *  @return The state.
+*/
+constexpr AirConstexpr::State AirConstexpr::_derive (double pressure,
+                                                     double temperature,
+                                                     double h, double cp,
+                                                     double k, double mu,
+                                                     double z)
+{
+    return _deriveGas(pressure, temperature, h, cp, k, mu, z,
+                      28.96755 / z);
+}
+
+/** Continue the derived properties with the molar mass.
+ *
+ *  @pre As _derive.
+ *  @post none.
+ *  @param molarMass The molar mass [units: kg/kgmol].
+ *  @return The state.
+*/
+constexpr AirConstexpr::State AirConstexpr::_deriveGas (double pressure,
+                                                        double temperature,
+                                                        double h, double cp,
+                                                        double k, double mu,
+                                                        double z,
+                                                        double molarMass)
+{
+    // R = R_univ / M; rho = P / (Z R T) with 1000.0 = MPa -> kPa.
+    return _deriveState(pressure, temperature, h, cp, k, mu, z, molarMass,
+                        AirCoefficients::rUniv / molarMass,
+                        (pressure * 1000.0)
+                        / (z * (AirCoefficients::rUniv / molarMass)
+                           * temperature),
+                        cp / (cp - AirCoefficients::rUniv / molarMass));
+}
+
+/** Assemble the state.
+ *
+ *  @pre As _derive.
+ *  @post none.
+ *  @param gasConstant The specific gas constant [units: kJ/kg-K].
+ *  @param density The density [units: kg/m^3].
+ *  @param gamma The ratio of specific heats [-dimensionless-].
+ *  @return The state.
+*/
+constexpr AirConstexpr::State AirConstexpr::_deriveState (
+    double pressure, double temperature, double h, double cp, double k,
+    double mu, double z, double molarMass, double gasConstant,
+    double density, double gamma)
+{
+    // The entropy and sound speed follow Air::calculateDerived.
+    return State{ temperature, pressure, h,
+                  h - (pressure * 1000.0 / density),
+                  density, cp, gamma, k,
+                  mu * cp * 1000.0 / k,
+                  mu, mu / density, z, gasConstant, molarMass,
+                  (cp * log(temperature / 300.0))
+                  - (gasConstant * log(pressure / 0.101325)) + 1.70203,
+                  sqrt(gamma * gasConstant * temperature * 1000.0) };
+}
+
+/** The coordinate of a grid node (as in AirTable::generate).
+ *
+ *  @pre n >= 2, i < n.
+ *  @post none.
+ *  @param low The first coordinate.
+ *  @param high The last coordinate.
+ *  @param n The number of nodes.
+ *  @param i The node.
+ *  @return The coordinate.
+*/
+constexpr double AirConstexpr::_axis (double low, double high, uint32 n,
+                                      uint32 i)
+{
+    return ((i + 1) < n) ? low + (high - low) * i / double(n - 1) : high;
+}
+
+/** Keep the rounding of pow10 at the range ends inside the ADT (as in
+ *  AirTable::generate).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The pressure of a node (in MPa).
+ *  @return The pressure, moved onto 1E-4 or 100 atm if it is within
+ *          1E-12 of either.
+*/
+constexpr double AirConstexpr::_clampPressure (double pressure)
+{
+    return ((pressure - 1E-4 * 0.101325) < 1E-12 * (1E-4 * 0.101325))
+           && ((1E-4 * 0.101325 - pressure) < 1E-12 * (1E-4 * 0.101325))
+           ? 1E-4 * 0.101325
+         : ((pressure - 100.0 * 0.101325) < 1E-12 * (100.0 * 0.101325))
+           && ((100.0 * 0.101325 - pressure) < 1E-12 * (100.0 * 0.101325))
+           ? 100.0 * 0.101325
+         : pressure;
+}
+
+/** The value of a property at a node of a grid.
+ *
+ *  @pre index < Grid::NP * Grid::NT.
+ *  @post none.
+ *  @param index The node, T varying fastest.
+ *  @return The property.
+*/
+template <typename Grid, double AirConstexpr::State::*Property>
+constexpr double AirConstexpr::_node (uint32 index)
+{
+    return state(_clampPressure(pow10(_axis(Grid::LOG_P_MIN,
+                                            Grid::LOG_P_MAX, Grid::NP,
+                                            index / Grid::NT))),
+                 _axis(Grid::T_MIN, Grid::T_MAX, Grid::NT,
+                       index % Grid::NT)).*Property;
+}
+
+/** Tabulate one property at every node of a grid.
+ *
+ *  @pre sizeof...(I) == Grid::NP * Grid::NT.
+ *  @post none.
+ *  @return The values.
+*/
+template <typename Grid, double AirConstexpr::State::*Property, uint32... I>
+constexpr AirConstexpr::Values<sizeof...(I)>
+AirConstexpr::_bake (const AirIndexList<I...> &)
+{
+    return Values<sizeof...(I)>{ { _node<Grid, Property>(I)... } };
+}
+
+/******************************************************
+**                  AirBakedTable                    **
+******************************************************/
+
+template <typename Grid, double AirConstexpr::State::*Property>
+constexpr AirConstexpr::Values<Grid::NP * Grid::NT>
+    AirBakedTable<Grid, Property>::values;
+
+/** Interpolate the property at the given state.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @return The property, NaN outside the grid.
+*/
+template <typename Grid, double AirConstexpr::State::*Property>
+double AirBakedTable<Grid, Property>::value (double pressure,
+                                             double temperature)
+{
+    const uint32 cellsP = NP - 1,
+                 cellsT = NT - 1;
+
+    double u = (::log10(pressure) - Grid::LOG_P_MIN)
+               * (cellsP / (Grid::LOG_P_MAX - Grid::LOG_P_MIN)),
+           v = (temperature - Grid::T_MIN)
+               * (cellsT / (Grid::T_MAX - Grid::T_MIN));
+
+    // Tolerate the rounding of the scales at the upper grid edges.
+    if (   !(u >= 0.0) || !(u <= cellsP * (1.0 + 1E-12))
+        || !(v >= 0.0) || !(v <= cellsT * (1.0 + 1E-12)))
+        return std::numeric_limits<double>::quiet_NaN();
+
+    uint32 i = std::min(uint32(u), cellsP - 1),
+           j = std::min(uint32(v), cellsT - 1);
+
+    double fp = std::min(u - i, 1.0),
+           ft = std::min(v - j, 1.0);
+
+    const double *c = values.value + size_t(i) * NT + j;
+
+    return (1.0 - fp) * ((1.0 - ft) * c[0] + ft * c[1])
+         + fp * ((1.0 - ft) * c[NT] + ft * c[NT + 1]);
+}
+
+#endif
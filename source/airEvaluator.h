@@ -0,0 +1,501 @@
+/******************************************************************************
+||  airEvaluator.h      (definition file)                                    ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Evaluators of the equilibrium air ADT specialized at compile time for  ||
+||    a set of output properties.  Air::Evaluator<Density, Viscosity> only   ||
+||    calculates the curve fits and the derived properties that the density  ||
+||    and viscosity depend on; the remaining curve fits and derived          ||
+||    property arithmetic are removed when the template is instantiated.     ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airStats.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airEvaluator.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_EVALUATOR_H
+#define _GH_DEF_AIR_EVALUATOR_H
+
+#include "air.h"
+#include "airStats.h"
+
+/**
+ *  @struct AirPropertySet The union of a list of Air property tags:
+ *          MASK holds the listed properties, and REQUIRES adds every
+ *          property they are derived from.
+*/
+template <typename... Properties>
+struct AirPropertySet
+{
+    static const uint32 MASK = 0, REQUIRES = 0;
+};
+
+template <typename Property, typename... Others>
+struct AirPropertySet<Property, Others...>
+{
+    static const uint32 MASK = Property::MASK
+                               | AirPropertySet<Others...>::MASK;
+    static const uint32 REQUIRES = Property::REQUIRES
+                                   | AirPropertySet<Others...>::REQUIRES;
+};
+
+/**
+ *  @class Air::Evaluator Calculates the property set Properties of
+ *         equilibrium air.  Only the curve fits and derived properties
+ *         in the REQUIRES closure of the set are evaluated, using the
+ *         same helpers (and arithmetic) as Air::calculateProperties,
+ *         so the results are identical.
+*/
+template <typename... Properties>
+class Air::Evaluator
+{
+  public:
+    // The requested properties and every property calculated for them.
+    static const uint32 PROPERTIES = AirPropertySet<Properties...>::MASK;
+    static const uint32 REQUIRED = AirPropertySet<Properties...>::REQUIRES;
+
+    static_assert(PROPERTIES != 0, "An evaluator needs a property");
+
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor.  */
+    Evaluator();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Retrieve a property of the last calculated state.
+     *
+     *  @pre Property is in the set, or is one of the properties the
+     *       set is derived from (checked at compile time).
+     *  @post none.
+     *  @return The value of the property in the units of the Air
+     *          accessor of the same name.
+    */
+    template <typename Property>
+    double get (void) const;
+
+    /** Retrieve the temperature of the last calculated state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The temperature [units: K].
+    */
+    double getTemperature (void) const;
+
+    /** Retrieve the pressure of the last calculated state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The pressure [units: MPa].
+    */
+    double getPressure (void) const;
+
+    /** Calculate the property set at the given pressure and temperature.
+     *
+     *  @pre The object is instantiated.
+     *  @post The properties in REQUIRED are calculated; the others
+     *        keep their previous values.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @return true The calculation was performed successfully.
+     *  @return false The calculation could not be performed.
+    */
+    bool calculateProperties (double pressure, double temperature);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    Air _state;  // The state holding the calculated properties.
+
+};  // end class Air::Evaluator
+
+/******************************************************
+**               Property Tag Accessors              **
+******************************************************/
+
+inline double Air::Enthalpy::get (const Air &state)
+{  return state._enthalpy;  }
+
+inline double Air::SpecificHeat::get (const Air &state)
+{  return state._cp;  }
+
+inline double Air::ThermalConductivity::get (const Air &state)
+{  return state._k;  }
+
+inline double Air::DynamicViscosity::get (const Air &state)
+{  return state._mu;  }
+
+inline double Air::CompressibilityFactor::get (const Air &state)
+{  return state._comp;  }
+
+inline double Air::MolarMass::get (const Air &state)
+{  return state._molarMass;  }
+
+inline double Air::GasConstant::get (const Air &state)
+{  return state._gasConstant;  }
+
+inline double Air::Gamma::get (const Air &state)
+{  return state._gamma;  }
+
+inline double Air::Density::get (const Air &state)
+{  return state._density;  }
+
+inline double Air::InternalEnergy::get (const Air &state)
+{  return state._intEnergy;  }
+
+inline double Air::ThermalDiffusivity::get (const Air &state)
+{  return state._thermalDiff;  }
+
+inline double Air::PrandtlNumber::get (const Air &state)
+{  return state._pr;  }
+
+inline double Air::KinematicViscosity::get (const Air &state)
+{  return state._nu;  }
+
+inline double Air::Entropy::get (const Air &state)
+{  return state._entropy;  }
+
+inline double Air::SoundSpeed::get (const Air &state)
+{  return state._soundSpeed;  }
+
+inline double Air::RefractionIndex::get (const Air &state)
+{  return state._refraction;  }
+
+inline double Air::GibbsFreeEnergy::get (const Air &state)
+{  return state._gibbsEnergy;  }
+
+inline double Air::HelmholtzFreeEnergy::get (const Air &state)
+{  return state._helmholtzEn;  }
+
+inline double Air::ChemicalPotential::get (const Air &state)
+{  return state._chemPoten;  }
+
+inline double Air::SchmidtNumber::get (const Air &state)
+{  return state._schmidt;  }
+
+inline double Air::LewisNumber::get (const Air &state)
+{  return state._lewis;  }
+
+/******************************************************
+**               Derived Properties                  **
+******************************************************/
+
+/** Calculate the derived properties of the set PROPERTIES (the
+ *  MASK bits of the property tags, closed under REQUIRES) from the
+ *  stored primary properties of an Air or AirPrecision state, in the
+ *  precision of the state.
+ *
+ *  @pre The values for _pressure, _temperature, and the primary
+ *       properties in PROPERTIES of state have been calculated.
+ *  @post The derived properties in PROPERTIES are calculated with
+ *        values stored in the appropriate variables of state.
+ *  @param state An Air or AirPrecision state.
+ *  @return none.
+*/
+template <uint32 PROPERTIES, typename State>
+inline void Air::calculateDerived (State &state)
+{
+    typedef decltype(state._temperature) Real;
+
+    using std::log;
+    using std::sqrt;
+
+    // Store the molar mass of air [units: kg/kgmol]
+    if (PROPERTIES & MolarMass::MASK)
+        state._molarMass = Real(28.96755) / state._comp;
+
+    // Store the air gas constant in SI units [Units: kJ/(kg-K)]
+    //    8.314 = Universal gas constant [units: kJ/kgmol-K]
+    if (PROPERTIES & GasConstant::MASK)
+        state._gasConstant = Real(_R_univ) / state._molarMass;
+
+    // Calculate gamma based on the cp value [-dimensionless-]
+    if (PROPERTIES & Gamma::MASK)
+        state._gamma = state._cp / (state._cp - state._gasConstant);
+
+    // Calculate the density [Units: kg/m^3]
+    //    1000.0 = convert MPa -> kPa
+    if (PROPERTIES & Density::MASK)
+        state._density = (state._pressure * Real(1000.0))
+                         / (state._comp * state._gasConstant
+                            * state._temperature);
+
+    // Calculate the internal energy based on the thermodynamic relation:
+    //    h = u + p/rho
+    //    [units: kJ/kg]
+    //    1000.0 = convert MPa -> kPa
+    if (PROPERTIES & InternalEnergy::MASK)
+        state._intEnergy = state._enthalpy
+                           - (state._pressure * Real(1000.0)
+                              / state._density);
+
+    // Calculate the thermal diffusivity [units: m^2/s]
+    //    1000.0 = convert W -> kW
+    if (PROPERTIES & ThermalDiffusivity::MASK)
+        state._thermalDiff = state._k
+                             / (Real(1000.0) * state._density * state._cp);
+
+    // Calculate the Prandtl number (the ratio of thermal and momentum
+    // diffusivities) [-dimensionless-]
+    //    1000.0 = convert kJ -> J. (So that J/s = W)
+    if (PROPERTIES & PrandtlNumber::MASK)
+        state._pr = state._mu * state._cp * Real(1000.0) / state._k;
+
+    // Calculate the kinematic viscosity [units: m^2/s]
+    if (PROPERTIES & KinematicViscosity::MASK)
+        state._nu = state._mu / state._density;
+
+    // Calculate the entropy of the state [units: kJ/kg-K]
+    if (PROPERTIES & Entropy::MASK)
+    {
+        /**************************************************
+        **  REFERENCES                                   **
+        ** --------------------------------------------- **
+        **  1.) Moran, Michael J., Howard N. Shapiro.    **
+        **      "Fundamentals of Engineering             **
+        **      Thermodynamics".  5th Edition.  John     **
+        **      Wiley and Sons.  Hoboken, NJ,  2004.     **
+        **      ISBN 0-471-27471-2.                      **
+        **                                               **
+        **************************************************/
+
+        // Reference temperature, pressure, and entropy values.
+        // (From Table A-22, Ref 1.)
+        const Real T0 = Real(300.0),     // Ref. temperature, 300 K.
+                   p0 = Real(0.101325),  // Ref. pressure 0.101325 MPa.
+                   s0 = Real(1.70203);   // Ref. entropy [kJ/kg-K].
+
+        // This equation assumes a thermally and calorically perfect
+        // gas, (it is a limitation) but it's a pretty good assumption
+        // for most air cases.
+        //
+        //    (From Equation 6.23, Ref 1.)
+        state._entropy =
+              (state._cp * log(state._temperature / T0))   // Caloric
+            - (state._gasConstant * log(state._pressure / p0))
+            + s0;                                          // Ref. offset
+    }
+
+    // Calculate the speed of sound [units: m/s]
+    //    1000.0 = convert kJ -> J
+    if (PROPERTIES & SoundSpeed::MASK)
+        state._soundSpeed = sqrt(state._gamma * state._gasConstant
+                                 * state._temperature * Real(1000.0));
+
+    // Calculate the refractive index [-dimensionless-]
+    if (PROPERTIES & RefractionIndex::MASK)
+    {
+        /**************************************************
+        **  REFERENCES                                   **
+        ** --------------------------------------------- **
+        **  1.) Liepmann, H. W., A. Roshko.  "Elements   **
+        **      of Gasdynamics".  Dover Publications.    **
+        **      2001.  (original copyright: New York.    **
+        **      John Wiley & Sons.  1957.)               **
+        **      ISBN 978-0-486-41963-3.                  **
+        **                                               **
+        **************************************************/
+
+        const Real beta = Real(0.000292),            // Ref 1.
+                   rho0 = Real(1.2925694365458342);  // @ STP [kg/m^3].
+
+        state._refraction = Real(1.0) + (beta * state._density / rho0);
+    }
+
+    // Calculate the specific Gibbs free energy (enthalpy) using the relation:
+    //    G = H - TS
+    //    [units: kJ/kg]
+    if (PROPERTIES & GibbsFreeEnergy::MASK)
+        state._gibbsEnergy = state._enthalpy
+                             - (state._temperature * state._entropy);
+
+    // Calculate the specific Helmholtz free energy using the relation:
+    //    F = U - TS
+    //    [units: kJ/kg]
+    if (PROPERTIES & HelmholtzFreeEnergy::MASK)
+        state._helmholtzEn = state._intEnergy
+                             - (state._temperature * state._entropy);
+
+    // Calculate the chemical potential of the state which is defined as
+    // the Gibbs function (total) divided by the molar amount of substance.
+    // (Which is also the specific Gibbs function multiplied by the molar
+    // mass of the substance).  [units: kJ/kgmol]
+    //
+    //    ch = G / n = gm / n = gM
+    if (PROPERTIES & ChemicalPotential::MASK)
+        state._chemPoten = state._gibbsEnergy * state._molarMass;
+
+    // Calculate the Schmidt number assuming an air-O2 binary diffusion
+    // coefficient which is useful for calculating catalitic
+    // effects. [-dimensionless-]
+    //
+    //    0.24 x 10^-4 = binary diffusion coefficient of O2 in air at 298 K.
+    if (PROPERTIES & SchmidtNumber::MASK)
+        state._schmidt = state._nu / Real(0.21E-4);
+
+    // Calculate the Lewis number. [-dimensionless-]
+    if (PROPERTIES & LewisNumber::MASK)
+        state._lewis = state._schmidt / state._pr;
+
+    return;
+}
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor.  */
+template <typename... Properties>
+Air::Evaluator<Properties...>::Evaluator()
+  : _state()
+{}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Retrieve a property of the last calculated state.
+ *
+ *  @pre Property is in the set, or is one of the properties the
+ *       set is derived from (checked at compile time).
+ *  @post none.
+ *  @return The value of the property in the units of the Air
+ *          accessor of the same name.
+*/
+template <typename... Properties>
+template <typename Property>
+inline double Air::Evaluator<Properties...>::get (void) const
+{
+    static_assert((REQUIRED & Property::MASK) != 0,
+                  "The property is not calculated by this evaluator");
+
+    return Property::get(_state);
+}
+
+/** Retrieve the temperature of the last calculated state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The temperature [units: K].
+*/
+template <typename... Properties>
+inline double Air::Evaluator<Properties...>::getTemperature (void) const
+{  return _state._temperature;  }
+
+/** Retrieve the pressure of the last calculated state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The pressure [units: MPa].
+*/
+template <typename... Properties>
+inline double Air::Evaluator<Properties...>::getPressure (void) const
+{  return _state._pressure;  }
+
+/** Calculate the property set at the given pressure and temperature.
+ *
+ *  @pre The object is instantiated.
+ *  @post The properties in REQUIRED are calculated; the others
+ *        keep their previous values.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @return true The calculation was performed successfully.
+ *  @return false The calculation could not be performed.
+*/
+template <typename... Properties>
+bool Air::Evaluator<Properties...>::calculateProperties (double pressure,
+                                                         double temperature)
+{
+    AIR_STATS_COUNT(CALLS_PROPERTIES);
+
+    Air &state = _state;
+
+    // The curve fit helpers read the stored temperature (and the stored
+    // pressure in atm for the interpolation), so the state is prepared
+    // exactly as in Air::calculateProperties.
+    state._temperature = temperature;
+    state._pressure = pressure / 0.101325;
+
+    // 1E-4 <= _pressure <= 100 atm
+    // 0 <= _temperature <= 30,000 K
+    if (   (state._pressure < 1E-4)   || (state._pressure > 100.0)
+        || (temperature < 0.0)        || (temperature > 30000.0)
+        )
+    {
+        AIR_STATS_COUNT(REJECT_RANGE);
+
+        state._pressure = state._pressure * 0.101325;
+        return false;
+    }
+
+    AIR_STATS_DECADE(state._getDecade(state._pressure));
+
+    state._pressure = state._pressure * 0.101325;
+
+    // The unused curve fits are constant false branches, which the
+    // compiler drops from the instantiation.
+    if (REQUIRED & Enthalpy::MASK)
+        state._enthalpy = state._calculateEnthalpy(pressure, temperature);
+
+    if (REQUIRED & SpecificHeat::MASK)
+        state._cp = state._calculateSpecificHeat(pressure, temperature);
+
+    if (REQUIRED & ThermalConductivity::MASK)
+        state._k = state._calculateThermalCond(pressure, temperature);
+
+    if (REQUIRED & DynamicViscosity::MASK)
+        state._mu = state._calculateViscosity(pressure, temperature);
+
+    if (REQUIRED & CompressibilityFactor::MASK)
+        state._comp = state._calculateCompFactor(pressure, temperature);
+
+    calculateDerived<REQUIRED>(state);
+
+    return true;
+}
+
+#endif
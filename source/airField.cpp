@@ -0,0 +1,464 @@
+/******************************************************************************
+||  airField.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A container of the equilibrium air properties of every cell of a       ||
+||    mesh.  update() compares the input of every cell with the input of     ||
+||    its last evaluation, gathers the dirty and moved cells into blocks,    ||
+||    evaluates each block with AirBatch, and scatters the rows back into    ||
+||    the property columns.                                                  ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airField.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airField.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Cells gathered per AirBatch call; the inputs and rows of a block stay
+// in the L1 cache between the gather, the evaluation, and the scatter.
+static const size_t GATHER_BLOCK = 512;
+
+// The input of new cells.
+static const double DEFAULT_PRESSURE = 0.101325,    // [units: MPa]
+                    DEFAULT_TEMPERATURE = 300.0;    // [units: K]
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (no cells, every property).  */
+AirField::AirField()
+  : _batch(), _size(0), _tolerance(0.0), _lastEvaluated(0),
+    _evaluations(0), _skips(0)
+{  }
+
+/** Copy constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created from the copied values.
+ *  @param copyFrom An AirField object whose values are copied.
+ *  @return none.
+*/
+AirField::AirField (const AirField &copyFrom)
+  : _batch(copyFrom._batch), _size(copyFrom._size),
+    _tolerance(copyFrom._tolerance), _inputs(copyFrom._inputs),
+    _evaluated(copyFrom._evaluated), _dirty(copyFrom._dirty),
+    _columns(copyFrom._columns), _lastEvaluated(copyFrom._lastEvaluated),
+    _evaluations(copyFrom._evaluations), _skips(copyFrom._skips)
+{  }
+
+/** Initialization constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created with size dirty cells at
+ *        (0.101325 MPa, 300 K) and every property column.
+ *  @param size The number of cells.
+*/
+AirField::AirField (size_t size)
+  : _batch(), _size(0), _tolerance(0.0), _lastEvaluated(0),
+    _evaluations(0), _skips(0)
+{
+    resize(size);
+}
+
+/** Default destructor.  */
+AirField::~AirField() {}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+////////////////////
+//    Getters
+////////////////////
+
+/** Retrieve the number of cells.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _size.
+*/
+size_t AirField::getSize (void) const
+{  return _size;  }
+
+/** Retrieve the column selection (and its property names).
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The AirBatch that evaluates the cells.
+*/
+const AirBatch & AirField::getBatch (void) const
+{  return _batch;  }
+
+/** Retrieve the tolerance of the field.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _tolerance.
+*/
+double AirField::getTolerance (void) const
+{  return _tolerance;  }
+
+/** Retrieve the input pressure of a cell.
+ *
+ *  @pre cell < getSize().
+ *  @post none.
+ *  @param cell The cell.
+ *  @return The pressure [units: MPa].
+*/
+double AirField::getPressure (size_t cell) const
+{  return _inputs[2 * cell];  }
+
+/** Retrieve the input temperature of a cell.
+ *
+ *  @pre cell < getSize().
+ *  @post none.
+ *  @param cell The cell.
+ *  @return The temperature [units: K].
+*/
+double AirField::getTemperature (size_t cell) const
+{  return _inputs[2 * cell + 1];  }
+
+/** Retrieve a property column.
+ *
+ *  @pre column < getBatch().getNumColumns().
+ *  @post none.
+ *  @param column The output column.
+ *  @return The getSize() values of the column (as of the last
+ *          update).
+*/
+const double * AirField::getColumn (uint32 column) const
+{  return _columns.empty() ? NULL : &_columns[column * _size];  }
+
+/** Retrieve a property of a cell.
+ *
+ *  @pre cell < getSize() and column < getBatch().getNumColumns().
+ *  @post none.
+ *  @param cell The cell.
+ *  @param column The output column.
+ *  @return The value of the property (as of the last update).
+*/
+double AirField::getValue (size_t cell, uint32 column) const
+{  return _columns[column * _size + cell];  }
+
+/** Retrieve the number of cells evaluated by the last update.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _lastEvaluated.
+*/
+size_t AirField::getLastEvaluated (void) const
+{  return _lastEvaluated;  }
+
+/** Retrieve the number of cell evaluations of every update.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _evaluations.
+*/
+uint64 AirField::getEvaluations (void) const
+{  return _evaluations;  }
+
+/** Retrieve the number of cells skipped by every update.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _skips.
+*/
+uint64 AirField::getSkips (void) const
+{  return _skips;  }
+
+////////////////////
+//    Setters
+////////////////////
+
+/** Change the number of cells.
+ *
+ *  @pre The object is instantiated.
+ *  @post The first min(size, getSize()) cells are kept; new cells
+ *        are dirty at (0.101325 MPa, 300 K).
+ *  @param size The number of cells.
+ *  @return none.
+*/
+void AirField::resize (size_t size)
+{
+    const double NaN = std::numeric_limits<double>::quiet_NaN();
+    size_t kept = std::min(size, _size);
+    uint32 numColumns = _batch.getNumColumns();
+
+    // The columns are stored one after the other, so they move.
+    std::vector<double> columns(size * numColumns, NaN);
+
+    for (uint32 c = 0; c < numColumns; ++c)
+        std::copy(_columns.begin() + c * _size,
+                  _columns.begin() + c * _size + kept,
+                  columns.begin() + c * size);
+
+    _columns.swap(columns);
+
+    _inputs.resize(2 * size);
+    _evaluated.resize(2 * size, NaN);
+    _dirty.resize(size, 1);
+
+    for (size_t i = kept; i < size; ++i)
+    {
+        _inputs[2 * i] = DEFAULT_PRESSURE;
+        _inputs[2 * i + 1] = DEFAULT_TEMPERATURE;
+    }
+
+    _size = size;
+    return;
+}
+
+/** Select the property columns.
+ *
+ *  @pre As AirBatch::setColumns.
+ *  @post The columns are replaced and every cell is dirty.
+ *  @param properties The property of each column.
+ *  @param count The number of columns.
+ *  @return true The columns were selected.
+ *  @return false As AirBatch::setColumns; nothing is changed.
+*/
+bool AirField::setColumns (const uint32 *properties, uint32 count)
+{
+    if (!_batch.setColumns(properties, count))
+        return false;
+
+    _resetColumns();
+    return true;
+}
+
+/** Select the property columns by name.
+ *
+ *  @pre As AirBatch::setColumns.
+ *  @post The columns are replaced and every cell is dirty.
+ *  @param list The comma-separated property names (or "all").
+ *  @return true The columns were selected.
+ *  @return false As AirBatch::setColumns; nothing is changed.
+*/
+bool AirField::setColumns (const char *list)
+{
+    if (!_batch.setColumns(list))
+        return false;
+
+    _resetColumns();
+    return true;
+}
+
+/** Set the tolerance of the field.  Every evaluation gives all the
+ *  columns of a cell, so one tolerance applies to all of them.
+ *
+ *  @pre The object is instantiated.
+ *  @post _tolerance is updated.
+ *  @param tolerance The accepted relative change of the pressure and
+ *         temperature of a cell before it is evaluated again (0
+ *         re-evaluates on any change).
+ *  @return true The tolerance was set.
+ *  @return false tolerance is negative or not finite.
+*/
+bool AirField::setTolerance (double tolerance)
+{
+    if (!(tolerance >= 0.0)
+        || (tolerance > std::numeric_limits<double>::max()))
+        return false;
+
+    _tolerance = tolerance;
+    return true;
+}
+
+/** Set the input of a cell.
+ *
+ *  @pre cell < getSize().
+ *  @post The input is stored; the columns change at the next
+ *        update.
+ *  @param cell The cell.
+ *  @param pressure The pressure [units: MPa].
+ *  @param temperature The temperature [units: K].
+ *  @return none.
+*/
+void AirField::setInput (size_t cell, double pressure, double temperature)
+{
+    _inputs[2 * cell] = pressure;
+    _inputs[2 * cell + 1] = temperature;
+    return;
+}
+
+/** Set the inputs of every cell.
+ *
+ *  @pre states holds 2 * getSize() values.
+ *  @post The inputs are stored; the columns change at the next
+ *        update.
+ *  @param states The interleaved (pressure [MPa], temperature [K])
+ *         pairs.
+ *  @return none.
+*/
+void AirField::setInputs (const double *states)
+{
+    std::copy(states, states + 2 * _size, _inputs.begin());
+    return;
+}
+
+/** Force the evaluation of a cell at the next update.
+ *
+ *  @pre cell < getSize().
+ *  @post The cell is dirty.
+ *  @param cell The cell.
+ *  @return none.
+*/
+void AirField::markDirty (size_t cell)
+{
+    _dirty[cell] = 1;
+    return;
+}
+
+/** Force the evaluation of every cell at the next update.
+ *
+ *  @pre The object is instantiated.
+ *  @post Every cell is dirty.
+ *  @return none.
+*/
+void AirField::markAllDirty (void)
+{
+    std::fill(_dirty.begin(), _dirty.end(), 1);
+    return;
+}
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Re-evaluate the dirty and moved cells.
+ *
+ *  @pre The object is instantiated.
+ *  @post The columns of the re-evaluated cells are updated and
+ *        no cell is dirty.
+ *  @return The number of cells that were evaluated.
+*/
+size_t AirField::update (void)
+{
+    uint32 numColumns = _batch.getNumColumns();
+    double tolerance = _tolerance;
+
+    // Find the dirty and moved cells.  The comparisons are written so
+    // that NaN inputs (or a NaN last evaluation) count as moved.
+    _gatherCells.clear();
+
+    for (size_t i = 0; i < _size; ++i)
+    {
+        double pressure = _inputs[2 * i],
+               temperature = _inputs[2 * i + 1],
+               lastPressure = _evaluated[2 * i],
+               lastTemperature = _evaluated[2 * i + 1];
+
+        if (_dirty[i]
+            || !(std::fabs(pressure - lastPressure)
+                 <= tolerance * std::fabs(lastPressure))
+            || !(std::fabs(temperature - lastTemperature)
+                 <= tolerance * std::fabs(lastTemperature)))
+            _gatherCells.push_back(i);
+    }
+
+    size_t count = _gatherCells.size();
+
+    _gatherInputs.resize(2 * GATHER_BLOCK);
+    _gatherRows.resize(GATHER_BLOCK * numColumns);
+
+    // Gather, evaluate, and scatter one block at a time.
+    for (size_t first = 0; first < count; first += GATHER_BLOCK)
+    {
+        size_t block = std::min(GATHER_BLOCK, count - first);
+        const size_t *cells = &_gatherCells[first];
+
+        for (size_t b = 0; b < block; ++b)
+        {
+            _gatherInputs[2 * b] = _inputs[2 * cells[b]];
+            _gatherInputs[2 * b + 1] = _inputs[2 * cells[b] + 1];
+        }
+
+        _batch.evaluate(AirBatch::INPUT_PT, &_gatherInputs[0], block,
+                        &_gatherRows[0]);
+
+        for (uint32 c = 0; c < numColumns; ++c)
+        {
+            double *column = &_columns[c * _size];
+
+            for (size_t b = 0; b < block; ++b)
+                column[cells[b]] = _gatherRows[b * numColumns + c];
+        }
+
+        for (size_t b = 0; b < block; ++b)
+        {
+            _evaluated[2 * cells[b]] = _gatherInputs[2 * b];
+            _evaluated[2 * cells[b] + 1] = _gatherInputs[2 * b + 1];
+            _dirty[cells[b]] = 0;
+        }
+    }
+
+    _lastEvaluated = count;
+    _evaluations += count;
+    _skips += _size - count;
+
+    return count;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Resize the columns to the selected columns and mark every cell
+ *  dirty.
+ *
+ *  @pre _batch and _size are set.
+ *  @post _columns holds NaN for every cell of every column.
+ *  @return none.
+*/
+void AirField::_resetColumns (void)
+{
+    _columns.assign(_size * _batch.getNumColumns(),
+                    std::numeric_limits<double>::quiet_NaN());
+    markAllDirty();
+    return;
+}
@@ -0,0 +1,344 @@
+/******************************************************************************
+||  airField.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A container of the equilibrium air properties of every cell of a       ||
+||    mesh.  The field holds the (pressure, temperature) input of each cell  ||
+||    and one array per selected property column.  update() only             ||
+||    re-evaluates the cells that were marked dirty or whose inputs moved    ||
+||    by more than the tolerance of the field since their last evaluation;   ||
+||    those cells are gathered into one batch, evaluated together, and       ||
+||    scattered back into the columns.                                       ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airField.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airField.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_FIELD_H
+#define _GH_DEF_AIR_FIELD_H
+
+#include "airBatch.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ *  @class AirField Stores the selected properties of a field of states
+ *         and recomputes only the cells whose inputs changed.
+ *
+ *  Each property column is a contiguous array of getSize() values in
+ *  the units of the Air accessors (NaN for cells that cannot be
+ *  evaluated).  A cell is evaluated again by update() when it was
+ *  marked dirty, or when the relative change of its pressure or
+ *  temperature since its last evaluation is larger than the tolerance
+ *  of the field (an evaluation gives every column of the cell, so the
+ *  columns share it).  With the default tolerance of
+ *  zero any change of the inputs re-evaluates the cell, so the columns
+ *  always equal a full evaluation.
+*/
+class AirField
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (no cells, every property).  */
+    AirField();
+
+    /** Copy constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created from the copied values.
+     *  @param copyFrom An AirField object whose values are copied.
+     *  @return none.
+    */
+    AirField (const AirField &copyFrom);
+
+    /** Initialization constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created with size dirty cells at
+     *        (0.101325 MPa, 300 K) and every property column.
+     *  @param size The number of cells.
+    */
+    AirField (size_t size);
+
+    /** Default destructor.  */
+    ~AirField();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    ////////////////////
+    //    Getters
+    ////////////////////
+
+    /** Retrieve the number of cells.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _size.
+    */
+    size_t getSize (void) const;
+
+    /** Retrieve the column selection (and its property names).
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The AirBatch that evaluates the cells.
+    */
+    const AirBatch & getBatch (void) const;
+
+    /** Retrieve the tolerance of the field.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _tolerance.
+    */
+    double getTolerance (void) const;
+
+    /** Retrieve the input pressure of a cell.
+     *
+     *  @pre cell < getSize().
+     *  @post none.
+     *  @param cell The cell.
+     *  @return The pressure [units: MPa].
+    */
+    double getPressure (size_t cell) const;
+
+    /** Retrieve the input temperature of a cell.
+     *
+     *  @pre cell < getSize().
+     *  @post none.
+     *  @param cell The cell.
+     *  @return The temperature [units: K].
+    */
+    double getTemperature (size_t cell) const;
+
+    /** Retrieve a property column.
+     *
+     *  @pre column < getBatch().getNumColumns().
+     *  @post none.
+     *  @param column The output column.
+     *  @return The getSize() values of the column (as of the last
+     *          update).
+    */
+    const double * getColumn (uint32 column) const;
+
+    /** Retrieve a property of a cell.
+     *
+     *  @pre cell < getSize() and column < getBatch().getNumColumns().
+     *  @post none.
+     *  @param cell The cell.
+     *  @param column The output column.
+     *  @return The value of the property (as of the last update).
+    */
+    double getValue (size_t cell, uint32 column) const;
+
+    /** Retrieve the number of cells evaluated by the last update.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _lastEvaluated.
+    */
+    size_t getLastEvaluated (void) const;
+
+    /** Retrieve the number of cell evaluations of every update.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _evaluations.
+    */
+    uint64 getEvaluations (void) const;
+
+    /** Retrieve the number of cells skipped by every update.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _skips.
+    */
+    uint64 getSkips (void) const;
+
+    ////////////////////
+    //    Setters
+    ////////////////////
+
+    /** Change the number of cells.
+     *
+     *  @pre The object is instantiated.
+     *  @post The first min(size, getSize()) cells are kept; new cells
+     *        are dirty at (0.101325 MPa, 300 K).
+     *  @param size The number of cells.
+     *  @return none.
+    */
+    void resize (size_t size);
+
+    /** Select the property columns.
+     *
+     *  @pre As AirBatch::setColumns.
+     *  @post The columns are replaced and every cell is dirty.
+     *  @param properties The property of each column.
+     *  @param count The number of columns.
+     *  @return true The columns were selected.
+     *  @return false As AirBatch::setColumns; nothing is changed.
+    */
+    bool setColumns (const uint32 *properties, uint32 count);
+
+    /** Select the property columns by name.
+     *
+     *  @pre As AirBatch::setColumns.
+     *  @post The columns are replaced and every cell is dirty.
+     *  @param list The comma-separated property names (or "all").
+     *  @return true The columns were selected.
+     *  @return false As AirBatch::setColumns; nothing is changed.
+    */
+    bool setColumns (const char *list);
+
+    /** Set the tolerance of the field.  Every evaluation gives all the
+     *  columns of a cell, so one tolerance applies to all of them.
+     *
+     *  @pre The object is instantiated.
+     *  @post _tolerance is updated.
+     *  @param tolerance The accepted relative change of the pressure and
+     *         temperature of a cell before it is evaluated again (0
+     *         re-evaluates on any change).
+     *  @return true The tolerance was set.
+     *  @return false tolerance is negative or not finite.
+    */
+    bool setTolerance (double tolerance);
+
+    /** Set the input of a cell.
+     *
+     *  @pre cell < getSize().
+     *  @post The input is stored; the columns change at the next
+     *        update.
+     *  @param cell The cell.
+     *  @param pressure The pressure [units: MPa].
+     *  @param temperature The temperature [units: K].
+     *  @return none.
+    */
+    void setInput (size_t cell, double pressure, double temperature);
+
+    /** Set the inputs of every cell.
+     *
+     *  @pre states holds 2 * getSize() values.
+     *  @post The inputs are stored; the columns change at the next
+     *        update.
+     *  @param states The interleaved (pressure [MPa], temperature [K])
+     *         pairs.
+     *  @return none.
+    */
+    void setInputs (const double *states);
+
+    /** Force the evaluation of a cell at the next update.
+     *
+     *  @pre cell < getSize().
+     *  @post The cell is dirty.
+     *  @param cell The cell.
+     *  @return none.
+    */
+    void markDirty (size_t cell);
+
+    /** Force the evaluation of every cell at the next update.
+     *
+     *  @pre The object is instantiated.
+     *  @post Every cell is dirty.
+     *  @return none.
+    */
+    void markAllDirty (void);
+
+    /******************************************************
+    **                 Public Methods                    **
+    ******************************************************/
+
+    /** Re-evaluate the dirty and moved cells.
+     *
+     *  @pre The object is instantiated.
+     *  @post The columns of the re-evaluated cells are updated and
+     *        no cell is dirty.
+     *  @return The number of cells that were evaluated.
+    */
+    size_t update (void);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    AirBatch _batch;       // Column selection and evaluation.
+    size_t _size;          // Number of cells.
+
+    double _tolerance;     // Accepted relative change of the inputs.
+
+    std::vector<double> _inputs;     // Current (P, T) pairs.
+    std::vector<double> _evaluated;  // (P, T) pairs of the last evaluation.
+    std::vector<unsigned char> _dirty;   // Cells forced to be evaluated.
+    std::vector<double> _columns;    // Column-major values, _size per column.
+
+    // Scratch space of update(): the gathered cells, their inputs, and
+    // the evaluated rows.
+    std::vector<size_t> _gatherCells;
+    std::vector<double> _gatherInputs;
+    std::vector<double> _gatherRows;
+
+    size_t _lastEvaluated;  // Cells evaluated by the last update.
+    uint64 _evaluations,    // Cells evaluated by every update.
+           _skips;          // Cells skipped by every update.
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Resize the columns to the selected columns and mark every cell
+     *  dirty.
+     *
+     *  @pre _batch and _size are set.
+     *  @post _columns holds NaN for every cell of every column.
+     *  @return none.
+    */
+    void _resetColumns (void);
+
+};  // end class AirField
+
+#endif
@@ -0,0 +1,900 @@
+/******************************************************************************
+||  airPrecision.cpp      (implementation file)                              ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    The equilibrium air curve fits evaluated in a chosen floating-point    ||
+||    precision.  The coefficient tables, the log-linear pressure            ||
+||    interpolation, and the curve fit helpers are templated on the value    ||
+||    type, and the derived properties come from the pipeline of Air         ||
+||    (Air::calculateDerived) in that type; the float instantiation stores   ||
+||    its coefficient tables as float and uses the float transcendentals.    ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airCoefficients.h                                                      ||
+||    airEvaluator.h                                                         ||
+||    airPrecision.h                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airPrecision.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airPrecision.h"
+#include "airCoefficients.h"
+#include "airEvaluator.h"
+
+#include <limits>
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor.  */
+template <typename Real>
+AirPrecision<Real>::AirPrecision()
+  : _temperature(0), _pressure(0), _enthalpy(0), _intEnergy(0),
+    _density(0), _cp(0), _gamma(0), _k(0), _pr(0), _mu(0), _nu(0),
+    _comp(0), _gasConstant(0), _molarMass(0), _thermalDiff(0), _entropy(0),
+    _soundSpeed(0), _refraction(0), _gibbsEnergy(0), _helmholtzEn(0),
+    _chemPoten(0), _schmidt(0), _lewis(0)
+{}
+
+/** Copy constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created from the copied values.
+ *  @param copyFrom An AirPrecision object whose values are copied.
+ *  @return none.
+*/
+template <typename Real>
+AirPrecision<Real>::AirPrecision (const AirPrecision &copyFrom)
+  : _temperature(copyFrom._temperature), _pressure(copyFrom._pressure),
+    _enthalpy(copyFrom._enthalpy), _intEnergy(copyFrom._intEnergy),
+    _density(copyFrom._density), _cp(copyFrom._cp),
+    _gamma(copyFrom._gamma), _k(copyFrom._k), _pr(copyFrom._pr),
+    _mu(copyFrom._mu), _nu(copyFrom._nu), _comp(copyFrom._comp),
+    _gasConstant(copyFrom._gasConstant), _molarMass(copyFrom._molarMass),
+    _thermalDiff(copyFrom._thermalDiff), _entropy(copyFrom._entropy),
+    _soundSpeed(copyFrom._soundSpeed), _refraction(copyFrom._refraction),
+    _gibbsEnergy(copyFrom._gibbsEnergy), _helmholtzEn(copyFrom._helmholtzEn),
+    _chemPoten(copyFrom._chemPoten), _schmidt(copyFrom._schmidt),
+    _lewis(copyFrom._lewis)
+{}
+
+/** Default destructor.  */
+template <typename Real>
+AirPrecision<Real>::~AirPrecision() {}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+////////////////////
+//    Getters
+////////////////////
+
+/** Retrieve the temperature of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _temperature [units: K].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getTemperature (void) const
+{  return _temperature;  }
+
+/** Retrieve the pressure of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _pressure [units: MPa].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getPressure (void) const
+{  return _pressure;  }
+
+/** Retrieve the enthalpy of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _enthalpy [units: kJ/kg].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getEnthalpy (void) const
+{  return _enthalpy;  }
+
+/** Retrieve the internal energy of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _intEnergy [units: kJ/kg].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getInternalEnergy (void) const
+{  return _intEnergy;  }
+
+/** Retrieve the density of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _density [units: kg/m^3].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getDensity (void) const
+{  return _density;  }
+
+/** Retrieve the isobaric specific heat of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _cp [units: kJ/kg-K].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getSpecificHeat (void) const
+{  return _cp;  }
+
+/** Retrieve the ratio of specific heats of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _gamma [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getGamma (void) const
+{  return _gamma;  }
+
+/** Retrieve the thermal conductivity of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _k [units: W/m-K].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getThermalConductivity (void) const
+{  return _k;  }
+
+/** Retrieve the Prandtl number of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _pr [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getPrandtlNumber (void) const
+{  return _pr;  }
+
+/** Retrieve the dynamic viscosity of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _mu [units: g/cm-s].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getDynamicViscosity (void) const
+{  return _mu;  }
+
+/** Retrieve the kinematic viscosity of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _nu [units: m^2/s].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getKinematicViscosity (void) const
+{  return _nu;  }
+
+/** Retrieve the compressibility factor of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _comp [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getCompressibilityFactor (void) const
+{  return _comp;  }
+
+/** Retrieve the gas constant of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _gasConstant [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getGasConstant (void) const
+{  return _gasConstant;  }
+
+/** Retrieve the molar mass of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _molarMass [units: kg/kgmol].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getMolarMass (void) const
+{  return _molarMass;  }
+
+/** Retrieve the specific entropy of the state (note: in this
+ *  implementation, entropy is a derived quantity).
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _entropy [units: kJ/kg-K]
+*/
+template <typename Real>
+Real AirPrecision<Real>::getEntropy (void) const
+{  return _entropy;  }
+
+/** Retrieve the calculated speed of sound of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _soundSpeed [units: m/s]
+*/
+template <typename Real>
+Real AirPrecision<Real>::getSoundSpeed (void) const
+{  return _soundSpeed;  }
+
+/** Retrieve the calculated index of refraction of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _refraction [-dimensionless-]
+*/
+template <typename Real>
+Real AirPrecision<Real>::getRefractionIndex (void) const
+{  return _refraction;  }
+
+/** Retrieve the specific Gibbs free energy (enthalpy) of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _gibbsEnergy [units: kJ/kg]
+*/
+template <typename Real>
+Real AirPrecision<Real>::getGibbsFreeEnergy (void) const
+{  return _gibbsEnergy;  }
+
+/** Retrieve the specific Helmholtz free energy of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _helmholtzEn [units: kJ/kg]
+*/
+template <typename Real>
+Real AirPrecision<Real>::getHelmholtzFreeEnergy (void) const
+{  return _helmholtzEn;  }
+
+/** Retrieve the chemical potential of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _chemPoten [units: kJ/kgmol].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getChemicalPotential (void) const
+{  return _chemPoten;  }
+
+/** Retrieve the Schmidt number of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _schmidt [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getSchmidtNumber (void) const
+{  return _schmidt;  }
+
+/** Retrieve the Lewis number of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _lewis [-dimensionless-].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getLewisNumber (void) const
+{  return _lewis;  }
+
+/** Retrieve the thermal diffusivity of the state.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _thermalDiff [units: m^2/s].
+*/
+template <typename Real>
+Real AirPrecision<Real>::getThermalDiffusivity (void) const
+{  return _thermalDiff;  }
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Reset the properties to zero.
+ *
+ *  @pre The object is instantiated.
+ *  @post Every property is zero.
+ *  @return none.
+*/
+template <typename Real>
+void AirPrecision<Real>::reset (void)
+{
+    _temperature = _pressure = _enthalpy = _intEnergy = 0;
+    _density = _cp = _gamma = _k = _pr = _mu = _nu = _comp = 0;
+    _gasConstant = _molarMass = _thermalDiff = _entropy = _soundSpeed = 0;
+    _refraction = _gibbsEnergy = _helmholtzEn = _chemPoten = 0;
+    _schmidt = _lewis = 0;
+
+    return;
+}
+
+/** Calculate the properties of air at the given pressure and
+ *  temperature.
+ *
+ *  @pre The object is instantiated.
+ *  @post The properties are calculated with values
+ *        stored in the appropriate variables.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @return true The calculation was performed successfully.
+ *  @return false The calculation could not be performed.
+*/
+template <typename Real>
+bool AirPrecision<Real>::calculateProperties (Real pressure,
+                                              Real temperature)
+{
+    _temperature = temperature;
+    _pressure = pressure;
+
+    // The calculation assumes pressure in units of atm.
+    //   0.101325 = conversion factor MPa -> atm
+    Real atm = pressure / Real(0.101325);
+
+    // 1E-4 <= P <= 100 atm, 0 <= T <= 30,000 K
+    if (   (atm < Real(1E-4))        || (atm > Real(100.0))
+        || (temperature < Real(0.0)) || (temperature > Real(30000.0))
+        )
+        return false;
+
+    const Tables &tables = _getTables();
+    Bracket bracket = _getBracket(tables, atm);
+
+    _enthalpy = _calculateEnthalpy(tables, bracket, temperature);
+    _cp = _calculateSpecificHeat(tables, bracket, temperature);
+    _k = _calculateThermalCond(tables, bracket, temperature);
+    _mu = _calculateViscosity(tables, bracket, temperature);
+    _comp = _calculateCompFactor(tables, bracket, temperature);
+
+    // Calculate the remaining thermodynamic properties.
+    _calculateDerivedProperties();
+
+    return true;
+}
+
+/** Calculate the properties of air at the given pressure and
+ *  enthalpy with the temperature search of Air.
+ *
+ *  @pre The object is instantiated and enthalpy does not exceed
+ *       AirBatch::MAX_PH_ENTHALPY.
+ *  @post The properties are calculated with values
+ *        stored in the appropriate variables.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param enthalpy The air enthalpy of the state (in kJ/kg).
+ *  @return true The calculation was performed successfully.
+ *  @return false The calculation could not be performed.
+*/
+template <typename Real>
+bool AirPrecision<Real>::calculateProps_PH (Real pressure, Real enthalpy)
+{
+    _pressure = pressure;
+
+    Real atm = pressure / Real(0.101325);
+
+    // The search evaluates the enthalpy fits only, so the range of the
+    // pressure is checked before the bracket is formed.
+    if ((atm < Real(1E-4)) || (atm > Real(100.0)))
+        return false;
+
+    const Tables &tables = _getTables();
+    Bracket bracket = _getBracket(tables, atm);
+
+    // Guess an initial temperature based on a nominal STP
+    // specific heat (1.005 kJ/kg-K) and the input enthalpy.
+    Real temperature = enthalpy / Real(1.005);  // units: K
+
+    // Enthalpy convergence tolerance [units: kJ/kg].  Air uses 1E-4;
+    // in float that is below the spacing of the enthalpy values, so
+    // the tolerance is widened to a few units in the last place.
+    Real tolerance = Real(8) * std::numeric_limits<Real>::epsilon()
+                             * std::fabs(enthalpy);
+
+    if (tolerance < Real(1E-4))
+        tolerance = Real(1E-4);
+
+    Real calcH = 0,             // The calculated enthalpy [units: kJ/kg]
+         deltaT = 1000,         // Iterative temperature interval [units: K]
+         T_under = 0,           // Stored temp. from prev. low iteration [K]
+         h_under = 0;           // Stored enthalpy from prev. low iter.
+
+    for (;;)
+    {
+        calcH = _calculateEnthalpy(tables, bracket, temperature);
+
+        // Assume convergence if the enthalpy difference is
+        //    sufficiently small or if the temperature
+        //    differential is also small (this alleviates
+        //    jump discontinuities in the curve fit equations).
+        if ((std::fabs(calcH - enthalpy) < tolerance) || (deltaT < Real(1E-2)))
+            break;
+
+        if ((calcH - enthalpy) > 0)
+        {
+            deltaT *= Real(0.5);
+
+            // Use a linear interpolation routine to speed convergence
+            temperature = (((temperature - T_under) / (calcH - h_under))
+                              * (enthalpy - h_under)) + T_under;
+        }
+        else
+        {
+            T_under = temperature;
+            h_under = calcH;
+
+            temperature += deltaT;
+        }
+    }
+
+    return calculateProperties(pressure, temperature);
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Retrieve the coefficient tables, converting them on first use.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The tables in precision Real.
+*/
+template <typename Real>
+const typename AirPrecision<Real>::Tables &
+AirPrecision<Real>::_getTables (void)
+{
+    struct Builder
+    {
+        Tables tables;
+
+        Builder()
+        {
+            _convertTable(AirCoefficients::hCoeffs[0], 5, true, true,
+                          AirCoefficients::hDecadeRows,
+                          AirCoefficients::hTmin, tables.h);
+            _convertTable(AirCoefficients::cpCoeffs[0], 5, true, true,
+                          AirCoefficients::cpDecadeRows,
+                          AirCoefficients::cpTmin, tables.cp);
+            _convertTable(AirCoefficients::kCoeffs[0], 5, true, true,
+                          AirCoefficients::kDecadeRows,
+                          AirCoefficients::kTmin, tables.k);
+            _convertTable(AirCoefficients::muCoeffs[0], 6, false, false,
+                          AirCoefficients::muDecadeRows,
+                          AirCoefficients::muTmin, tables.mu);
+            _convertTable(AirCoefficients::zCoeffs[0], 5, false, false,
+                          AirCoefficients::zDecadeRows,
+                          AirCoefficients::zTmin, tables.z);
+
+            // Air selects the rows of a contour with the decade of the
+            // contour pressure; record its choice so that the rows
+            // match exactly at every contour.
+            static const double contours[7] =
+                { 1E-4, 1E-3, 1E-2, 1E-1, 1E0, 1E1, 1E2 };
+
+            for (uint32 i = 0; i < 7; ++i)
+                tables.decade[i] = AirCoefficients::decade(contours[i]);
+        }
+    };
+
+    static const Builder builder;
+
+    return builder.tables;
+}
+
+/** Convert one coefficient table of Air.
+ *
+ *  @pre coeffs holds decadeRows[7] rows of terms coefficients.
+ *  @post table holds the re-expanded rows.
+ *  @param coeffs The coefficient table of Air.
+ *  @param terms The number of coefficients in each row (5 or 6).
+ *  @param descending Whether the rows of Air start with the highest
+ *         power (the ln(T / 10000) fits) or the lowest.
+ *  @param logarithmic Whether the independent variable is
+ *         ln(T / 10000) rather than T / 1000.
+ *  @param decadeRows The pressure groups of the table.
+ *  @param Tmin The temperature breakpoints of the table.
+ *  @param table The converted table.
+ *  @return none.
+*/
+template <typename Real>
+void AirPrecision<Real>::_convertTable (const double *coeffs, uint32 terms,
+                                        bool descending, bool logarithmic,
+                                        const uint32 decadeRows[8],
+                                        const double Tmin[], Table &table)
+{
+    table.decadeRows = decadeRows;
+
+    for (uint32 decade = 0; decade < 7; ++decade)
+    {
+        for (uint32 row = decadeRows[decade];
+             row < decadeRows[decade + 1]; ++row)
+        {
+            // The band in which the row is used (the fits are not
+            // used at or below 500 K).
+            long double tLower = (Tmin[row] > 500.0) ? Tmin[row] : 500.0L,
+                        tUpper = ((row + 1) < decadeRows[decade + 1]) ?
+                                 Tmin[row + 1] : 30000.0L,
+                        center;
+
+            if (logarithmic)
+                center = 0.5L * (logl(tLower / 10000.0L)
+                                 + logl(tUpper / 10000.0L));
+            else
+                center = 0.5L * (tLower + tUpper) / 1000.0L;
+
+            // Taylor shift: p(center + y) = sum_j shifted[j] * y^j.
+            long double ascending[6] = { 0.0L },
+                        shifted[6] = { 0.0L };
+
+            for (uint32 i = 0; i < terms; ++i)
+                ascending[i] = coeffs[row * terms +
+                                      (descending ? (terms - 1 - i) : i)];
+
+            for (uint32 j = 0; j < 6; ++j)
+            {
+                long double binomial = 1.0L,
+                            power = 1.0L;
+
+                for (uint32 i = j; i < 6; ++i)
+                {
+                    shifted[j] += ascending[i] * binomial * power;
+
+                    // C(i + 1, j) = C(i, j) * (i + 1) / (i + 1 - j)
+                    binomial = binomial * (i + 1) / (i + 1 - j);
+                    power *= center;
+                }
+            }
+
+            table.Tmin[row] = Real(Tmin[row]);
+            table.center[row] = Real(center);
+
+            for (uint32 j = 0; j < 6; ++j)
+                table.coeffs[row][j] = Real(shifted[j]);
+        }
+    }
+
+    return;
+}
+
+/** Determine the pressure contours that bound a pressure.
+ *
+ *  @pre 1E-4 <= pressure <= 100 atm.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param pressure The pressure of interest in atm.
+ *  @return The table groups and the interpolation fraction.
+*/
+template <typename Real>
+typename AirPrecision<Real>::Bracket
+AirPrecision<Real>::_getBracket (const Tables &tables, Real pressure)
+{
+    Bracket bracket;
+    uint32 group;
+    Real p1;
+
+    // The same groups as Air::_getPressureOM.
+         if ((pressure / Real(1E-4)) < Real(10.0)) { group = 0; p1 = 1E-4; }
+    else if ((pressure / Real(1E-3)) < Real(10.0)) { group = 1; p1 = 1E-3; }
+    else if ((pressure / Real(1E-2)) < Real(10.0)) { group = 2; p1 = 1E-2; }
+    else if ((pressure / Real(1E-1)) < Real(10.0)) { group = 3; p1 = 1E-1; }
+    else if ((pressure / Real(1E0))  < Real(10.0)) { group = 4; p1 = 1E0;  }
+    else                                           { group = 5; p1 = 1E1;  }
+
+    bracket.lower = tables.decade[group];
+    bracket.upper = tables.decade[group + 1];
+
+    // The contours are a decade apart, so the log-linear weight of
+    // the larger contour is log10(P / p1).
+    bracket.fraction = std::log10(pressure / p1);
+
+    return bracket;
+}
+
+/** Determine the index of a coefficient array based on the
+ *  table group and temperature (as Air::_getRow).
+ *
+ *  @pre decade < 7.
+ *  @post none.
+ *  @param table The coefficient table.
+ *  @param decade The pressure group of the table.
+ *  @param temperature The temperature of the state in K.
+ *  @return An index into the coefficient array.
+*/
+template <typename Real>
+uint32 AirPrecision<Real>::_getRow (const Table &table, uint32 decade,
+                                    Real temperature)
+{
+    uint32 row = table.decadeRows[decade];
+
+    // Advance to the last row of the group whose lower
+    // temperature limit does not exceed the temperature.
+    while (   ((row + 1) < table.decadeRows[decade + 1])
+           && (temperature >= table.Tmin[row + 1]))
+        ++row;
+
+    return row;
+}
+
+/** Evaluate a row of a coefficient table.
+ *
+ *  @pre row is a valid index into the table.
+ *  @post none.
+ *  @param table The coefficient table.
+ *  @param row The row of the table.
+ *  @param x The independent variable of the fit.
+ *  @return The value of the fit polynomial.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_evaluateRow (const Table &table, uint32 row,
+                                       Real x)
+{
+    const Real *c = table.coeffs[row];
+    Real y = x - table.center[row];
+
+    // The five-term rows carry a zero sixth coefficient.
+    return ((((c[5] * y + c[4]) * y + c[3]) * y + c[2]) * y + c[1]) * y
+           + c[0];
+}
+
+/** Evaluate a fit of the form ln(phi) = poly(ln(T / 10000)) at both
+ *  pressure contours and interpolate ln(phi) between them.
+ *
+ *  @pre T > 500 K.
+ *  @post none.
+ *  @param table The coefficient table.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The interpolated property in curve fit units.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_logFit (const Table &table, const Bracket &bracket,
+                                  Real temperature)
+{
+    Real x = std::log(temperature / Real(10000.0));
+
+    Real ln1 = _evaluateRow(table, _getRow(table, bracket.lower,
+                                           temperature), x),
+         ln2 = _evaluateRow(table, _getRow(table, bracket.upper,
+                                           temperature), x);
+
+    // Air interpolates log10(exp(ln)) linearly in log10(P); the
+    // logarithm of the exponential is the polynomial itself.
+    return std::exp(ln1 + ((ln2 - ln1) * bracket.fraction));
+}
+
+/** Evaluate a fit of the form phi = poly(T / 1000) at both pressure
+ *  contours and interpolate ln(phi) between them.
+ *
+ *  @pre T > 500 K.
+ *  @post none.
+ *  @param table The coefficient table.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The interpolated property in curve fit units.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_linearFit (const Table &table,
+                                     const Bracket &bracket,
+                                     Real temperature)
+{
+    Real x = temperature / Real(1000.0);
+
+    Real ln1 = std::log(_evaluateRow(table, _getRow(table, bracket.lower,
+                                                    temperature), x)),
+         ln2 = std::log(_evaluateRow(table, _getRow(table, bracket.upper,
+                                                    temperature), x));
+
+    return std::exp(ln1 + ((ln2 - ln1) * bracket.fraction));
+}
+
+/** Calculate the enthalpy using the input temperature.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The calculated enthalpy in units of kJ/kg.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_calculateEnthalpy (const Tables &tables,
+                                             const Bracket &bracket,
+                                             Real temperature)
+{
+    Real enth1;  // units: kcal/g
+
+    // The reference states that for temperatures below 500 K,
+    // simpler relations may be used to generate properties.
+    if (temperature <= Real(500.0))
+        enth1 = Real(0.24E-3) * temperature;
+    else
+        enth1 = _logFit(tables.h, bracket, temperature);
+
+    // Convert enthalpy from kcal/g -> kJ/kg
+    //    1000.0   = convert g -> kg
+    //    1000.0   = convert kcal -> cal
+    //    238.8459 = convert cal -> kJ
+    return enth1 * Real(1000.0 * 1000.0 / 238.8459);
+}
+
+/** Calculate the specific heat using the input temperature.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The calculated specific heat in units of kJ/kg-K.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_calculateSpecificHeat (const Tables &tables,
+                                                 const Bracket &bracket,
+                                                 Real temperature)
+{
+    Real cp1;  // units: cal/(g-K)
+
+    // Below 500 K the reference uses the constant cp = 0.24 cal/(g-K)
+    if (temperature <= Real(500.0))
+        cp1 = Real(0.24);
+    else
+        cp1 = _logFit(tables.cp, bracket, temperature);
+
+    // Convert specific heat from cal/g-K to kJ/kg-K
+    //    1000.0   = convert g -> kg
+    //    238.8459 = convert cal -> kJ
+    return cp1 * Real(1000.0 / 238.8459);
+}
+
+/** Calculate the thermal cond. using the input temperature.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The calculated thermal cond. in units of W/m-K.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_calculateThermalCond (const Tables &tables,
+                                                const Bracket &bracket,
+                                                Real temperature)
+{
+    Real k1;  // units: cal/(cm-s-K)
+
+    // Below 500 K the reference uses Sutherland's thermal
+    // conductivity law.
+    if (temperature <= Real(500.0))
+        k1 = Real(5.9776E-6) * (temperature * std::sqrt(temperature)
+                                / (temperature + Real(194.4)));
+    else
+        k1 = _logFit(tables.k, bracket, temperature);
+
+    // Convert thermal conductivity from cal/cm-s-K to W/m-K
+    //    100.0     = convert cm -> m
+    //    0.2388459 = convert cal -> J
+    return k1 * Real(100.0 / 0.2388459);
+}
+
+/** Calculate the compressibility using the input temperature.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The calculated compressibility factor.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_calculateCompFactor (const Tables &tables,
+                                               const Bracket &bracket,
+                                               Real temperature)
+{
+    // Below 500 K the reference uses a compressibility factor of unity
+    if (temperature <= Real(500.0))
+        return Real(1.0);
+
+    return _linearFit(tables.z, bracket, temperature);
+}
+
+/** Calculate the viscosity using the input temperature.
+ *
+ *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+ *  @post none.
+ *  @param tables The coefficient tables.
+ *  @param bracket The pressure contours of the state.
+ *  @param temperature The temperature of the state in K.
+ *  @return The calculated viscosity in units of kg/m-s.
+*/
+template <typename Real>
+Real AirPrecision<Real>::_calculateViscosity (const Tables &tables,
+                                              const Bracket &bracket,
+                                              Real temperature)
+{
+    Real mu1;  // units: poise (g/cm-s)
+
+    // Below 500 K the reference uses Sutherland's viscosity law.
+    if (temperature <= Real(500.0))
+        mu1 = Real(1.4584E-5) * (temperature * std::sqrt(temperature)
+                                 / (temperature + Real(110.33)));
+    else
+        mu1 = _linearFit(tables.mu, bracket, temperature);
+
+    // Convert viscosity from poise to kg/m-s
+    //    1000.0 = convert g -> kg
+    //    100.0  = convert cm -> m
+    return mu1 * Real(100.0 / 1000.0);
+}
+
+/** Calculate the derived thermodynamic and transport properties
+ *  from the stored primary (curve fit) properties with the pipeline
+ *  of Air (Air::calculateDerived) in precision Real.
+ *
+ *  @pre _pressure, _temperature, _enthalpy, _cp, _k, _mu, and
+ *       _comp have been calculated.
+ *  @post The remaining properties are calculated.
+ *  @return none.
+*/
+template <typename Real>
+void AirPrecision<Real>::_calculateDerivedProperties (void)
+{
+    Air::calculateDerived<Air::ALL_PROPERTIES>(*this);
+
+    return;
+}
+
+/******************************************************
+**                 Instantiations                    **
+******************************************************/
+
+template class AirPrecision<float>;
+template class AirPrecision<double>;
@@ -0,0 +1,579 @@
+/******************************************************************************
+||  airPrecision.h      (definition file)                                    ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    The equilibrium air curve fits evaluated in a chosen floating-point    ||
+||    precision.  The coefficient tables, the log-linear pressure            ||
+||    interpolation, and the curve fit helpers are templated on the value    ||
+||    type, and the derived properties come from the pipeline of Air         ||
+||    (Air::calculateDerived) in that type; the float instantiation stores   ||
+||    its coefficient tables as float and uses the float transcendentals.    ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airPrecision.cpp                                                       ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airPrecision.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_PRECISION_H
+#define _GH_DEF_AIR_PRECISION_H
+
+#include "air.h"
+
+/**
+ *  @class AirPrecision Calculates and stores the properties of
+ *         equilibrium air in the value type Real (float or double).
+ *
+ *  The curve fits, pressure groups, and temperature breakpoints are the
+ *  ones used by Air; only the arithmetic precision differs.  The
+ *  evaluation is rearranged for speed without changing the fits:
+ *  each row is re-expanded about the middle of its temperature band
+ *  and evaluated with Horner's rule, the pressure interpolation
+ *  fraction is computed once per state, and the exponential fits are
+ *  interpolated in log space (log(exp(x)) is not taken).  AirDouble
+ *  therefore agrees with Air to rounding, and AirFloat to about 1E-5
+ *  relative (see bench/airAccuracy).  Pressures are in MPa and the
+ *  units of the accessors follow Air.
+*/
+template <typename Real>
+class AirPrecision
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor.  */
+    AirPrecision();
+
+    /** Copy constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created from the copied values.
+     *  @param copyFrom An AirPrecision object whose values are copied.
+     *  @return none.
+    */
+    AirPrecision (const AirPrecision &copyFrom);
+
+    /** Default destructor.  */
+    ~AirPrecision();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    ////////////////////
+    //    Getters
+    ////////////////////
+
+    /** Retrieve the temperature of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _temperature [units: K].
+    */
+    Real getTemperature (void) const;
+
+    /** Retrieve the pressure of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _pressure [units: MPa].
+    */
+    Real getPressure (void) const;
+
+    /** Retrieve the enthalpy of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _enthalpy [units: kJ/kg].
+    */
+    Real getEnthalpy (void) const;
+
+    /** Retrieve the internal energy of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _intEnergy [units: kJ/kg].
+    */
+    Real getInternalEnergy (void) const;
+
+    /** Retrieve the density of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _density [units: kg/m^3].
+    */
+    Real getDensity (void) const;
+
+    /** Retrieve the isobaric specific heat of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _cp [units: kJ/kg-K].
+    */
+    Real getSpecificHeat (void) const;
+
+    /** Retrieve the ratio of specific heats of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _gamma [-dimensionless-].
+    */
+    Real getGamma (void) const;
+
+    /** Retrieve the thermal conductivity of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _k [units: W/m-K].
+    */
+    Real getThermalConductivity (void) const;
+
+    /** Retrieve the Prandtl number of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _pr [-dimensionless-].
+    */
+    Real getPrandtlNumber (void) const;
+
+    /** Retrieve the dynamic viscosity of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _mu [units: kg/m-s].
+    */
+    Real getDynamicViscosity (void) const;
+
+    /** Retrieve the kinematic viscosity of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _nu [units: m^2/s].
+    */
+    Real getKinematicViscosity (void) const;
+
+    /** Retrieve the compressibility factor of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _comp [-dimensionless-].
+    */
+    Real getCompressibilityFactor (void) const;
+
+    /** Retrieve the gas constant of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _gasConstant [units: kJ/kg-K].
+    */
+    Real getGasConstant (void) const;
+
+    /** Retrieve the molar mass of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _molarMass [units: kg/kgmol].
+    */
+    Real getMolarMass (void) const;
+
+    /** Retrieve the specific entropy of the state (note: in this
+     *  implementation, entropy is a derived quantity).
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _entropy [units: kJ/kg-K]
+    */
+    Real getEntropy (void) const;
+
+    /** Retrieve the calculated speed of sound of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _soundSpeed [units: m/s]
+    */
+    Real getSoundSpeed (void) const;
+
+    /** Retrieve the calculated index of refraction of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _refraction [-dimensionless-]
+    */
+    Real getRefractionIndex (void) const;
+
+    /** Retrieve the specific Gibbs free energy (enthalpy) of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _gibbsEnergy [units: kJ/kg]
+    */
+    Real getGibbsFreeEnergy (void) const;
+
+    /** Retrieve the specific Helmholtz free energy of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _helmholtzEn [units: kJ/kg]
+    */
+    Real getHelmholtzFreeEnergy (void) const;
+
+    /** Retrieve the chemical potential of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _chemPoten [units: kJ/kgmol].
+    */
+    Real getChemicalPotential (void) const;
+
+    /** Retrieve the Schmidt number of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _schmidt [-dimensionless-].
+    */
+    Real getSchmidtNumber (void) const;
+
+    /** Retrieve the Lewis number of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _lewis [-dimensionless-].
+    */
+    Real getLewisNumber (void) const;
+
+    /** Retrieve the thermal diffusivity of the state.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _thermalDiff [units: m^2/s].
+    */
+    Real getThermalDiffusivity (void) const;
+
+    /******************************************************
+    **                 Public Methods                    **
+    ******************************************************/
+
+    /** Reset the properties to zero.
+     *
+     *  @pre The object is instantiated.
+     *  @post Every property is zero.
+     *  @return none.
+    */
+    void reset (void);
+
+    /** Calculate the properties of air at the given pressure and
+     *  temperature.
+     *
+     *  @pre The object is instantiated.
+     *  @post The properties are calculated with values
+     *        stored in the appropriate variables.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @return true The calculation was performed successfully.
+     *  @return false The calculation could not be performed.
+    */
+    bool calculateProperties (Real pressure, Real temperature);
+
+    /** Calculate the properties of air at the given pressure and
+     *  enthalpy with the temperature search of Air.
+     *
+     *  @pre The object is instantiated and enthalpy does not exceed
+     *       AirBatch::MAX_PH_ENTHALPY.
+     *  @post The properties are calculated with values
+     *        stored in the appropriate variables.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param enthalpy The air enthalpy of the state (in kJ/kg).
+     *  @return true The calculation was performed successfully.
+     *  @return false The calculation could not be performed.
+    */
+    bool calculateProps_PH (Real pressure, Real enthalpy);
+
+  private:
+    // Air::calculateDerived fills the derived properties, so that both
+    // evaluators have the same outputs.
+    friend class Air;
+
+    /**
+     *  @struct Bracket The pressure contours that bound a state.
+    */
+    struct Bracket
+    {
+        uint32 lower,      // Table group of the smaller order-of-magnitude
+               upper;      // Table group of the larger order-of-magnitude
+        Real fraction;     // log10(P / p1) with P and p1 in atm
+    };
+
+    /**
+     *  @struct Table One coefficient table of Air in precision Real.
+     *
+     *  Each row is re-expanded about the middle of its temperature band
+     *  (in long double, when the table is built).  The fits of Air are
+     *  polynomials of up to fifth degree in ln(T / 10000) or T / 1000
+     *  whose terms cancel to a few digits; about the band center the
+     *  terms are small, so rounding to float loses little.
+    */
+    struct Table
+    {
+        const uint32 *decadeRows;  // The pressure groups of Air's table
+        Real Tmin[52];             // Lower temperature limit of each row
+        Real center[52];           // Expansion point of each row
+        Real coeffs[52][6];        // Ascending powers of (x - center)
+    };
+
+    /**
+     *  @struct Tables The coefficient tables of Air in precision Real.
+    */
+    struct Tables
+    {
+        Table h,     // ln(h)  = poly(ln(T / 10000))  [h: kcal/g]
+              cp,    // ln(cp) = poly(ln(T / 10000))  [cp: cal/g-K]
+              k,     // ln(k)  = poly(ln(T / 10000))  [k: cal/cm-s-K]
+              mu,    // mu = poly(T / 1000)           [mu: poise]
+              z;     // Z  = poly(T / 1000)
+
+        // The table group that Air uses for each pressure contour
+        // (order-of-magnitude 10^(i - 4) atm).
+        uint32 decade[7];
+    };
+
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+    Real _temperature,  // Air temperature [units: K]
+         _pressure,     // Air pressure [units: MPa]
+         _enthalpy,     // Air enthalpy [units: kJ/kg]
+         _intEnergy,    // Specific internal energy [units: kJ/kg]
+         _density,      // Air density [units: kg/m^3]
+         _cp,           // Specific heat [units: kJ/kg-K]
+         _gamma,        // Ratio of specific heats [-dimensionless-]
+         _k,            // Thermal conductivity [units: W/m-K]
+         _pr,           // Prandtl number [-dimensionless-]
+         _mu,           // Dynamic viscosity [kg/m-s]
+         _nu,           // Kinematic viscosity [m^2/s]
+         _comp,         // Compressibility factor [-dimensionless-]
+         _gasConstant,  // Specific gas constant [units: kJ/kg-K]
+         _molarMass,    // The substance molar mass [units: kg/kgmol]
+         _thermalDiff,  // Thermal diffusivity (alpha) [units: m^2/s]
+         _entropy,      // Air specific entropy [units: kJ/kg-K]
+         _soundSpeed,   // The speed of sound of air [units: m/s]
+         _refraction,   // The index of refraction of air [-dimensionless-]
+         _gibbsEnergy,  // The specific Gibbs free energy [units: kJ/kg]
+         _helmholtzEn,  // The specific Helmholtz free energy [units: kJ/kg]
+         _chemPoten,    // The chemical potential of air [units: kJ/kgmol]
+         _schmidt,      // The Schmidt number (Sc) [-dimensionless-]
+         _lewis;        // The Lewis number (Le) [-dimensionless-]
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Retrieve the coefficient tables, converting them on first use.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The tables in precision Real.
+    */
+    static const Tables & _getTables (void);
+
+    /** Convert one coefficient table of Air.
+     *
+     *  @pre coeffs holds decadeRows[7] rows of terms coefficients.
+     *  @post table holds the re-expanded rows.
+     *  @param coeffs The coefficient table of Air.
+     *  @param terms The number of coefficients in each row (5 or 6).
+     *  @param descending Whether the rows of Air start with the highest
+     *         power (the ln(T / 10000) fits) or the lowest.
+     *  @param logarithmic Whether the independent variable is
+     *         ln(T / 10000) rather than T / 1000.
+     *  @param decadeRows The pressure groups of the table.
+     *  @param Tmin The temperature breakpoints of the table.
+     *  @param table The converted table.
+     *  @return none.
+    */
+    static void _convertTable (const double *coeffs, uint32 terms,
+                               bool descending, bool logarithmic,
+                               const uint32 decadeRows[8],
+                               const double Tmin[], Table &table);
+
+    /** Determine the pressure contours that bound a pressure.
+     *
+     *  @pre 1E-4 <= pressure <= 100 atm.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param pressure The pressure of interest in atm.
+     *  @return The table groups and the interpolation fraction.
+    */
+    static Bracket _getBracket (const Tables &tables, Real pressure);
+
+    /** Determine the index of a coefficient array based on the
+     *  table group and temperature (as Air::_getRow).
+     *
+     *  @pre decade < 7.
+     *  @post none.
+     *  @param table The coefficient table.
+     *  @param decade The pressure group of the table.
+     *  @param temperature The temperature of the state in K.
+     *  @return An index into the coefficient array.
+    */
+    static uint32 _getRow (const Table &table, uint32 decade,
+                           Real temperature);
+
+    /** Evaluate a row of a coefficient table.
+     *
+     *  @pre row is a valid index into the table.
+     *  @post none.
+     *  @param table The coefficient table.
+     *  @param row The row of the table.
+     *  @param x The independent variable of the fit.
+     *  @return The value of the fit polynomial.
+    */
+    static Real _evaluateRow (const Table &table, uint32 row, Real x);
+
+    /** Evaluate a fit of the form ln(phi) = poly(ln(T / 10000)) at both
+     *  pressure contours and interpolate ln(phi) between them.
+     *
+     *  @pre T > 500 K.
+     *  @post none.
+     *  @param table The coefficient table.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The interpolated property in curve fit units.
+    */
+    static Real _logFit (const Table &table, const Bracket &bracket,
+                         Real temperature);
+
+    /** Evaluate a fit of the form phi = poly(T / 1000) at both pressure
+     *  contours and interpolate ln(phi) between them.
+     *
+     *  @pre T > 500 K.
+     *  @post none.
+     *  @param table The coefficient table.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The interpolated property in curve fit units.
+    */
+    static Real _linearFit (const Table &table, const Bracket &bracket,
+                            Real temperature);
+
+    /** Calculate the enthalpy using the input temperature.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The calculated enthalpy in units of kJ/kg.
+    */
+    static Real _calculateEnthalpy (const Tables &tables,
+                                    const Bracket &bracket,
+                                    Real temperature);
+
+    /** Calculate the specific heat using the input temperature.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The calculated specific heat in units of kJ/kg-K.
+    */
+    static Real _calculateSpecificHeat (const Tables &tables,
+                                        const Bracket &bracket,
+                                        Real temperature);
+
+    /** Calculate the thermal cond. using the input temperature.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The calculated thermal cond. in units of W/m-K.
+    */
+    static Real _calculateThermalCond (const Tables &tables,
+                                       const Bracket &bracket,
+                                       Real temperature);
+
+    /** Calculate the compressibility using the input temperature.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The calculated compressibility factor.
+    */
+    static Real _calculateCompFactor (const Tables &tables,
+                                      const Bracket &bracket,
+                                      Real temperature);
+
+    /** Calculate the viscosity using the input temperature.
+     *
+     *  @pre 1E-4 <= P <= 100 atm, 0 <= T <= 30000 K.
+     *  @post none.
+     *  @param tables The coefficient tables.
+     *  @param bracket The pressure contours of the state.
+     *  @param temperature The temperature of the state in K.
+     *  @return The calculated viscosity in units of kg/m-s.
+    */
+    static Real _calculateViscosity (const Tables &tables,
+                                     const Bracket &bracket,
+                                     Real temperature);
+
+    /** Calculate the derived thermodynamic and transport properties
+     *  from the stored primary (curve fit) properties with the pipeline
+     *  of Air (Air::calculateDerived) in precision Real.
+     *
+     *  @pre _pressure, _temperature, _enthalpy, _cp, _k, _mu, and
+     *       _comp have been calculated.
+     *  @post The remaining properties are calculated.
+     *  @return none.
+    */
+    void _calculateDerivedProperties (void);
+
+};  // end class AirPrecision
+
+// The instantiations provided by airPrecision.cpp.
+typedef AirPrecision<float> AirFloat;
+typedef AirPrecision<double> AirDouble;
+
+#endif
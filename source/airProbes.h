@@ -0,0 +1,162 @@
+/******************************************************************************
+||  airProbes.h      (definition file)                                       ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Static tracepoints (SystemTap SDT / USDT) at the entry and exit of     ||
+||    the Air ADT property calls, on each iteration of the P-H solver, and   ||
+||    on out of range rejections.  Unattached probes cost a test of their    ||
+||    semaphore; without <sys/sdt.h> the probe macros compile to nothing.    ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    sys/sdt.h (optional)                                                   ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airProbes.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_PROBES_H
+#define _GH_DEF_AIR_PROBES_H
+
+/*
+ *  Static tracepoints (SystemTap SDT / USDT) of the Air ADT.
+ *
+ *  The probes are compiled in when the library is built with
+ *  AIR_ENABLE_PROBES defined (CMake option AIR_ENABLE_PROBES, on by
+ *  default when <sys/sdt.h> is installed).  Every probe has an SDT
+ *  semaphore that the tracer raises while it is attached; an unattached
+ *  probe only tests its semaphore and skips the argument conversions
+ *  and the nop, so the probes can stay in production builds.  bpftrace,
+ *  perf, or SystemTap enable them in a running process, e.g.
+ *
+ *      bpftrace -e 'usdt:./solver:air:properties__entry { @t[tid] = nsecs; }
+ *                   usdt:./solver:air:properties__return /@t[tid]/
+ *                   { @ns = hist(nsecs - @t[tid]); delete(@t[tid]); }'
+ *
+ *  Floating point arguments are passed as integers in milli-units, as
+ *  bpftrace cannot read floating point registers:
+ *      pressure     [units: Pa]
+ *      temperature  [units: mK]
+ *      enthalpy     [units: J/kg]
+ *
+ *  Probes (provider "air"):
+ *      properties__entry    (pressure, temperature)
+ *      properties__return   (pressure, temperature, valid)
+ *      range__reject        (pressure, temperature)
+ *      props_ph__entry      (pressure, enthalpy)
+ *      props_ph__iteration  (iteration, temperature, calcH, deltaT)
+ *      props_ph__return     (pressure, enthalpy, temperature, valid)
+ *  The final calculateProperties call of calculateProps_PH fires the
+ *  properties probes as well.
+*/
+
+#ifdef AIR_ENABLE_PROBES
+
+// The probes reference their semaphores (defined in air.cpp).
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+// The semaphore of probe air:name, raised by the attached tracers.
+#define AIR_PROBE_SEMAPHORE(name) \
+    volatile unsigned short air_##name##_semaphore \
+        __attribute__((unused, section(".probes")))
+
+extern AIR_PROBE_SEMAPHORE(properties__entry);
+extern AIR_PROBE_SEMAPHORE(properties__return);
+extern AIR_PROBE_SEMAPHORE(range__reject);
+extern AIR_PROBE_SEMAPHORE(props_ph__entry);
+extern AIR_PROBE_SEMAPHORE(props_ph__iteration);
+extern AIR_PROBE_SEMAPHORE(props_ph__return);
+
+// Whether a tracer is attached to probe air:name.
+#define AIR_PROBE_ENABLED(name) \
+    __builtin_expect(air_##name##_semaphore != 0, 0)
+
+/** Convert a probe argument to integer milli-units.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param value The value in the units of the Air accessors.
+ *  @return The value times 1000, truncated.
+*/
+static inline long long airProbeMilli (double value)
+{  return (long long)(value * 1000.0);  }
+
+// Pressure arguments are converted from MPa to Pa.
+#define AIR_PROBE_PA(pressure)  ((long long)((pressure) * 1E6))
+
+#define AIR_PROBE_PROPERTIES_ENTRY(pressure, temperature) \
+    do { if (AIR_PROBE_ENABLED(properties__entry)) \
+        STAP_PROBE2(air, properties__entry, AIR_PROBE_PA(pressure), \
+                    airProbeMilli(temperature)); } while (0)
+#define AIR_PROBE_PROPERTIES_RETURN(pressure, temperature, valid) \
+    do { if (AIR_PROBE_ENABLED(properties__return)) \
+        STAP_PROBE3(air, properties__return, AIR_PROBE_PA(pressure), \
+                    airProbeMilli(temperature), int(valid)); } while (0)
+#define AIR_PROBE_RANGE_REJECT(pressure, temperature) \
+    do { if (AIR_PROBE_ENABLED(range__reject)) \
+        STAP_PROBE2(air, range__reject, AIR_PROBE_PA(pressure), \
+                    airProbeMilli(temperature)); } while (0)
+#define AIR_PROBE_PH_ENTRY(pressure, enthalpy) \
+    do { if (AIR_PROBE_ENABLED(props_ph__entry)) \
+        STAP_PROBE2(air, props_ph__entry, AIR_PROBE_PA(pressure), \
+                    airProbeMilli(enthalpy)); } while (0)
+#define AIR_PROBE_PH_ITERATION(iteration, temperature, calcH, deltaT) \
+    do { if (AIR_PROBE_ENABLED(props_ph__iteration)) \
+        STAP_PROBE4(air, props_ph__iteration, (unsigned int)(iteration), \
+                    airProbeMilli(temperature), airProbeMilli(calcH), \
+                    airProbeMilli(deltaT)); } while (0)
+#define AIR_PROBE_PH_RETURN(pressure, enthalpy, temperature, valid) \
+    do { if (AIR_PROBE_ENABLED(props_ph__return)) \
+        STAP_PROBE4(air, props_ph__return, AIR_PROBE_PA(pressure), \
+                    airProbeMilli(enthalpy), airProbeMilli(temperature), \
+                    int(valid)); } while (0)
+
+#else
+
+#define AIR_PROBE_PROPERTIES_ENTRY(pressure, temperature)          ((void)0)
+#define AIR_PROBE_PROPERTIES_RETURN(pressure, temperature, valid)  ((void)0)
+#define AIR_PROBE_RANGE_REJECT(pressure, temperature)              ((void)0)
+#define AIR_PROBE_PH_ENTRY(pressure, enthalpy)                     ((void)0)
+#define AIR_PROBE_PH_ITERATION(iteration, temperature, calcH, deltaT) \
+    ((void)0)
+#define AIR_PROBE_PH_RETURN(pressure, enthalpy, temperature, valid) \
+    ((void)0)
+
+#endif
+
+#endif
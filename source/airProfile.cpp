@@ -0,0 +1,347 @@
+/******************************************************************************
+||  airProfile.cpp      (implementation file)                                ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Sampling per-stage cycle profiler of the equilibrium air ADT.  One     ||
+||    call of calculateProperties in every sample period of each thread has  ||
+||    its stages (unit conversion, _getPressureOM, row lookup, polynomial    ||
+||    evaluation, transcendental calls, _interpolate, and the derived        ||
+||    block) timed with the time stamp counter (clock_gettime on other       ||
+||    targets).  The per-stage tick histograms and the slowest sampled       ||
+||    calls are summed on demand.  Without AIR_ENABLE_PROFILE the            ||
+||    instrumentation compiles to nothing.                                   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airProfile.h                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airProfile.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airProfile.h"
+
+#include <algorithm>
+
+/******************************************************
+**                 Thread Registry                   **
+******************************************************/
+
+// The blocks of every thread that has sampled a call.  Blocks are kept
+// after their thread exits so that its samples stay in the report.
+
+static std::mutex & registryLock (void)
+{
+    static std::mutex lock;
+    return lock;
+}
+
+static std::vector<AirProfile::Block *> & registry (void)
+{
+    static std::vector<AirProfile::Block *> blocks;
+    return blocks;
+}
+
+/** Find the histogram bin of a tick count.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param ticks The tick count.
+ *  @return The bin (floor(log2(ticks)), clamped to the histogram).
+*/
+static uint32 bin (uint64 ticks)
+{
+    uint32 b = 0;
+
+    while ((ticks >>= 1) && (b + 1 < AirProfile::HISTOGRAM_BINS))
+        ++b;
+
+    return b;
+}
+
+/** Increment a counter owned by the calling thread.
+ *
+ *  @pre The counter belongs to the calling thread's block.
+ *  @post The counter is incremented by value.
+ *  @param counter The counter of interest.
+ *  @param value The increment.
+ *  @return none.
+*/
+static void add (std::atomic<uint64> &counter, uint64 value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+}
+
+/** Order slow calls slowest first.  */
+static bool slower (const AirProfile::SlowCall &a,
+                    const AirProfile::SlowCall &b)
+{  return a.total > b.total;  }
+
+thread_local AirProfile::Thread AirProfile::_thread;
+std::atomic<uint32> AirProfile::_period(64);
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Determine whether the profiler was compiled in.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The library was built with AIR_ENABLE_PROFILE.
+*/
+bool AirProfile::enabled (void)
+{
+#ifdef AIR_ENABLE_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Retrieve the name of the tick source.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return "rdtsc" (reference cycles) or "clock_gettime" (ns).
+*/
+const char * AirProfile::clockName (void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "rdtsc";
+#else
+    return "clock_gettime";
+#endif
+}
+
+/** Retrieve the name of a stage (as used in reports).
+ *
+ *  @pre stage < NUM_STAGES.
+ *  @post none.
+ *  @return The name.
+*/
+const char * AirProfile::stageName (uint32 stage)
+{
+    static const char *names[NUM_STAGES] =
+    {
+        "conversion", "pressure_om", "row_lookup", "polynomial",
+        "transcendental", "interpolate", "derived"
+    };
+
+    return names[stage];
+}
+
+/** Retrieve the sampling period.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return One call in this many is timed.
+*/
+uint32 AirProfile::getSamplePeriod (void)
+{  return _period.load(std::memory_order_relaxed);  }
+
+/** Set the sampling period of every thread.
+ *
+ *  @pre none.
+ *  @post One call in period (at least 1) is timed.
+ *  @param period The sampling period.
+ *  @return none.
+*/
+void AirProfile::setSamplePeriod (uint32 period)
+{
+    _period.store(std::max(period, 1u), std::memory_order_relaxed);
+    return;
+}
+
+/** Sum the samples of every thread.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param report The destination.
+ *  @return none.
+*/
+void AirProfile::report (Report &report)
+{
+    report.calls = 0;
+    report.slow.clear();
+
+    for (uint32 s = 0; s <= NUM_STAGES; ++s)
+    {
+        report.ticks[s] = 0;
+
+        for (uint32 b = 0; b < HISTOGRAM_BINS; ++b)
+            report.histogram[s][b] = 0;
+    }
+
+    std::lock_guard<std::mutex> guard(registryLock());
+    std::vector<Block *> &blocks = registry();
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        Block &block = *blocks[i];
+
+        report.calls += block.calls.load(std::memory_order_relaxed);
+
+        for (uint32 s = 0; s <= NUM_STAGES; ++s)
+        {
+            report.ticks[s] += block.ticks[s].load(std::memory_order_relaxed);
+
+            for (uint32 b = 0; b < HISTOGRAM_BINS; ++b)
+                report.histogram[s][b] +=
+                    block.histogram[s][b].load(std::memory_order_relaxed);
+        }
+
+        std::lock_guard<std::mutex> slowGuard(block.slowLock);
+        report.slow.insert(report.slow.end(), block.slow,
+                           block.slow + block.numSlow);
+    }
+
+    std::sort(report.slow.begin(), report.slow.end(), slower);
+
+    if (report.slow.size() > SLOW_CALLS)
+        report.slow.resize(SLOW_CALLS);
+
+    return;
+}
+
+/** Discard the samples of every thread.  Samples recorded by other
+ *  threads while the reset runs may survive it.
+ *
+ *  @pre none.
+ *  @post Every histogram is empty.
+ *  @return none.
+*/
+void AirProfile::reset (void)
+{
+    std::lock_guard<std::mutex> guard(registryLock());
+    std::vector<Block *> &blocks = registry();
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        Block &block = *blocks[i];
+
+        block.calls.store(0, std::memory_order_relaxed);
+
+        for (uint32 s = 0; s <= NUM_STAGES; ++s)
+        {
+            block.ticks[s].store(0, std::memory_order_relaxed);
+
+            for (uint32 b = 0; b < HISTOGRAM_BINS; ++b)
+                block.histogram[s][b].store(0, std::memory_order_relaxed);
+        }
+
+        std::lock_guard<std::mutex> slowGuard(block.slowLock);
+        block.numSlow = 0;
+    }
+
+    return;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Store the current call of the calling thread in its block.
+ *
+ *  @pre _thread.active is true.
+ *  @post The call is added to the histograms (and possibly to the
+ *        slow calls); _thread.active is false.
+ *  @return none.
+*/
+void AirProfile::_commit (void)
+{
+    Thread &thread = _thread;
+    uint64 total = now() - thread.start;
+
+    thread.active = false;
+
+    if (!thread.block)
+    {
+        thread.block = new Block();
+        thread.block->numSlow = 0;
+
+        std::lock_guard<std::mutex> guard(registryLock());
+        registry().push_back(thread.block);
+    }
+
+    Block &block = *thread.block;
+
+    add(block.calls, 1);
+
+    for (uint32 s = 0; s < NUM_STAGES; ++s)
+    {
+        add(block.ticks[s], thread.stages[s]);
+        add(block.histogram[s][bin(thread.stages[s])], 1);
+    }
+
+    add(block.ticks[NUM_STAGES], total);
+    add(block.histogram[NUM_STAGES][bin(total)], 1);
+
+    // Keep the SLOW_CALLS slowest calls: fill the table, then replace
+    // its fastest entry whenever a slower call arrives.
+    std::lock_guard<std::mutex> guard(block.slowLock);
+
+    uint32 slot = block.numSlow;
+
+    if (slot == SLOW_CALLS)
+    {
+        slot = 0;
+
+        for (uint32 i = 1; i < SLOW_CALLS; ++i)
+        {
+            if (block.slow[i].total < block.slow[slot].total)
+                slot = i;
+        }
+
+        if (block.slow[slot].total >= total)
+            return;
+    }
+    else
+        ++block.numSlow;
+
+    SlowCall &call = block.slow[slot];
+
+    call.pressure = thread.pressure;
+    call.temperature = thread.temperature;
+    call.total = total;
+
+    for (uint32 s = 0; s < NUM_STAGES; ++s)
+        call.stages[s] = thread.stages[s];
+
+    return;
+}
@@ -0,0 +1,322 @@
+/******************************************************************************
+||  airProfile.h      (definition file)                                      ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Sampling per-stage cycle profiler of the equilibrium air ADT.  One     ||
+||    call of calculateProperties in every sample period of each thread has  ||
+||    its stages (unit conversion, _getPressureOM, row lookup, polynomial    ||
+||    evaluation, transcendental calls, _interpolate, and the derived        ||
+||    block) timed with the time stamp counter (clock_gettime on other       ||
+||    targets).  The per-stage tick histograms and the slowest sampled       ||
+||    calls are summed on demand.  Without AIR_ENABLE_PROFILE the            ||
+||    instrumentation compiles to nothing.                                   ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airProfile.cpp                                                         ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airProfile.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_PROFILE_H
+#define _GH_DEF_AIR_PROFILE_H
+
+#include "air.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+/**
+ *  @class AirProfile Sampling per-stage cycle profiler of
+ *         Air::calculateProperties.
+ *
+ *  The stages are only timed when the library is compiled with
+ *  AIR_ENABLE_PROFILE defined (CMake option AIR_ENABLE_PROFILE);
+ *  otherwise the AIR_PROFILE_* macros expand to nothing.  One call in
+ *  every getSamplePeriod() calls of each thread is timed: every stage
+ *  boundary reads the time stamp counter (clock_gettime on other
+ *  targets) and charges the ticks since the previous boundary to the
+ *  stage that just ended.
+*/
+class AirProfile
+{
+  public:
+    /** The stages of one state evaluation.  */
+    enum Stage
+    {
+        STAGE_CONVERSION,      // Unit conversions and the range check
+        STAGE_PRESSURE_OM,     // _getPressureOM
+        STAGE_ROW_LOOKUP,      // _get_*_row
+        STAGE_POLYNOMIAL,      // Curve fit polynomials (with their pow)
+        STAGE_TRANSCENDENTAL,  // log/exp of the fits, Sutherland's laws
+        STAGE_INTERPOLATE,     // _interpolate
+        STAGE_DERIVED,         // _calculateDerivedProperties
+        NUM_STAGES
+    };
+
+    // Bins of the tick histograms; bin b counts the samples with
+    // 2^b <= ticks < 2^(b+1) (bin 0 also counts zero ticks).
+    static const uint32 HISTOGRAM_BINS = 40;
+
+    // Number of the slowest sampled calls kept by each thread.
+    static const uint32 SLOW_CALLS = 16;
+
+    /**
+     *  @struct SlowCall One sampled call and its stage breakdown.
+    */
+    struct SlowCall
+    {
+        double pressure,            // [units: MPa]
+               temperature;         // [units: K]
+        uint64 total,               // Ticks of the whole call
+               stages[NUM_STAGES];  // Ticks of each stage
+    };
+
+    /**
+     *  @struct Block The samples of one thread.
+    */
+    struct Block
+    {
+        char _lead[64];
+        std::atomic<uint64> calls,                  // Sampled calls
+                            ticks[NUM_STAGES + 1],  // Stage sums, total
+                            histogram[NUM_STAGES + 1][HISTOGRAM_BINS];
+        std::mutex slowLock;                        // Guards slow
+        SlowCall slow[SLOW_CALLS];                  // Slowest calls
+        uint32 numSlow;                             // Used entries
+        char _trail[64];
+    };
+
+    /**
+     *  @struct Report The samples of all threads, summed.  Index
+     *          NUM_STAGES of ticks and histogram holds whole calls.
+    */
+    struct Report
+    {
+        uint64 calls,
+               ticks[NUM_STAGES + 1],
+               histogram[NUM_STAGES + 1][HISTOGRAM_BINS];
+        std::vector<SlowCall> slow;  // Slowest calls, slowest first
+    };
+
+    /** Determine whether the profiler was compiled in.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The library was built with AIR_ENABLE_PROFILE.
+    */
+    static bool enabled (void);
+
+    /** Retrieve the name of the tick source.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return "rdtsc" (reference cycles) or "clock_gettime" (ns).
+    */
+    static const char * clockName (void);
+
+    /** Retrieve the name of a stage (as used in reports).
+     *
+     *  @pre stage < NUM_STAGES.
+     *  @post none.
+     *  @return The name.
+    */
+    static const char * stageName (uint32 stage);
+
+    /** Retrieve the sampling period.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return One call in this many is timed.
+    */
+    static uint32 getSamplePeriod (void);
+
+    /** Set the sampling period of every thread.
+     *
+     *  @pre none.
+     *  @post One call in period (at least 1) is timed.
+     *  @param period The sampling period.
+     *  @return none.
+    */
+    static void setSamplePeriod (uint32 period);
+
+    /** Sum the samples of every thread.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param report The destination.
+     *  @return none.
+    */
+    static void report (Report &report);
+
+    /** Discard the samples of every thread.  Samples recorded by other
+     *  threads while the reset runs may survive it.
+     *
+     *  @pre none.
+     *  @post Every histogram is empty.
+     *  @return none.
+    */
+    static void reset (void);
+
+    /** Read the tick source.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The current tick count.
+    */
+    static uint64 now (void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return uint64(ts.tv_sec) * 1000000000ULL + uint64(ts.tv_nsec);
+#endif
+    }
+
+    /** Start a call; decides whether the call is sampled.
+     *
+     *  @pre none.
+     *  @post The call is timed if its turn in the period has come.
+     *  @param pressure The pressure of the call [units: MPa].
+     *  @param temperature The temperature of the call [units: K].
+     *  @return none.
+    */
+    static void begin (double pressure, double temperature)
+    {
+        Thread &thread = _thread;
+
+        if (thread.countdown > 0)
+        {
+            --thread.countdown;
+            return;
+        }
+
+        thread.countdown = _period.load(std::memory_order_relaxed) - 1;
+        thread.active = true;
+        thread.pressure = pressure;
+        thread.temperature = temperature;
+
+        for (uint32 i = 0; i < NUM_STAGES; ++i)
+            thread.stages[i] = 0;
+
+        thread.start = thread.last = now();
+    }
+
+    /** End a stage of a sampled call.
+     *
+     *  @pre none.
+     *  @post The ticks since the previous boundary are charged to stage.
+     *  @param stage The stage that has just ended.
+     *  @return none.
+    */
+    static void mark (Stage stage)
+    {
+        Thread &thread = _thread;
+
+        if (!thread.active)
+            return;
+
+        uint64 t = now();
+        thread.stages[stage] += t - thread.last;
+        thread.last = t;
+    }
+
+    /** End a call.
+     *
+     *  @pre none.
+     *  @post A sampled call is added to the thread's block.
+     *  @return none.
+    */
+    static void end (void)
+    {
+        if (_thread.active)
+            _commit();
+    }
+
+  private:
+    /**
+     *  @struct Thread The profiler state of one thread.
+    */
+    struct Thread
+    {
+        uint32 countdown;           // Calls until the next sample
+        bool active;                // Whether the current call is timed
+        double pressure,            // Inputs of the current call
+               temperature;
+        uint64 start,               // Ticks at begin()
+               last,                // Ticks at the last boundary
+               stages[NUM_STAGES];  // Ticks of each stage so far
+        Block *block;               // Samples (NULL until first commit)
+    };
+
+    static thread_local Thread _thread;
+    static std::atomic<uint32> _period;
+
+    /** Store the current call of the calling thread in its block.
+     *
+     *  @pre _thread.active is true.
+     *  @post The call is added to the histograms (and possibly to the
+     *        slow calls); _thread.active is false.
+     *  @return none.
+    */
+    static void _commit (void);
+};
+
+// The instrumentation points of the library.  Without AIR_ENABLE_PROFILE
+// they compile to nothing.
+#ifdef AIR_ENABLE_PROFILE
+#define AIR_PROFILE_BEGIN(p, t)     AirProfile::begin((p), (t))
+#define AIR_PROFILE_MARK(stage)     AirProfile::mark(AirProfile::stage)
+#define AIR_PROFILE_END()           AirProfile::end()
+#else
+#define AIR_PROFILE_BEGIN(p, t)     ((void)0)
+#define AIR_PROFILE_MARK(stage)     ((void)0)
+#define AIR_PROFILE_END()           ((void)0)
+#endif
+
+#endif
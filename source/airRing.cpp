@@ -0,0 +1,506 @@
+/******************************************************************************
+||  airRing.cpp      (implementation file)                                   ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A lock-free single-producer, single-consumer ring of fixed-size        ||
+||    records for streaming states into batch evaluation.  The ring lives    ||
+||    in POSIX shared memory (named, or anonymous and inherited across       ||
+||    fork), so a producer process and a consumer process exchange records   ||
+||    in place without copies or system calls.  A full ring refuses further  ||
+||    records, which gives the producer explicit backpressure.               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airRing.h                                                              ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airRing.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airRing.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AIR_RING_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/******************************************************
+**                  Ring Control                     **
+******************************************************/
+
+// Size of the control block; the records start right after it.
+static const size_t CONTROL_BYTES = 256;
+
+// Control block magic number ("AIRRING1").
+static const uint64 RING_MAGIC = 0x41495252494e4731ull;
+
+/**
+ *  @struct RingControl The control block at the start of a segment.
+ *          The counters only grow; a slot is counter & (capacity - 1).
+*/
+struct RingControl
+{
+    std::atomic<uint64> magic;            // RING_MAGIC once initialized
+    uint32 capacity,                      // Number of slots
+           recordBytes;                   // Size of a slot
+
+    alignas(64) std::atomic<uint64> head;     // Records published
+    alignas(64) std::atomic<uint64> tail;     // Records released
+    alignas(64) std::atomic<uint32> closed;   // End of stream
+};
+
+// The control block is shared between processes, which only works
+// with address free (lock-free) atomics.
+static_assert((ATOMIC_INT_LOCK_FREE == 2) && (ATOMIC_LLONG_LOCK_FREE == 2),
+              "AirRing needs lock-free atomics");
+static_assert(sizeof(RingControl) <= CONTROL_BYTES,
+              "RingControl does not fit its block");
+
+static inline RingControl * control (void *block)
+{  return static_cast<RingControl *>(block);  }
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (nothing attached).  */
+AirRing::AirRing()
+  : _control(NULL), _records(NULL), _bytes(0), _capacity(0),
+    _recordBytes(0), _head(0), _tailCache(0), _tail(0), _headCache(0)
+{}
+
+/** Default destructor (detaches).  */
+AirRing::~AirRing()
+{  detach();  }
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Retrieve the number of record slots.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The capacity (0 if nothing is attached).
+*/
+uint32 AirRing::getCapacity (void) const
+{  return _capacity;  }
+
+/** Retrieve the size of one record.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The record size [units: bytes].
+*/
+uint32 AirRing::getRecordBytes (void) const
+{  return _recordBytes;  }
+
+/** Retrieve the number of published, unreleased records.
+ *
+ *  @pre A ring is attached.
+ *  @post none.
+ *  @return The fill level (a snapshot).
+*/
+uint32 AirRing::getSize (void) const
+{
+    uint64 tail = control(_control)->tail.load(std::memory_order_acquire);
+    uint64 head = control(_control)->head.load(std::memory_order_acquire);
+
+    return uint32(head - tail);
+}
+
+/** Determine whether the producer has closed the ring and every
+ *  record has been released.
+ *
+ *  @pre A ring is attached.
+ *  @post none.
+ *  @return true The stream has ended.
+*/
+bool AirRing::isDrained (void) const
+{
+    // The flag is read first: a record committed before close() is
+    // then guaranteed to be seen by the size check.
+    return control(_control)->closed.load(std::memory_order_acquire) &&
+           (getSize() == 0);
+}
+
+/** Retrieve the reason of the last failure.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The message ("" if none).
+*/
+const char * AirRing::getError (void) const
+{  return _error.c_str();  }
+
+/******************************************************
+**                   Operations                      **
+******************************************************/
+
+/** Create a ring.
+ *
+ *  @pre capacity is a power of two; recordBytes is a multiple of 8.
+ *  @post The ring is empty and attached; a previous ring is
+ *        detached first.
+ *  @param name The shared memory name ("/..."), or NULL for an
+ *         anonymous ring that is shared with forked children.
+ *  @param capacity The number of record slots.
+ *  @param recordBytes The size of one record [units: bytes].
+ *  @return true The ring was created.
+ *  @return false It could not be created (see getError()); an
+ *          existing name is never replaced.
+*/
+bool AirRing::create (const char *name, uint32 capacity,
+                      uint32 recordBytes)
+{
+    detach();
+    _error.clear();
+
+    if ((capacity < 2) || (capacity & (capacity - 1)) ||
+        (recordBytes == 0) || (recordBytes % 8))
+    {
+        _error = "capacity must be a power of two and records a "
+                 "multiple of 8 bytes";
+        return false;
+    }
+
+#ifdef AIR_RING_POSIX
+    size_t bytes = CONTROL_BYTES + size_t(capacity) * recordBytes;
+    int fd = -1;
+
+    if (name)
+    {
+        fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+
+        if (fd < 0)
+        {
+            _error = std::string("cannot create ") + name + ": " +
+                     strerror(errno);
+            return false;
+        }
+
+        if (ftruncate(fd, off_t(bytes)) != 0)
+        {
+            _error = std::string("cannot size ") + name;
+            ::close(fd);
+            shm_unlink(name);
+            return false;
+        }
+    }
+
+    if (!_map(fd, bytes))
+    {
+        if (name)
+            shm_unlink(name);
+
+        return false;
+    }
+
+    // A new segment is zero filled: empty and open.
+    RingControl *ring = control(_control);
+
+    ring->capacity = capacity;
+    ring->recordBytes = recordBytes;
+    ring->magic.store(RING_MAGIC, std::memory_order_release);
+
+    _capacity = capacity;
+    _recordBytes = recordBytes;
+    return true;
+#else
+    (void)name;
+    _error = "shared memory rings need POSIX";
+    return false;
+#endif
+}
+
+/** Attach to a ring created by another process.
+ *
+ *  @pre none.
+ *  @post The ring is attached.
+ *  @param name The shared memory name.
+ *  @return true The ring was attached.
+ *  @return false There is no valid ring of that name.
+*/
+bool AirRing::open (const char *name)
+{
+    detach();
+    _error.clear();
+
+#ifdef AIR_RING_POSIX
+    int fd = shm_open(name, O_RDWR, 0);
+    struct stat status;
+
+    if (fd < 0 || fstat(fd, &status) != 0 ||
+        size_t(status.st_size) < CONTROL_BYTES)
+    {
+        _error = std::string("no ring named ") + name;
+
+        if (fd >= 0)
+            ::close(fd);
+
+        return false;
+    }
+
+    if (!_map(fd, size_t(status.st_size)))
+        return false;
+
+    RingControl *ring = control(_control);
+
+    if (ring->magic.load(std::memory_order_acquire) != RING_MAGIC ||
+        CONTROL_BYTES + size_t(ring->capacity) * ring->recordBytes > _bytes)
+    {
+        detach();
+        _error = std::string(name) + " is not an initialized ring";
+        return false;
+    }
+
+    _capacity = ring->capacity;
+    _recordBytes = ring->recordBytes;
+    _head = _headCache = ring->head.load(std::memory_order_acquire);
+    _tail = _tailCache = ring->tail.load(std::memory_order_acquire);
+    return true;
+#else
+    (void)name;
+    _error = "shared memory rings need POSIX";
+    return false;
+#endif
+}
+
+/** Unmap the ring.  The name is kept until remove().
+ *
+ *  @pre none.
+ *  @post Nothing is attached.
+ *  @return none.
+*/
+void AirRing::detach (void)
+{
+#ifdef AIR_RING_POSIX
+    if (_control)
+        munmap(_control, _bytes);
+#endif
+
+    _control = NULL;
+    _records = NULL;
+    _bytes = 0;
+    _capacity = 0;
+    _recordBytes = 0;
+    _head = _tailCache = _tail = _headCache = 0;
+    return;
+}
+
+/** Remove the name of a ring (mapped rings stay usable).
+ *
+ *  @pre none.
+ *  @post The name is free.
+ *  @param name The shared memory name.
+ *  @return true The name was removed.
+*/
+bool AirRing::remove (const char *name)
+{
+#ifdef AIR_RING_POSIX
+    return shm_unlink(name) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+////////////////////
+//    Producer
+////////////////////
+
+/** Find free slots.
+ *
+ *  @pre A ring is attached; only the producer calls this.
+ *  @post none.
+ *  @param records Receives the first free slot.
+ *  @param count The number of slots wanted.
+ *  @return The number of contiguous free slots (up to count; 0
+ *          when the ring is full).
+*/
+uint32 AirRing::reserve (void *&records, uint32 count)
+{
+    uint64 free = _capacity - (_head - _tailCache);
+
+    if (free < count)
+    {
+        _tailCache = control(_control)->tail.load(std::memory_order_acquire);
+        free = _capacity - (_head - _tailCache);
+    }
+
+    uint32 slot = uint32(_head & (_capacity - 1)),
+           n = count;
+
+    if (n > free)
+        n = uint32(free);
+
+    if (n > _capacity - slot)
+        n = _capacity - slot;
+
+    records = _records + size_t(slot) * _recordBytes;
+    return n;
+}
+
+/** Publish filled slots.
+ *
+ *  @pre count is at most the last reserve() result.
+ *  @post The records are visible to the consumer.
+ *  @param count The number of records.
+ *  @return none.
+*/
+void AirRing::commit (uint32 count)
+{
+    _head += count;
+    control(_control)->head.store(_head, std::memory_order_release);
+    return;
+}
+
+/** Mark the end of the stream.
+ *
+ *  @pre Only the producer calls this.
+ *  @post isDrained() becomes true once the records are released.
+ *  @return none.
+*/
+void AirRing::close (void)
+{
+    control(_control)->closed.store(1, std::memory_order_release);
+    return;
+}
+
+////////////////////
+//    Consumer
+////////////////////
+
+/** Find published records.
+ *
+ *  @pre A ring is attached; only the consumer calls this.
+ *  @post none.
+ *  @param records Receives the oldest record.
+ *  @param count The number of records wanted.
+ *  @return The number of contiguous records (up to count; 0 when
+ *          the ring is empty).
+*/
+uint32 AirRing::peek (const void *&records, uint32 count)
+{
+    uint64 ready = _headCache - _tail;
+
+    if (ready < count)
+    {
+        _headCache = control(_control)->head.load(std::memory_order_acquire);
+        ready = _headCache - _tail;
+    }
+
+    uint32 slot = uint32(_tail & (_capacity - 1)),
+           n = count;
+
+    if (n > ready)
+        n = uint32(ready);
+
+    if (n > _capacity - slot)
+        n = _capacity - slot;
+
+    records = _records + size_t(slot) * _recordBytes;
+    return n;
+}
+
+/** Free consumed records.
+ *
+ *  @pre count is at most the last peek() result.
+ *  @post The slots are available to the producer.
+ *  @param count The number of records.
+ *  @return none.
+*/
+void AirRing::release (uint32 count)
+{
+    _tail += count;
+    control(_control)->tail.store(_tail, std::memory_order_release);
+    return;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Map a segment (or an anonymous shared mapping when fd < 0) and
+ *  adopt its control block.
+ *
+ *  @pre fd is sized to bytes.
+ *  @post _control and _records point into the mapping; fd is closed.
+ *  @return true The segment was mapped.
+*/
+bool AirRing::_map (int fd, size_t bytes)
+{
+#ifdef AIR_RING_POSIX
+    int flags = MAP_SHARED;
+
+#ifdef MAP_POPULATE
+    // Fault the ring in now instead of on the first records.
+    flags |= MAP_POPULATE;
+#endif
+
+    if (fd < 0)
+        flags |= MAP_ANONYMOUS;
+
+    void *mapping = mmap(NULL, bytes, PROT_READ | PROT_WRITE, flags, fd, 0);
+
+    if (fd >= 0)
+        ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        _error = std::string("cannot map the ring: ") + strerror(errno);
+        return false;
+    }
+
+    _control = mapping;
+    _records = static_cast<unsigned char *>(mapping) + CONTROL_BYTES;
+    _bytes = bytes;
+    return true;
+#else
+    (void)fd;
+    (void)bytes;
+    return false;
+#endif
+}
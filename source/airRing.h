@@ -0,0 +1,269 @@
+/******************************************************************************
+||  airRing.h      (definition file)                                         ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A lock-free single-producer, single-consumer ring of fixed-size        ||
+||    records for streaming states into batch evaluation.  The ring lives    ||
+||    in POSIX shared memory (named, or anonymous and inherited across       ||
+||    fork), so a producer process and a consumer process exchange records   ||
+||    in place without copies or system calls.  A full ring refuses further  ||
+||    records, which gives the producer explicit backpressure.               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airRing.cpp                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airRing.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_RING_H
+#define _GH_DEF_AIR_RING_H
+
+#include "air.h"
+
+#include <string>
+
+/**
+ *  @class AirRing A bounded single-producer, single-consumer queue of
+ *         fixed-size records in shared memory.
+ *
+ *  One process (or thread) produces: reserve() returns a contiguous run
+ *  of free slots that are filled in place and published with commit().
+ *  One process (or thread) consumes: peek() returns a contiguous run of
+ *  published records that are read in place and freed with release().
+ *  Neither side blocks; reserve() returns 0 when the ring is full and
+ *  peek() returns 0 when it is empty, and the caller decides whether to
+ *  wait or drop.  close() marks the end of the stream.
+ *
+ *  The head (written by the producer) and tail (written by the
+ *  consumer) are 64-bit counters on separate cache lines; each side
+ *  keeps a private copy of the other's counter and only reloads it when
+ *  the copy says the ring is full (or empty).
+ *
+ *  Segment layout:
+ *      control     256 bytes: magic, capacity, record size, and the
+ *                  head, tail, and closed flag on their own lines
+ *      records     capacity * recordBytes
+*/
+class AirRing
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (nothing attached).  */
+    AirRing();
+
+    /** Default destructor (detaches).  */
+    ~AirRing();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Retrieve the number of record slots.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The capacity (0 if nothing is attached).
+    */
+    uint32 getCapacity (void) const;
+
+    /** Retrieve the size of one record.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The record size [units: bytes].
+    */
+    uint32 getRecordBytes (void) const;
+
+    /** Retrieve the number of published, unreleased records.
+     *
+     *  @pre A ring is attached.
+     *  @post none.
+     *  @return The fill level (a snapshot).
+    */
+    uint32 getSize (void) const;
+
+    /** Determine whether the producer has closed the ring and every
+     *  record has been released.
+     *
+     *  @pre A ring is attached.
+     *  @post none.
+     *  @return true The stream has ended.
+    */
+    bool isDrained (void) const;
+
+    /** Retrieve the reason of the last failure.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The message ("" if none).
+    */
+    const char * getError (void) const;
+
+    /******************************************************
+    **                   Operations                      **
+    ******************************************************/
+
+    /** Create a ring.
+     *
+     *  @pre capacity is a power of two; recordBytes is a multiple of 8.
+     *  @post The ring is empty and attached; a previous ring is
+     *        detached first.
+     *  @param name The shared memory name ("/..."), or NULL for an
+     *         anonymous ring that is shared with forked children.
+     *  @param capacity The number of record slots.
+     *  @param recordBytes The size of one record [units: bytes].
+     *  @return true The ring was created.
+     *  @return false It could not be created (see getError()); an
+     *          existing name is never replaced.
+    */
+    bool create (const char *name, uint32 capacity, uint32 recordBytes);
+
+    /** Attach to a ring created by another process.
+     *
+     *  @pre none.
+     *  @post The ring is attached.
+     *  @param name The shared memory name.
+     *  @return true The ring was attached.
+     *  @return false There is no valid ring of that name.
+    */
+    bool open (const char *name);
+
+    /** Unmap the ring.  The name is kept until remove().
+     *
+     *  @pre none.
+     *  @post Nothing is attached.
+     *  @return none.
+    */
+    void detach (void);
+
+    /** Remove the name of a ring (mapped rings stay usable).
+     *
+     *  @pre none.
+     *  @post The name is free.
+     *  @param name The shared memory name.
+     *  @return true The name was removed.
+    */
+    static bool remove (const char *name);
+
+    ////////////////////
+    //    Producer
+    ////////////////////
+
+    /** Find free slots.
+     *
+     *  @pre A ring is attached; only the producer calls this.
+     *  @post none.
+     *  @param records Receives the first free slot.
+     *  @param count The number of slots wanted.
+     *  @return The number of contiguous free slots (up to count; 0
+     *          when the ring is full).
+    */
+    uint32 reserve (void *&records, uint32 count);
+
+    /** Publish filled slots.
+     *
+     *  @pre count is at most the last reserve() result.
+     *  @post The records are visible to the consumer.
+     *  @param count The number of records.
+     *  @return none.
+    */
+    void commit (uint32 count);
+
+    /** Mark the end of the stream.
+     *
+     *  @pre Only the producer calls this.
+     *  @post isDrained() becomes true once the records are released.
+     *  @return none.
+    */
+    void close (void);
+
+    ////////////////////
+    //    Consumer
+    ////////////////////
+
+    /** Find published records.
+     *
+     *  @pre A ring is attached; only the consumer calls this.
+     *  @post none.
+     *  @param records Receives the oldest record.
+     *  @param count The number of records wanted.
+     *  @return The number of contiguous records (up to count; 0 when
+     *          the ring is empty).
+    */
+    uint32 peek (const void *&records, uint32 count);
+
+    /** Free consumed records.
+     *
+     *  @pre count is at most the last peek() result.
+     *  @post The slots are available to the producer.
+     *  @param count The number of records.
+     *  @return none.
+    */
+    void release (uint32 count);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    void *_control;              // Mapped control block (or NULL)
+    unsigned char *_records;     // The first record slot
+    size_t _bytes;               // Size of the mapping
+    uint32 _capacity,            // Number of slots
+           _recordBytes;         // Size of a slot
+    uint64 _head,                // Producer: the next slot to fill
+           _tailCache,           // Producer: last tail seen
+           _tail,                // Consumer: the next record to read
+           _headCache;           // Consumer: last head seen
+    std::string _error;          // Last failure
+
+    /** Map a segment and adopt its control block.  */
+    bool _map (int fd, size_t bytes);
+
+    // Not copyable.
+    AirRing (const AirRing &);
+    AirRing & operator= (const AirRing &);
+
+};  // end class AirRing
+
+#endif
@@ -0,0 +1,304 @@
+/******************************************************************************
+||  airStats.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Opt-in hot path statistics of the equilibrium air ADT: calls per API,  ||
+||    coefficient rows hit per table, pressure groups, the                   ||
+||    calculateProps_PH iteration histogram, out of range rejects, and the   ||
+||    fallback events of AirStream and AirTaylorCache.  Each thread counts   ||
+||    into its own cache-line padded block, and the blocks are summed on     ||
+||    demand.  Without AIR_ENABLE_STATS the instrumentation compiles to      ||
+||    nothing.                                                               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airStats.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airStats.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airStats.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/******************************************************
+**                 Thread Registry                   **
+******************************************************/
+
+// The registry is reached through functions so that it is constructed
+// before the first block is attached, whatever the static
+// initialization order of the program is.
+
+static std::mutex & registryLock (void)
+{
+    static std::mutex lock;
+    return lock;
+}
+
+// The blocks of the live threads.
+static std::vector<AirStats::Block *> & registry (void)
+{
+    static std::vector<AirStats::Block *> blocks;
+    return blocks;
+}
+
+// The summed blocks of the threads that have exited.
+static AirStats::Block & retired (void)
+{
+    static AirStats::Block block;
+    return block;
+}
+
+static uint32 retiredThreads = 0;
+
+// The counter arrays of a block (and of a snapshot) are contiguous, so
+// they can be walked as one array of NUM_VALUES entries.
+static_assert(sizeof(AirStats::Block)
+                  == 128 + AirStats::NUM_VALUES * sizeof(std::atomic<uint64>),
+              "AirStats::Block counters are not contiguous");
+static_assert(offsetof(AirStatsSnapshot, threads)
+                  == AirStats::NUM_VALUES * sizeof(uint64),
+              "AirStatsSnapshot counters are not contiguous");
+
+/** Retrieve the counters of a block as one array.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param block The block of interest.
+ *  @return The first of NUM_VALUES counters.
+*/
+static std::atomic<uint64> * values (AirStats::Block &block)
+{  return &block.counters[0];  }
+
+/**
+ *  @class BlockOwner Folds the block of a thread into the retired
+ *         totals when the thread exits.
+*/
+class BlockOwner
+{
+  public:
+    AirStats::Block *block;
+
+    BlockOwner() : block(NULL)  {  }
+
+    ~BlockOwner()
+    {
+        if (!block)
+            return;
+
+        std::lock_guard<std::mutex> guard(registryLock());
+        std::vector<AirStats::Block *> &blocks = registry();
+
+        std::atomic<uint64> *from = values(*block),
+                            *to = values(retired());
+
+        for (uint32 i = 0; i < AirStats::NUM_VALUES; ++i)
+            to[i].store(to[i].load(std::memory_order_relaxed)
+                            + from[i].load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            if (blocks[i] == block)
+            {
+                blocks.erase(blocks.begin() + i);
+                break;
+            }
+        }
+
+        ++retiredThreads;
+        delete block;
+    }
+};
+
+static thread_local BlockOwner owner;
+
+thread_local AirStats::Block *AirStats::_block = NULL;
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Determine whether the statistics were compiled in.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The library was built with AIR_ENABLE_STATS.
+*/
+bool AirStats::enabled (void)
+{
+#ifdef AIR_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Sum the statistics of every thread.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param snapshot The destination.
+ *  @return none.
+*/
+void AirStats::snapshot (AirStatsSnapshot &snapshot)
+{
+    uint64 *to = &snapshot.counters[0];
+
+    std::lock_guard<std::mutex> guard(registryLock());
+    std::vector<Block *> &blocks = registry();
+
+    std::atomic<uint64> *from = values(retired());
+
+    for (uint32 i = 0; i < NUM_VALUES; ++i)
+        to[i] = from[i].load(std::memory_order_relaxed);
+
+    for (size_t b = 0; b < blocks.size(); ++b)
+    {
+        from = values(*blocks[b]);
+
+        for (uint32 i = 0; i < NUM_VALUES; ++i)
+            to[i] += from[i].load(std::memory_order_relaxed);
+    }
+
+    snapshot.threads = retiredThreads + uint32(blocks.size());
+
+    return;
+}
+
+/** Zero the statistics of every thread.  Increments made by other
+ *  threads while the reset runs may be lost.
+ *
+ *  @pre none.
+ *  @post Every counter is zero.
+ *  @return none.
+*/
+void AirStats::reset (void)
+{
+    std::lock_guard<std::mutex> guard(registryLock());
+    std::vector<Block *> &blocks = registry();
+
+    _zero(retired());
+
+    for (size_t b = 0; b < blocks.size(); ++b)
+        _zero(*blocks[b]);
+
+    retiredThreads = 0;
+
+    return;
+}
+
+/** Retrieve the name of a counter (as used in reports).
+ *
+ *  @pre counter < NUM_COUNTERS.
+ *  @post none.
+ *  @return The name.
+*/
+const char * AirStats::counterName (uint32 counter)
+{
+    static const char *names[NUM_COUNTERS] =
+    {
+        "calls_properties", "calls_props_ph", "calls_stream",
+        "calls_taylor_cache", "reject_range", "low_temperature",
+        "stream_fallback", "stream_refresh", "taylor_refresh",
+        "taylor_bypass"
+    };
+
+    return names[counter];
+}
+
+/** Retrieve the name of a coefficient table (as used in reports).
+ *
+ *  @pre table < NUM_TABLES.
+ *  @post none.
+ *  @return The name.
+*/
+const char * AirStats::tableName (uint32 table)
+{
+    static const char *names[NUM_TABLES] =
+    {  "enthalpy", "specific_heat", "thermal_cond", "viscosity",
+       "comp_factor"  };
+
+    return names[table];
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Allocate and register the block of the calling thread.
+ *
+ *  @pre _block is NULL.
+ *  @post _block is set; the block is folded into the retired
+ *        totals when the thread exits.
+ *  @return The new block.
+*/
+AirStats::Block & AirStats::_attach (void)
+{
+    Block *block = new Block();
+    _zero(*block);
+
+    {
+        std::lock_guard<std::mutex> guard(registryLock());
+        registry().push_back(block);
+    }
+
+    owner.block = block;
+    _block = block;
+
+    return *block;
+}
+
+/** Zero every counter of a block.
+ *
+ *  @pre none.
+ *  @post The counters of block are zero.
+ *  @param block The block of interest.
+ *  @return none.
+*/
+void AirStats::_zero (Block &block)
+{
+    std::atomic<uint64> *counters = values(block);
+
+    for (uint32 i = 0; i < NUM_VALUES; ++i)
+        counters[i].store(0, std::memory_order_relaxed);
+
+    return;
+}
@@ -0,0 +1,286 @@
+/******************************************************************************
+||  airStats.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Opt-in hot path statistics of the equilibrium air ADT: calls per API,  ||
+||    coefficient rows hit per table, pressure groups, the                   ||
+||    calculateProps_PH iteration histogram, out of range rejects, and the   ||
+||    fallback events of AirStream and AirTaylorCache.  Each thread counts   ||
+||    into its own cache-line padded block, and the blocks are summed on     ||
+||    demand.  Without AIR_ENABLE_STATS the instrumentation compiles to      ||
+||    nothing.                                                               ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airStats.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airStats.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_STATS_H
+#define _GH_DEF_AIR_STATS_H
+
+#include "air.h"
+
+#include <atomic>
+
+struct AirStatsSnapshot;
+
+/**
+ *  @class AirStats Opt-in hot path statistics of the Air ADT.
+ *
+ *  The counters are only updated when the library is compiled with
+ *  AIR_ENABLE_STATS defined (CMake option AIR_ENABLE_STATS); otherwise
+ *  the AIR_STATS_* macros expand to nothing and a snapshot is all zero.
+ *  Each thread increments its own cache-line padded block without
+ *  atomic read-modify-write operations; snapshot() sums the blocks of
+ *  the live threads and of the threads that have already exited.
+*/
+class AirStats
+{
+  public:
+    /** Event counters.  */
+    enum Counter
+    {
+        CALLS_PROPERTIES,   // Air::calculateProperties, including the
+                            //    calls made by the other paths
+        CALLS_PROPS_PH,     // Air::calculateProps_PH
+        CALLS_STREAM,       // AirStream::calculateProperties
+        CALLS_TAYLOR,       // AirTaylorCache::calculateProperties
+        REJECT_RANGE,       // Out of range calculateProperties calls
+        LOW_TEMPERATURE,    // T <= 500 K shortcut of calculateProperties
+        STREAM_FALLBACK,    // AirStream samples delegated to Air
+        STREAM_REFRESH,     // AirStream coefficient row reloads
+        TAYLOR_REFRESH,     // AirTaylorCache anchor derivative evaluations
+        TAYLOR_BYPASS,      // AirTaylorCache exact evaluations by Air
+        NUM_COUNTERS
+    };
+
+    /** Coefficient tables.  */
+    enum Table
+    {
+        TABLE_H,
+        TABLE_CP,
+        TABLE_K,
+        TABLE_MU,
+        TABLE_Z,
+        NUM_TABLES
+    };
+
+    // Rows of the largest coefficient table (_cp_coeffs).
+    static const uint32 MAX_ROWS = 52;
+
+    // Pressure groups of calculateProperties: 10^-4 .. 10^1 atm, and
+    // the 100 atm end point.
+    static const uint32 NUM_DECADES = 7;
+
+    // Bins of the P-H iteration histogram; bin i counts the solves that
+    // took i iterations, the last bin those that took PH_BINS - 1 or more.
+    static const uint32 PH_BINS = 64;
+
+    // Number of counters of a block (all of the arrays below).
+    static const uint32 NUM_VALUES = NUM_COUNTERS + NUM_TABLES * MAX_ROWS
+                                   + NUM_DECADES + PH_BINS;
+
+    /**
+     *  @struct Block The counters of one thread, padded so that no other
+     *          data shares their cache lines.
+    */
+    struct Block
+    {
+        char _lead[64];
+        std::atomic<uint64> counters[NUM_COUNTERS],
+                            rows[NUM_TABLES][MAX_ROWS],
+                            decades[NUM_DECADES],
+                            phIterations[PH_BINS];
+        char _trail[64];
+    };
+
+    /** Determine whether the statistics were compiled in.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The library was built with AIR_ENABLE_STATS.
+    */
+    static bool enabled (void);
+
+    /** Sum the statistics of every thread.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param snapshot The destination.
+     *  @return none.
+    */
+    static void snapshot (AirStatsSnapshot &snapshot);
+
+    /** Zero the statistics of every thread.  Increments made by other
+     *  threads while the reset runs may be lost.
+     *
+     *  @pre none.
+     *  @post Every counter is zero.
+     *  @return none.
+    */
+    static void reset (void);
+
+    /** Retrieve the name of a counter or table (as used in reports).
+     *
+     *  @pre counter < NUM_COUNTERS, table < NUM_TABLES.
+     *  @post none.
+     *  @return The name.
+    */
+    static const char * counterName (uint32 counter);
+    static const char * tableName (uint32 table);
+
+    /** Increment an event counter of the calling thread.
+     *
+     *  @pre counter < NUM_COUNTERS.
+     *  @post The counter is incremented.
+     *  @param counter The counter of interest.
+     *  @return none.
+    */
+    static void count (Counter counter)
+    {  _bump(_local().counters[counter]);  }
+
+    /** Record a coefficient row lookup of the calling thread.
+     *
+     *  @pre table < NUM_TABLES, row < MAX_ROWS.
+     *  @post The row counter is incremented.
+     *  @param table The coefficient table.
+     *  @param row The index into the table.
+     *  @return none.
+    */
+    static void row (Table table, uint32 row)
+    {  _bump(_local().rows[table][row]);  }
+
+    /** Record the pressure group of a calculateProperties call.
+     *
+     *  @pre decade < NUM_DECADES.
+     *  @post The decade counter is incremented.
+     *  @param decade The group index (as returned by Air::_getDecade).
+     *  @return none.
+    */
+    static void decade (uint32 decade)
+    {  _bump(_local().decades[decade]);  }
+
+    /** Record the iteration count of a calculateProps_PH solve.
+     *
+     *  @pre none.
+     *  @post The histogram bin is incremented.
+     *  @param iterations The number of enthalpy evaluations.
+     *  @return none.
+    */
+    static void phIterations (uint32 iterations)
+    {
+        _bump(_local().phIterations[(iterations < PH_BINS) ? iterations
+                                                            : PH_BINS - 1]);
+    }
+
+  private:
+    // The block of the calling thread (NULL until first use).
+    static thread_local Block *_block;
+
+    /** Retrieve the block of the calling thread.
+     *
+     *  @pre none.
+     *  @post A block is attached to the thread on first use.
+     *  @return The block of the calling thread.
+    */
+    static Block & _local (void)
+    {  return _block ? *_block : _attach();  }
+
+    /** Allocate and register the block of the calling thread.
+     *
+     *  @pre _block is NULL.
+     *  @post _block is set; the block is folded into the retired
+     *        totals when the thread exits.
+     *  @return The new block.
+    */
+    static Block & _attach (void);
+
+    /** Zero every counter of a block.
+     *
+     *  @pre none.
+     *  @post The counters of block are zero.
+     *  @param block The block of interest.
+     *  @return none.
+    */
+    static void _zero (Block &block);
+
+    /** Increment a counter owned by the calling thread.  Only the owner
+     *  writes, so a relaxed load and store replace the locked add.
+     *
+     *  @pre The counter belongs to the calling thread's block.
+     *  @post The counter is incremented.
+     *  @param counter The counter of interest.
+     *  @return none.
+    */
+    static void _bump (std::atomic<uint64> &counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+};
+
+/**
+ *  @struct AirStatsSnapshot The statistics of all threads, summed.
+*/
+struct AirStatsSnapshot
+{
+    uint64 counters[AirStats::NUM_COUNTERS],
+           rows[AirStats::NUM_TABLES][AirStats::MAX_ROWS],
+           decades[AirStats::NUM_DECADES],
+           phIterations[AirStats::PH_BINS];
+    uint32 threads;  // Threads that have recorded statistics
+};
+
+// The instrumentation points of the library.  Without AIR_ENABLE_STATS
+// they compile to nothing.
+#ifdef AIR_ENABLE_STATS
+#define AIR_STATS_COUNT(counter)    AirStats::count(AirStats::counter)
+#define AIR_STATS_ROW(table, index) AirStats::row(AirStats::table, (index))
+#define AIR_STATS_DECADE(group)     AirStats::decade(group)
+#define AIR_STATS_PH(iterations)    AirStats::phIterations(iterations)
+#else
+#define AIR_STATS_COUNT(counter)    ((void)0)
+#define AIR_STATS_ROW(table, index) ((void)0)
+#define AIR_STATS_DECADE(group)     ((void)0)
+#define AIR_STATS_PH(iterations)    ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,168 @@
+/******************************************************************************
+||  airStream.cpp      (implementation file)                                 ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A stateful evaluator of the equilibrium air ADT for coherent           ||
+||    sequences of states such as time-marching trajectories and sensor      ||
+||    streams.  The pressure contours and the coefficient rows of every      ||
+||    curve fit of the previous sample are cached (Air::Rows), so a sample   ||
+||    that uses the same rows skips their lookup.  The results are           ||
+||    identical to Air::calculateProperties.                                 ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airStream.h                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airStream.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airStream.h"
+#include "airStats.h"
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor.  */
+AirStream::AirStream()
+  : _valid(false), _hits(0), _refreshes(0), _rows()
+{}
+
+/** Copy constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created from the copied values.
+ *  @param copyFrom An AirStream object whose values are to be copied.
+ *  @return none.
+*/
+AirStream::AirStream (const AirStream &copyFrom)
+  : _valid(copyFrom._valid), _hits(copyFrom._hits),
+    _refreshes(copyFrom._refreshes), _rows(copyFrom._rows)
+{}
+
+/** Default destructor.  */
+AirStream::~AirStream() {}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+////////////////////
+//    Getters
+////////////////////
+
+/** Retrieve the number of samples evaluated with the cached
+ *  rows.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _hits.
+*/
+uint64 AirStream::getHits (void) const
+{  return _hits;  }
+
+/** Retrieve the number of samples which required new rows.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _refreshes.
+*/
+uint64 AirStream::getRefreshes (void) const
+{  return _refreshes;  }
+
+////////////////////
+//    Setters
+////////////////////
+
+/** Discard the cached rows and zero the counters.
+ *
+ *  @pre The object is instantiated.
+ *  @post The next sample looks up its rows.
+ *  @return none.
+*/
+void AirStream::reset (void)
+{
+    _valid = false;
+
+    _hits = 0;
+    _refreshes = 0;
+
+    return;
+}
+
+/** Calculate the properties of air at the given pressure and
+ *  temperature using the cached rows when they still apply.
+ *
+ *  @pre The object is instantiated.
+ *  @post The properties are stored in state.  The rows are
+ *        looked up again when the sample leaves their box.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param state The Air object which receives the properties.
+ *  @return true The calculation was performed successfully.
+ *  @return false The calculation could not be performed.
+*/
+bool AirStream::calculateProperties (double pressure, double temperature,
+                                     Air &state)
+{
+    AIR_STATS_COUNT(CALLS_STREAM);
+
+    if (_valid && state.hasRows(pressure, temperature, _rows))
+        ++_hits;
+
+    else if (state.getRows(pressure, temperature, _rows))
+    {
+        _valid = true;
+        ++_refreshes;
+
+        AIR_STATS_COUNT(STREAM_REFRESH);
+    }
+
+    // Out of range samples are rejected by Air, and below 500 K the
+    // simple relations do not use the coefficient tables at all.
+    else
+    {
+        AIR_STATS_COUNT(STREAM_FALLBACK);
+        return state.calculateProperties(pressure, temperature);
+    }
+
+    state.calculateProperties(pressure, temperature, _rows);
+
+    return true;
+}
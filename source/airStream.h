@@ -0,0 +1,155 @@
+/******************************************************************************
+||  airStream.h      (definition file)                                       ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A stateful evaluator of the equilibrium air ADT for coherent           ||
+||    sequences of states such as time-marching trajectories and sensor      ||
+||    streams.  The pressure contours and the coefficient rows of every      ||
+||    curve fit of the previous sample are cached (Air::Rows), so a sample   ||
+||    that uses the same rows skips their lookup.  The results are           ||
+||    identical to Air::calculateProperties.                                 ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airStream.cpp                                                          ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airStream.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_STREAM_H
+#define _GH_DEF_AIR_STREAM_H
+
+#include "air.h"
+
+/**
+ *  @class AirStream A stateful evaluator for coherent sequences of
+ *         states (trajectories, sensor streams) that reuses the
+ *         pressure contours and coefficient rows of the previous
+ *         sample (Air::Rows).  The results are identical to
+ *         Air::calculateProperties.
+*/
+class AirStream
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor.  */
+    AirStream();
+
+    /** Copy constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created from the copied values.
+     *  @param copyFrom An AirStream object whose values are to be copied.
+     *  @return none.
+    */
+    AirStream (const AirStream &copyFrom);
+
+    /** Default destructor.  */
+    ~AirStream();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    ////////////////////
+    //    Getters
+    ////////////////////
+
+    /** Retrieve the number of samples evaluated with the cached
+     *  rows.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _hits.
+    */
+    uint64 getHits (void) const;
+
+    /** Retrieve the number of samples which required new rows.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _refreshes.
+    */
+    uint64 getRefreshes (void) const;
+
+    ////////////////////
+    //    Setters
+    ////////////////////
+
+    /** Discard the cached rows and zero the counters.
+     *
+     *  @pre The object is instantiated.
+     *  @post The next sample looks up its rows.
+     *  @return none.
+    */
+    void reset (void);
+
+    /** Calculate the properties of air at the given pressure and
+     *  temperature using the cached rows when they still apply.
+     *
+     *  @pre The object is instantiated.
+     *  @post The properties are stored in state.  The rows are
+     *        looked up again when the sample leaves their box.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param state The Air object which receives the properties.
+     *  @return true The calculation was performed successfully.
+     *  @return false The calculation could not be performed.
+    */
+    bool calculateProperties (double pressure, double temperature,
+                              Air &state);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    bool _valid;            // Whether _rows is usable.
+
+    uint64 _hits,           // Samples evaluated with the cached rows.
+           _refreshes;      // Samples which looked up new rows.
+
+    Air::Rows _rows;        // The rows of the previous sample.
+
+};  // end class AirStream
+
+#endif
@@ -0,0 +1,1288 @@
+/******************************************************************************
+||  airTable.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Property tables of the equilibrium air ADT.  The properties are        ||
+||    tabulated by calculateProperties on a uniform (log10 P, T) grid and    ||
+||    interpolated bilinearly, either as doubles or as 16-bit codes with a   ||
+||    float base and scale per tile.  A table is one position independent,   ||
+||    64-byte aligned, little-endian image with a versioned header,          ||
+||    checksums, and the hash of the curve fits that generated it, so a      ||
+||    saved table is loaded by mapping the file without parsing or copying.  ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airCoefficients.h                                                      ||
+||    airTable.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTable.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airTable.h"
+#include "airCoefficients.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#define AIR_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AIR_TABLE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/******************************************************
+**                  Image Format                     **
+******************************************************/
+
+// Image magic number.
+static const char MAGIC[8] = { 'A', 'I', 'R', 'T', 'A', 'B', 'L', 'E' };
+
+// Byte order tag; reads back as 0x01020304 on the writing host only.
+static const uint32 BYTE_ORDER_TAG = 0x01020304;
+
+// The generator of the tables.
+static const char GENERATOR[] = "Air::calculateProperties (RP-1260)";
+
+// The ADT pressure range [units: MPa].
+static const double P_MIN = 1E-4 * 0.101325,
+                    P_MAX = 100.0 * 0.101325;
+
+// Largest image accepted [units: bytes].
+static const uint64 MAX_IMAGE = uint64(1) << 40;
+
+// Quantized codes: 0 to Q16_MAX are values, Q16_NAN is NaN.
+static const unsigned short Q16_MAX = 0xFFFE,
+                            Q16_NAN = 0xFFFF;
+
+/**
+ *  @struct TableHeader The first 256 bytes of a table image.
+*/
+struct TableHeader
+{
+    char magic[8];            // "AIRTABLE"
+    uint32 version,           // AirTable::VERSION
+           headerBytes,       // sizeof(TableHeader)
+           byteOrder,         // BYTE_ORDER_TAG
+           alignment,         // AirTable::ALIGNMENT
+           nP,                // AirTableSpec
+           nT,
+           properties,
+           interpolation,
+           encoding;
+    double logPMin,
+           logPMax,
+           tMin,
+           tMax;
+    uint64 axisPOffset,       // Section offsets from the image start
+           axisTOffset,
+           columnsOffset,
+           columnBytes,       // Size of one (padded) column
+           imageBytes,        // Size of the whole image
+           coefficientHash,   // AirTable::coefficientHash() of the fits
+           dataChecksum,      // Hash of the bytes after the header
+           headerChecksum;    // Hash of the header (this field zero)
+    char generator[48];       // Description of the generator
+    float quantError[AirTable::NUM_PROPERTIES];  // Node errors (Q16)
+    double maxQuantError;     // AirTableSpec
+    uint32 doubleColumns;     // Columns of a Q16 table stored as doubles
+    char reserved[12];
+};
+
+static_assert(sizeof(TableHeader) == 256, "TableHeader is not 256 bytes");
+
+/** Round a size up to the section alignment.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param bytes The size of interest.
+ *  @return The aligned size.
+*/
+static uint64 align (uint64 bytes)
+{
+    const uint64 mask = AirTable::ALIGNMENT - 1;
+
+    return (bytes + mask) & ~mask;
+}
+
+/** Determine the number of tiles of each isobar of a quantized table.
+ *
+ *  @pre nT >= 2.
+ *  @post none.
+ *  @param nT The grid points in T.
+ *  @return The tiles per isobar.
+*/
+static uint32 tilesPerRow (uint32 nT)
+{
+    return (nT - 1 + AirTable::TILE_CELLS - 1) / AirTable::TILE_CELLS;
+}
+
+/** Determine the size of the tile (base, scale) section of a quantized
+ *  column.
+ *
+ *  @pre nP, nT >= 2.
+ *  @post none.
+ *  @param nP The grid points in log10 P.
+ *  @param nT The grid points in T.
+ *  @return The aligned size in bytes.
+*/
+static uint64 tileBytes (uint32 nP, uint32 nT)
+{
+    return align(uint64(nP) * tilesPerRow(nT) * 2 * sizeof(float));
+}
+
+/** Count the properties of a mask.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param properties The mask of interest.
+ *  @return The number of set bits.
+*/
+static uint32 countProperties (uint32 properties)
+{
+    uint32 count = 0;
+
+    for (uint32 p = 0; p < AirTable::NUM_PROPERTIES; ++p)
+        count += (properties >> p) & 1;
+
+    return count;
+}
+
+/** Check a spec and compute the section layout of its image.
+ *
+ *  @pre none.
+ *  @post header holds the spec and the layout (the hashes are zero).
+ *  @param spec The grid and contents.
+ *  @param header The destination.
+ *  @param doubleColumns The columns of a quantized table that are
+ *         stored as doubles (1 << AirTable::Property).
+ *  @return NULL The spec is valid.
+ *  @return The reason why the spec is invalid.
+*/
+static const char * layout (const AirTableSpec &spec, TableHeader &header,
+                            uint32 doubleColumns)
+{
+    if ((spec.nP < 2) || (spec.nT < 2))
+        return "the grid needs at least 2 x 2 points";
+
+    if (   !std::isfinite(spec.logPMin) || !std::isfinite(spec.logPMax)
+        || !std::isfinite(spec.tMin) || !std::isfinite(spec.tMax)
+        || !(spec.logPMin < spec.logPMax) || !(spec.tMin < spec.tMax))
+        return "the grid ranges are not increasing";
+
+    if (!spec.properties || (spec.properties & ~AirTable::ALL_PROPERTIES))
+        return "invalid property set";
+
+    if (spec.interpolation != AirTable::INTERP_BILINEAR)
+        return "unknown interpolation scheme";
+
+    if (   (spec.encoding != AirTable::ENCODING_DOUBLE)
+        && (spec.encoding != AirTable::ENCODING_Q16))
+        return "unknown encoding";
+
+    if (!(spec.maxQuantError >= 0.0))
+        return "invalid quantization error limit";
+
+    if (   (doubleColumns & ~spec.properties)
+        || (doubleColumns && (spec.encoding != AirTable::ENCODING_Q16)))
+        return "invalid double column set";
+
+    uint64 values = uint64(spec.nP) * spec.nT;
+
+    if (values > MAX_IMAGE / sizeof(double) / AirTable::NUM_PROPERTIES)
+        return "the grid is too large";
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+
+    header.version = AirTable::VERSION;
+    header.headerBytes = sizeof(TableHeader);
+    header.byteOrder = BYTE_ORDER_TAG;
+    header.alignment = AirTable::ALIGNMENT;
+    header.nP = spec.nP;
+    header.nT = spec.nT;
+    header.properties = spec.properties;
+    header.interpolation = spec.interpolation;
+    header.encoding = spec.encoding;
+    header.logPMin = spec.logPMin;
+    header.logPMax = spec.logPMax;
+    header.tMin = spec.tMin;
+    header.tMax = spec.tMax;
+    header.maxQuantError = spec.maxQuantError;
+    header.doubleColumns = doubleColumns;
+
+    header.axisPOffset = align(sizeof(TableHeader));
+    header.axisTOffset = header.axisPOffset
+                       + align(spec.nP * sizeof(double));
+    header.columnsOffset = header.axisTOffset
+                         + align(spec.nT * sizeof(double));
+
+    if (spec.encoding == AirTable::ENCODING_Q16)
+        header.columnBytes = tileBytes(spec.nP, spec.nT)
+                           + align(uint64(spec.nP) * tilesPerRow(spec.nT)
+                                   * (AirTable::TILE_CELLS + 1)
+                                   * sizeof(unsigned short));
+    else
+        header.columnBytes = align(values * sizeof(double));
+
+    uint32 quantized = countProperties(spec.properties & ~doubleColumns);
+
+    header.imageBytes = header.columnsOffset
+                      + header.columnBytes * quantized
+                      + align(values * sizeof(double))
+                        * countProperties(doubleColumns);
+
+    snprintf(header.generator, sizeof(header.generator), "%s", GENERATOR);
+
+    return NULL;
+}
+
+/** Quantize one column.  Each isobar is split into tiles that hold
+ *  the nodes TILE_CELLS * t through TILE_CELLS * (t + 1); the nodes
+ *  past the end of the grid repeat the last one.
+ *
+ *  @pre tiles and codes have room for the column.
+ *  @post tiles holds the (base, scale) pairs, codes the codes.
+ *  @param column The nP x nT values (T varying fastest).
+ *  @param nP The grid points in log10 P.
+ *  @param nT The grid points in T.
+ *  @param entropy Whether the column is the entropy (which passes
+ *         through zero, so its error is relative to at least 1).
+ *  @param tiles The destination of the tile pairs.
+ *  @param codes The destination of the codes.
+ *  @return The largest relative error of a node as the queries
+ *          decode it.
+*/
+static double quantize (const double *column, uint32 nP, uint32 nT,
+                        bool entropy, float *tiles, unsigned short *codes)
+{
+    const uint32 count = tilesPerRow(nT);
+    double error = 0.0;
+
+    for (uint32 i = 0; i < nP; ++i)
+    {
+        const double *isobar = column + size_t(i) * nT;
+
+        for (uint32 t = 0; t < count; ++t, tiles += 2)
+        {
+            double low = HUGE_VAL,
+                   high = -HUGE_VAL;
+
+            for (uint32 k = 0; k <= AirTable::TILE_CELLS; ++k)
+            {
+                double v = isobar[std::min(t * AirTable::TILE_CELLS + k,
+                                           nT - 1)];
+
+                if (std::isfinite(v))
+                {
+                    low = std::min(low, v);
+                    high = std::max(high, v);
+                }
+            }
+
+            float base = (low <= high) ? float(low) : 0.0f,
+                  scale = (low < high) ? float((high - low) / Q16_MAX)
+                                       : 0.0f;
+
+            tiles[0] = base;
+            tiles[1] = scale;
+
+            for (uint32 k = 0; k <= AirTable::TILE_CELLS; ++k, ++codes)
+            {
+                double v = isobar[std::min(t * AirTable::TILE_CELLS + k,
+                                           nT - 1)];
+
+                if (!std::isfinite(v))
+                {
+                    *codes = Q16_NAN;
+                    continue;
+                }
+
+                double code = (scale > 0.0f)
+                            ? floor((v - base) / scale + 0.5) : 0.0;
+
+                code = std::max(0.0, std::min(code, double(Q16_MAX)));
+                *codes = (unsigned short)code;
+
+                // The error of the node as the queries decode it.
+                float decoded = base + scale * float(*codes);
+                double magnitude = entropy ? std::max(fabs(v), 1.0)
+                                           : fabs(v);
+
+                if (magnitude > 0.0)
+                    error = std::max(error, fabs(decoded - v) / magnitude);
+            }
+        }
+    }
+
+    return error;
+}
+
+/** Hash a header with its own checksum field zeroed.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param header The header of interest.
+ *  @return The header checksum.
+*/
+static uint64 headerChecksum (const TableHeader &header)
+{
+    TableHeader copy = header;
+    copy.headerChecksum = 0;
+
+    return AirTable::hash(&copy, sizeof(copy));
+}
+
+/** Determine whether the host stores integers little-endian.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The host is little-endian.
+*/
+static bool littleEndian (void)
+{
+    const uint32 one = 1;
+    unsigned char first;
+    memcpy(&first, &one, 1);
+
+    return first == 1;
+}
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (the whole ADT range above 200 K, every
+ *  property, 61 x 600 points, bilinear, double precision, 0.1%
+ *  quantization error limit).  */
+AirTableSpec::AirTableSpec()
+  : nP(61), nT(600),
+    logPMin(log10(P_MIN)), logPMax(log10(P_MAX)),
+    tMin(200.0), tMax(30000.0),
+    properties(AirTable::ALL_PROPERTIES),
+    interpolation(AirTable::INTERP_BILINEAR),
+    encoding(AirTable::ENCODING_DOUBLE),
+    maxQuantError(1E-3)
+{  }
+
+/** Default constructor (no table).  */
+AirTable::AirTable()
+  : _image(NULL), _bytes(0), _mapping(NULL), _tilesPerRow(0),
+    _pScale(0.0), _tScale(0.0)
+{
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        _columns[p] = NULL;
+        _tiles[p] = NULL;
+        _codes[p] = NULL;
+        _quantError[p] = 0.0;
+    }
+
+    _error[0] = '\0';
+}
+
+/** Default destructor (releases the image).  */
+AirTable::~AirTable()
+{
+    reset();
+}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Determine whether a table is loaded.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The table can be queried.
+*/
+bool AirTable::isValid (void) const
+{  return _image != NULL;  }
+
+/** Determine whether the table is a mapped file.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The image is mapped read-only from a file.
+*/
+bool AirTable::isMapped (void) const
+{  return _mapping != NULL;  }
+
+/** Retrieve the grid and contents of the table.
+ *
+ *  @pre isValid().
+ *  @post none.
+ *  @return The value of _spec.
+*/
+const AirTableSpec & AirTable::getSpec (void) const
+{  return _spec;  }
+
+/** Retrieve the image of the table.
+ *
+ *  @pre isValid().
+ *  @post none.
+ *  @return The first byte of the image (64-byte aligned).
+*/
+const void * AirTable::getImage (void) const
+{  return _image;  }
+
+/** Retrieve the size of the image.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The size in bytes (0 if no table is loaded).
+*/
+size_t AirTable::getBytes (void) const
+{  return _bytes;  }
+
+/** Retrieve the reason of the last failure.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The message ("" if none).
+*/
+const char * AirTable::getError (void) const
+{  return _error;  }
+
+/** Retrieve the column of a stored property.
+ *
+ *  @pre property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @return The nP x nT values (T varying fastest), NULL if the
+ *          property is not stored or its column is quantized.
+*/
+const double * AirTable::getColumn (uint32 property) const
+{  return _columns[property];  }
+
+/** Retrieve the quantization error of a stored property.
+ *
+ *  @pre property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @return The largest error of a decoded node against
+ *          calculateProperties, relative to the magnitude of the
+ *          exact value (at least 1 kJ/kg-K for the entropy, which
+ *          passes through zero); 0 for a double column.
+*/
+double AirTable::getQuantizationError (uint32 property) const
+{  return _quantError[property];  }
+
+/******************************************************
+**               Loading / Storing                   **
+******************************************************/
+
+/** Tabulate the properties with Air::calculateProperties.
+ *
+ *  @pre spec.nP, spec.nT >= 2, the ranges are increasing and
+ *       spec.properties is not empty.
+ *  @post The table holds a new image in memory.
+ *  @param spec The grid and contents.
+ *  @return true The table was generated.
+ *  @return false The spec is invalid (see getError()).
+*/
+bool AirTable::generate (const AirTableSpec &spec)
+{
+    TableHeader header;
+    const char *invalid = layout(spec, header, 0);
+
+    reset();
+
+    if (invalid)
+    {
+        snprintf(_error, sizeof(_error), "AirTable: %s", invalid);
+        return false;
+    }
+
+    std::vector<double> axisP(spec.nP),
+                        axisT(spec.nT);
+
+    for (uint32 i = 0; i < spec.nP; ++i)
+        axisP[i] = (i + 1 < spec.nP)
+                 ? spec.logPMin + (spec.logPMax - spec.logPMin) * i
+                                  / double(spec.nP - 1)
+                 : spec.logPMax;
+
+    for (uint32 j = 0; j < spec.nT; ++j)
+        axisT[j] = (j + 1 < spec.nT)
+                 ? spec.tMin + (spec.tMax - spec.tMin) * j
+                               / double(spec.nT - 1)
+                 : spec.tMax;
+
+    // Every node of every property, one nP x nT block per property
+    // (the encoding of a quantized column is only known once all its
+    // nodes are).
+    const size_t values = size_t(spec.nP) * spec.nT;
+    std::vector<double> nodes(values * NUM_PROPERTIES);
+    Air air;
+
+    for (uint32 i = 0; i < spec.nP; ++i)
+    {
+        double pressure = pow(10.0, axisP[i]);
+
+        // Keep the rounding of pow at the range ends inside the ADT.
+        if (fabs(pressure - P_MIN) < 1E-12 * P_MIN)
+            pressure = P_MIN;
+        else if (fabs(pressure - P_MAX) < 1E-12 * P_MAX)
+            pressure = P_MAX;
+
+        for (uint32 j = 0; j < spec.nT; ++j)
+        {
+            double *node = &nodes[size_t(i) * spec.nT + j];
+
+            if (air.calculateProperties(pressure, axisT[j]))
+            {
+                node[ENTHALPY * values] = air.getEnthalpy();
+                node[SPECIFIC_HEAT * values] = air.getSpecificHeat();
+                node[GAMMA * values] = air.getGamma();
+                node[DENSITY * values] = air.getDensity();
+                node[ENTROPY * values] = air.getEntropy();
+                node[SOUND_SPEED * values] = air.getSoundSpeed();
+                node[THERMAL_COND * values] = air.getThermalConductivity();
+                node[VISCOSITY * values] = air.getDynamicViscosity();
+                node[PRANDTL * values] = air.getPrandtlNumber();
+                node[COMP_FACTOR * values] = air.getCompressibilityFactor();
+            }
+            else
+            {
+                for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+                    node[p * values] = NAN;
+            }
+        }
+    }
+
+    // Quantize the columns; those whose nodes do not fit the error
+    // limit (steep fit discontinuities inside a tile) stay doubles.
+    const uint32 tiles = tilesPerRow(spec.nT);
+    std::vector<float> bases[NUM_PROPERTIES];
+    std::vector<unsigned short> codes[NUM_PROPERTIES];
+    double errors[NUM_PROPERTIES] = { 0.0 };
+    uint32 doubleColumns = 0;
+
+    for (uint32 p = 0; (spec.encoding == ENCODING_Q16)
+                       && (p < NUM_PROPERTIES); ++p)
+    {
+        if (!(spec.properties & (1u << p)))
+            continue;
+
+        bases[p].resize(size_t(2) * spec.nP * tiles);
+        codes[p].resize(size_t(spec.nP) * tiles * (TILE_CELLS + 1));
+
+        errors[p] = quantize(&nodes[p * values], spec.nP, spec.nT,
+                             p == ENTROPY, &bases[p][0], &codes[p][0]);
+
+        if ((spec.maxQuantError > 0.0) && (errors[p] > spec.maxQuantError))
+        {
+            doubleColumns |= 1u << p;
+            errors[p] = 0.0;
+        }
+    }
+
+    layout(spec, header, doubleColumns);
+
+    // The vector only guarantees the alignment of new; the image starts
+    // at the first 64-byte boundary inside it.
+    _buffer.assign(size_t(header.imageBytes) + ALIGNMENT, 0);
+
+    unsigned char *image = &_buffer[0];
+    image += (ALIGNMENT - (size_t(image) & (ALIGNMENT - 1)))
+           & (ALIGNMENT - 1);
+
+    memcpy(image + header.axisPOffset, &axisP[0],
+           spec.nP * sizeof(double));
+    memcpy(image + header.axisTOffset, &axisT[0],
+           spec.nT * sizeof(double));
+
+    unsigned char *next = image + header.columnsOffset;
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        if (!(spec.properties & (1u << p)))
+            continue;
+
+        if (bases[p].empty() || (doubleColumns & (1u << p)))
+        {
+            memcpy(next, &nodes[p * values], values * sizeof(double));
+            next += align(values * sizeof(double));
+        }
+        else
+        {
+            memcpy(next, &bases[p][0], bases[p].size() * sizeof(float));
+            memcpy(next + tileBytes(spec.nP, spec.nT), &codes[p][0],
+                   codes[p].size() * sizeof(unsigned short));
+            next += header.columnBytes;
+        }
+    }
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+        header.quantError[p] = float(errors[p]);
+
+    header.coefficientHash = coefficientHash();
+    header.dataChecksum = hash(image + header.axisPOffset,
+                               size_t(header.imageBytes
+                                      - header.axisPOffset));
+    header.headerChecksum = headerChecksum(header);
+
+    memcpy(image, &header, sizeof(header));
+
+    return _use(image, size_t(header.imageBytes), false);
+}
+
+/** Write the image to a file.
+ *
+ *  @pre isValid().
+ *  @post The file holds the image.
+ *  @param path The destination file.
+ *  @return true The file was written.
+ *  @return false The file could not be written (see getError()).
+*/
+bool AirTable::save (const char *path) const
+{
+    FILE *file;
+
+    if (!_image)
+    {
+        snprintf(_error, sizeof(_error), "AirTable: no table to save");
+        return false;
+    }
+
+    if (!(file = fopen(path, "wb")))
+    {
+        snprintf(_error, sizeof(_error), "AirTable: cannot create %s", path);
+        return false;
+    }
+
+    bool written = (fwrite(_image, 1, _bytes, file) == _bytes);
+
+    if (fclose(file))
+        written = false;
+
+    if (!written)
+        snprintf(_error, sizeof(_error), "AirTable: cannot write %s", path);
+
+    return written;
+}
+
+/** Map a table file read-only.
+ *
+ *  @pre none.
+ *  @post The table reads the mapped pages.
+ *  @param path The table file.
+ *  @param verify Whether the data checksum is verified (this reads
+ *         every page once; the header is always verified).
+ *  @return true The file holds a valid table of the current fits.
+ *  @return false The file cannot be used (see getError()).
+*/
+bool AirTable::map (const char *path, bool verify)
+{
+    reset();
+
+#ifdef AIR_TABLE_MMAP
+    int fd = open(path, O_RDONLY);
+    struct stat status;
+
+    if ((fd < 0) || fstat(fd, &status) || (status.st_size <= 0))
+    {
+        snprintf(_error, sizeof(_error), "AirTable: cannot open %s", path);
+
+        if (fd >= 0)
+            close(fd);
+
+        return false;
+    }
+
+    size_t bytes = size_t(status.st_size);
+    void *mapping = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping keeps the file referenced.
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        snprintf(_error, sizeof(_error), "AirTable: cannot map %s", path);
+        return false;
+    }
+
+    if (!_use((const unsigned char *)mapping, bytes, verify))
+    {
+        munmap(mapping, bytes);
+        return false;
+    }
+
+    _mapping = mapping;
+
+    return true;
+#else
+    // Without mmap the image is read into memory.
+    FILE *file = fopen(path, "rb");
+
+    if (!file)
+    {
+        snprintf(_error, sizeof(_error), "AirTable: cannot open %s", path);
+        return false;
+    }
+
+    std::vector<unsigned char> data;
+    unsigned char block[65536];
+    size_t got;
+
+    while ((got = fread(block, 1, sizeof(block), file)) > 0)
+        data.insert(data.end(), block, block + got);
+
+    fclose(file);
+
+    _buffer.assign(data.size() + ALIGNMENT, 0);
+
+    unsigned char *image = &_buffer[0];
+    image += (ALIGNMENT - (size_t(image) & (ALIGNMENT - 1)))
+           & (ALIGNMENT - 1);
+
+    if (!data.empty())
+        memcpy(image, &data[0], data.size());
+
+    return _use(image, data.size(), verify);
+#endif
+}
+
+/** Use an image held in memory that the caller keeps alive (e.g.
+ *  shared memory).
+ *
+ *  @pre image is 8-byte aligned and outlives the table.
+ *  @post The table reads the image in place.
+ *  @param image The first byte of the image.
+ *  @param bytes The size of the image.
+ *  @param verify Whether the data checksum is verified.
+ *  @return true The image is a valid table of the current fits.
+ *  @return false The image cannot be used (see getError()).
+*/
+bool AirTable::attach (const void *image, size_t bytes, bool verify)
+{
+    reset();
+
+    return _use((const unsigned char *)image, bytes, verify);
+}
+
+/** Release the image.
+ *
+ *  @pre none.
+ *  @post isValid() is false.
+ *  @return none.
+*/
+void AirTable::reset (void)
+{
+#ifdef AIR_TABLE_MMAP
+    if (_mapping)
+        munmap(_mapping, _bytes);
+#endif
+
+    _mapping = NULL;
+    _image = NULL;
+    _bytes = 0;
+    _buffer.clear();
+    _error[0] = '\0';
+    _tilesPerRow = 0;
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        _columns[p] = NULL;
+        _tiles[p] = NULL;
+        _codes[p] = NULL;
+        _quantError[p] = 0.0;
+    }
+
+    return;
+}
+
+/******************************************************
+**                   Queries                         **
+******************************************************/
+
+/** Interpolate every stored property at the given state.
+ *
+ *  @pre isValid().
+ *  @post values holds the stored properties (in Property order);
+ *        the entries of the other properties are unchanged.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param values The destination, NUM_PROPERTIES entries.
+ *  @return true The state is inside the grid.
+ *  @return false The state is outside the grid (values unchanged).
+*/
+bool AirTable::lookup (double pressure, double temperature,
+                       double values[NUM_PROPERTIES]) const
+{
+    uint32 i, j;
+    double fp, ft;
+
+    if (!_locate(pressure, temperature, i, j, fp, ft))
+        return false;
+
+    const double w00 = (1.0 - fp) * (1.0 - ft),
+                 w01 = (1.0 - fp) * ft,
+                 w10 = fp * (1.0 - ft),
+                 w11 = fp * ft;
+
+    if (_spec.encoding == ENCODING_Q16)
+    {
+        const float weights[4] = { float(w00), float(w01),
+                                   float(w10), float(w11) };
+        const size_t tile = size_t(i) * _tilesPerRow + j / TILE_CELLS,
+                     code = tile * (TILE_CELLS + 1) + j % TILE_CELLS;
+
+        const size_t row = _spec.nT,
+                     index = size_t(i) * row + j;
+
+        for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+        {
+            const double *c = _columns[p];
+
+            if (_codes[p])
+                values[p] = _decode(p, tile, code, weights);
+            else if (c)
+                values[p] = w00 * c[index] + w01 * c[index + 1]
+                          + w10 * c[index + row]
+                          + w11 * c[index + row + 1];
+        }
+
+        return true;
+    }
+
+    const size_t row = _spec.nT,
+                 index = size_t(i) * row + j;
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        const double *c = _columns[p];
+
+        if (c)
+            values[p] = w00 * c[index] + w01 * c[index + 1]
+                      + w10 * c[index + row] + w11 * c[index + row + 1];
+    }
+
+    return true;
+}
+
+/** Interpolate one property at the given state.
+ *
+ *  @pre isValid(), property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @return The property, NaN outside the grid or if not stored.
+*/
+double AirTable::value (uint32 property, double pressure,
+                        double temperature) const
+{
+    uint32 i, j;
+    double fp, ft;
+    const double *c = _columns[property];
+
+    if ((!c && !_codes[property])
+        || !_locate(pressure, temperature, i, j, fp, ft))
+        return NAN;
+
+    if (!c)
+    {
+        const float weights[4] = { float((1.0 - fp) * (1.0 - ft)),
+                                   float((1.0 - fp) * ft),
+                                   float(fp * (1.0 - ft)),
+                                   float(fp * ft) };
+        const size_t tile = size_t(i) * _tilesPerRow + j / TILE_CELLS;
+
+        return _decode(property, tile,
+                       tile * (TILE_CELLS + 1) + j % TILE_CELLS, weights);
+    }
+
+    const size_t row = _spec.nT,
+                 index = size_t(i) * row + j;
+
+    return (1.0 - fp) * ((1.0 - ft) * c[index] + ft * c[index + 1])
+         + fp * ((1.0 - ft) * c[index + row] + ft * c[index + row + 1]);
+}
+
+/******************************************************
+**                   Utilities                       **
+******************************************************/
+
+/** Retrieve the name of a property (as used in reports).
+ *
+ *  @pre property < NUM_PROPERTIES.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @return The name.
+*/
+const char * AirTable::propertyName (uint32 property)
+{
+    static const char *names[NUM_PROPERTIES] =
+    {
+        "enthalpy", "specific_heat", "gamma", "density", "entropy",
+        "sound_speed", "thermal_cond", "viscosity", "prandtl",
+        "comp_factor"
+    };
+
+    return names[property];
+}
+
+/** Hash the curve fit coefficients, breakpoints, and constants of
+ *  the Air ADT (the generator of every table).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The hash of the current fits.
+*/
+uint64 AirTable::coefficientHash (void)
+{
+    struct Fits
+    {
+        static uint64 hashAll (void)
+        {
+            typedef AirCoefficients C;
+
+            uint64 h = hash(GENERATOR, sizeof(GENERATOR));
+
+            h = hash(C::hCoeffs, sizeof(C::hCoeffs), h);
+            h = hash(C::cpCoeffs, sizeof(C::cpCoeffs), h);
+            h = hash(C::kCoeffs, sizeof(C::kCoeffs), h);
+            h = hash(C::muCoeffs, sizeof(C::muCoeffs), h);
+            h = hash(C::zCoeffs, sizeof(C::zCoeffs), h);
+
+            h = hash(C::hDecadeRows, sizeof(C::hDecadeRows), h);
+            h = hash(C::cpDecadeRows, sizeof(C::cpDecadeRows), h);
+            h = hash(C::kDecadeRows, sizeof(C::kDecadeRows), h);
+            h = hash(C::muDecadeRows, sizeof(C::muDecadeRows), h);
+            h = hash(C::zDecadeRows, sizeof(C::zDecadeRows), h);
+
+            h = hash(C::hTmin, sizeof(C::hTmin), h);
+            h = hash(C::cpTmin, sizeof(C::cpTmin), h);
+            h = hash(C::kTmin, sizeof(C::kTmin), h);
+            h = hash(C::muTmin, sizeof(C::muTmin), h);
+            h = hash(C::zTmin, sizeof(C::zTmin), h);
+
+            return hash(&C::rUniv, sizeof(C::rUniv), h);
+        }
+    };
+
+    static const uint64 fits = Fits::hashAll();
+
+    return fits;
+}
+
+/** Hash a block of memory (the checksum of the image format).
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param data The first byte.
+ *  @param bytes The number of bytes.
+ *  @param seed The starting value (chains several blocks).
+ *  @return The 64-bit hash.
+*/
+uint64 AirTable::hash (const void *data, size_t bytes, uint64 seed)
+{
+    static const uint64 M1 = 0x9E3779B97F4A7C15ull,
+                        M2 = 0xC2B2AE3D27D4EB4Full;
+
+    const unsigned char *in = (const unsigned char *)data;
+
+    // Four independent lanes of 8-byte words keep several multiplies in
+    // flight; the lanes are folded together at the end.
+    uint64 lane[4] = { seed + M1, seed ^ M2, seed - M1, ~seed };
+    size_t blocks = bytes / 32;
+
+    for (size_t b = 0; b < blocks; ++b, in += 32)
+    {
+        for (uint32 l = 0; l < 4; ++l)
+        {
+            uint64 word;
+            memcpy(&word, in + 8 * l, sizeof(word));
+
+            lane[l] ^= word * M2;
+            lane[l] = ((lane[l] << 31) | (lane[l] >> 33)) * M1;
+        }
+    }
+
+    uint64 h = uint64(bytes) * M1;
+
+    for (uint32 l = 0; l < 4; ++l)
+    {
+        h ^= lane[l];
+        h = ((h << 27) | (h >> 37)) * M1 + M2;
+    }
+
+    for (size_t i = blocks * 32; i < bytes; ++i)
+        h = (h ^ *in++) * 0x100000001B3ull;
+
+    // Final avalanche.
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+
+    return h;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Validate an image and point the queries at it.
+ *
+ *  @pre none.
+ *  @post On success the spec, columns, and scales describe the
+ *        image; on failure the table is reset.
+ *  @param image The first byte of the image.
+ *  @param bytes The size of the image.
+ *  @param verify Whether the data checksum is verified.
+ *  @return true The image is valid.
+*/
+bool AirTable::_use (const unsigned char *image, size_t bytes, bool verify)
+{
+    const char *invalid = NULL;
+    TableHeader header,
+                expected;
+
+    if (!littleEndian())
+        invalid = "tables are little-endian only";
+    else if ((bytes < sizeof(TableHeader)) || (size_t(image) & 7))
+        invalid = "not a table image";
+    else
+    {
+        memcpy(&header, image, sizeof(header));
+
+        AirTableSpec spec;
+        spec.nP = header.nP;
+        spec.nT = header.nT;
+        spec.logPMin = header.logPMin;
+        spec.logPMax = header.logPMax;
+        spec.tMin = header.tMin;
+        spec.tMax = header.tMax;
+        spec.properties = header.properties;
+        spec.interpolation = header.interpolation;
+        spec.encoding = header.encoding;
+        spec.maxQuantError = header.maxQuantError;
+
+        if (memcmp(header.magic, MAGIC, sizeof(MAGIC)))
+            invalid = "not a table image";
+        else if (header.version != VERSION)
+            invalid = "unsupported table version";
+        else if (header.byteOrder != BYTE_ORDER_TAG)
+            invalid = "the table was written with another byte order";
+        else if (header.headerChecksum != headerChecksum(header))
+            invalid = "header checksum mismatch";
+        else if (layout(spec, expected, header.doubleColumns)
+                 || (header.axisPOffset != expected.axisPOffset)
+                 || (header.axisTOffset != expected.axisTOffset)
+                 || (header.columnsOffset != expected.columnsOffset)
+                 || (header.columnBytes != expected.columnBytes)
+                 || (header.imageBytes != expected.imageBytes)
+                 || (header.headerBytes != sizeof(TableHeader))
+                 || (header.alignment != ALIGNMENT))
+            invalid = "inconsistent table layout";
+        else if (header.imageBytes != bytes)
+            invalid = "the table is truncated";
+        else if (header.coefficientHash != coefficientHash())
+            invalid = "the table was generated from other curve fits";
+        else if (verify
+                 && (header.dataChecksum
+                         != hash(image + header.axisPOffset,
+                                 bytes - size_t(header.axisPOffset))))
+            invalid = "data checksum mismatch";
+        else
+            _spec = spec;
+    }
+
+    if (invalid)
+    {
+        // Keep the generated buffer of a failed generate() out of use.
+        reset();
+        snprintf(_error, sizeof(_error), "AirTable: %s", invalid);
+        return false;
+    }
+
+    _image = image;
+    _bytes = bytes;
+    _pScale = (_spec.nP - 1) / (_spec.logPMax - _spec.logPMin);
+    _tScale = (_spec.nT - 1) / (_spec.tMax - _spec.tMin);
+
+    _tilesPerRow = tilesPerRow(_spec.nT);
+
+    const unsigned char *next = image + header.columnsOffset;
+
+    for (uint32 p = 0; p < NUM_PROPERTIES; ++p)
+    {
+        _columns[p] = NULL;
+        _tiles[p] = NULL;
+        _codes[p] = NULL;
+        _quantError[p] = 0.0;
+
+        if (!(_spec.properties & (1u << p)))
+            continue;
+
+        if (   (_spec.encoding == ENCODING_Q16)
+            && !(header.doubleColumns & (1u << p)))
+        {
+            _tiles[p] = (const float *)next;
+            _codes[p] = (const unsigned short *)
+                        (next + tileBytes(_spec.nP, _spec.nT));
+            _quantError[p] = header.quantError[p];
+            next += header.columnBytes;
+        }
+        else
+        {
+            _columns[p] = (const double *)next;
+            next += align(uint64(_spec.nP) * _spec.nT * sizeof(double));
+        }
+    }
+
+    return true;
+}
+
+/** Locate a state in the grid.
+ *
+ *  @pre isValid().
+ *  @post none.
+ *  @param pressure The pressure of the state (in MPa).
+ *  @param temperature The temperature of the state (in K).
+ *  @param i The log10 P index of the enclosing cell.
+ *  @param j The T index of the enclosing cell.
+ *  @param fp The fraction of the cell in log10 P.
+ *  @param ft The fraction of the cell in T.
+ *  @return true The state is inside the grid.
+*/
+bool AirTable::_locate (double pressure, double temperature, uint32 &i,
+                        uint32 &j, double &fp, double &ft) const
+{
+    if (!_image)
+        return false;
+
+    const uint32 cellsP = _spec.nP - 1,
+                 cellsT = _spec.nT - 1;
+
+    double u = (log10(pressure) - _spec.logPMin) * _pScale,
+           v = (temperature - _spec.tMin) * _tScale;
+
+    // Tolerate the rounding of the scales at the upper grid edges.
+    if (   !(u >= 0.0) || !(u <= cellsP * (1.0 + 1E-12))
+        || !(v >= 0.0) || !(v <= cellsT * (1.0 + 1E-12)))
+        return false;
+
+    i = std::min(uint32(u), cellsP - 1);
+    j = std::min(uint32(v), cellsT - 1);
+
+    fp = std::min(u - i, 1.0);
+    ft = std::min(v - j, 1.0);
+
+    return true;
+}
+
+/** Decode the corners of a cell of a quantized column and
+ *  interpolate them.
+ *
+ *  @pre The table is quantized and the property is stored.
+ *  @post none.
+ *  @param property The property of interest.
+ *  @param tile The tile of the cell on the lower isobar.
+ *  @param code The code of the lower corner on the lower isobar.
+ *  @param weights The bilinear weights of the corners (i, j),
+ *         (i, j + 1), (i + 1, j), (i + 1, j + 1).
+ *  @return The interpolated property.
+*/
+double AirTable::_decode (uint32 property, size_t tile, size_t code,
+                          const float weights[4]) const
+{
+    // The tiles share their edge nodes, so both T corners of the cell
+    // are in the same tile; the isobar above is one row of tiles later.
+    const float *lower = _tiles[property] + 2 * tile,
+                *upper = lower + 2 * _tilesPerRow;
+
+    const unsigned short *c0 = _codes[property] + code,
+                         *c1 = c0 + _tilesPerRow * (TILE_CELLS + 1);
+
+#ifdef AIR_TABLE_SSE2
+    uint32 pair0, pair1;
+
+    memcpy(&pair0, c0, sizeof(pair0));
+    memcpy(&pair1, c1, sizeof(pair1));
+
+    // Widen the four 16-bit codes to 32-bit lanes, convert, and scale.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i q = _mm_unpacklo_epi16(_mm_set_epi32(0, 0, int(pair1),
+                                                 int(pair0)), zero);
+
+    __m128 base = _mm_set_ps(upper[0], upper[0], lower[0], lower[0]),
+           scale = _mm_set_ps(upper[1], upper[1], lower[1], lower[1]),
+           v = _mm_add_ps(base, _mm_mul_ps(scale, _mm_cvtepi32_ps(q)));
+
+    // Code 0xFFFF decodes to NaN (all bits set).
+    __m128 nan = _mm_castsi128_ps(_mm_cmpeq_epi32(q,
+                                                  _mm_set1_epi32(Q16_NAN)));
+    v = _mm_or_ps(v, nan);
+
+    // Weight the corners and add the four lanes.
+    v = _mm_mul_ps(v, _mm_loadu_ps(weights));
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+
+    return _mm_cvtss_f32(v);
+#else
+    const unsigned short q[4] = { c0[0], c0[1], c1[0], c1[1] };
+    const float *tiles[4] = { lower, lower, upper, upper };
+    float sum = 0.0f;
+
+    for (uint32 k = 0; k < 4; ++k)
+    {
+        float v = (q[k] == Q16_NAN) ? NAN
+                : tiles[k][0] + tiles[k][1] * float(q[k]);
+
+        sum += weights[k] * v;
+    }
+
+    return sum;
+#endif
+}
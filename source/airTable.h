@@ -0,0 +1,444 @@
+/******************************************************************************
+||  airTable.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Property tables of the equilibrium air ADT.  The properties are        ||
+||    tabulated by calculateProperties on a uniform (log10 P, T) grid and    ||
+||    interpolated bilinearly, either as doubles or as 16-bit codes with a   ||
+||    float base and scale per tile.  A table is one position independent,   ||
+||    64-byte aligned, little-endian image with a versioned header,          ||
+||    checksums, and the hash of the curve fits that generated it, so a      ||
+||    saved table is loaded by mapping the file without parsing or copying.  ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airTable.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTable.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_TABLE_H
+#define _GH_DEF_AIR_TABLE_H
+
+#include "air.h"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ *  @struct AirTableSpec The grid and contents of a property table.
+*/
+struct AirTableSpec
+{
+    uint32 nP,              // Grid points in log10 P
+           nT;              // Grid points in T
+    double logPMin,         // log10 of the lowest pressure [P in MPa]
+           logPMax,         // log10 of the highest pressure [P in MPa]
+           tMin,            // Lowest temperature [units: K]
+           tMax;            // Highest temperature [units: K]
+    uint32 properties,      // Stored properties (1 << AirTable::Property)
+           interpolation,   // AirTable::Interpolation
+           encoding;        // AirTable::Encoding
+    double maxQuantError;   // Largest node error of a quantized column
+                            // (relative); columns above it stay
+                            // doubles (0: no limit)
+
+    /** Default constructor (the whole ADT range above 200 K, every
+     *  property, 61 x 600 points, bilinear, double precision, 0.1%
+     *  quantization error limit).  */
+    AirTableSpec();
+};
+
+/**
+ *  @class AirTable Properties of air tabulated on a uniform
+ *         (log10 P, T) grid by Air::calculateProperties, queried by
+ *         interpolation.
+ *
+ *  A table is one contiguous, position independent image, so it can be
+ *  saved to a file and mapped back with mmap: no parsing or copying
+ *  takes place, the queries read the mapped pages directly.
+ *
+ *  Image layout (little-endian, every section 64-byte aligned):
+ *      header      256 bytes: magic "AIRTABLE", version, byte order tag,
+ *                  the AirTableSpec, section offsets, the generator and
+ *                  its coefficient hash, the data and header checksums
+ *      P axis      nP doubles, log10 P [P in MPa]
+ *      T axis      nT doubles [K]
+ *      columns     one per stored property (in Property order):
+ *                  ENCODING_DOUBLE: nP x nT doubles, T varying fastest
+ *                  ENCODING_Q16: the (base, scale) float pairs of the
+ *                  tiles, then TILE_CELLS + 1 codes per tile (or
+ *                  nP x nT doubles for a column that stays double)
+ *
+ *  A quantized (ENCODING_Q16) table splits each isobar into tiles of
+ *  TILE_CELLS grid cells and stores every node as a 16-bit code,
+ *  value = base + scale * code, with the base and scale of its tile
+ *  (code 0xFFFF is NaN).  The tiles share their edge nodes, so the four
+ *  corners of a cell are two 32-bit loads that are decoded together
+ *  with SIMD.  The image is about 3.5 times smaller than a double
+ *  table; the largest error of the stored nodes against
+ *  calculateProperties is recorded in the header when the table is
+ *  generated (see getQuantizationError()).  A tile that straddles a
+ *  steep curve fit discontinuity has a wide range and thus coarse
+ *  codes, so a column whose error exceeds AirTableSpec::maxQuantError
+ *  is stored as doubles instead (getColumn() is then not NULL).
+ *  A table whose coefficient hash differs from coefficientHash() was
+ *  generated from other curve fits and is rejected.
+*/
+class AirTable
+{
+  public:
+    /** The tabulated properties (units of the Air accessors).  */
+    enum Property
+    {
+        ENTHALPY,
+        SPECIFIC_HEAT,
+        GAMMA,
+        DENSITY,
+        ENTROPY,
+        SOUND_SPEED,
+        THERMAL_COND,
+        VISCOSITY,
+        PRANDTL,
+        COMP_FACTOR,
+        NUM_PROPERTIES
+    };
+
+    /** Interpolation schemes.  */
+    enum Interpolation
+    {
+        INTERP_BILINEAR    // Bilinear in (log10 P, T)
+    };
+
+    /** Storage of the property values.  */
+    enum Encoding
+    {
+        ENCODING_DOUBLE,   // One double per node
+        ENCODING_Q16       // 16-bit codes with a base and scale per tile
+    };
+
+    // Mask of every property.
+    static const uint32 ALL_PROPERTIES = (1u << NUM_PROPERTIES) - 1;
+
+    // Image format version.
+    static const uint32 VERSION = 1;
+
+    // Alignment of the image sections [units: bytes].
+    static const uint32 ALIGNMENT = 64;
+
+    // Grid cells along T in each tile of a quantized table.
+    static const uint32 TILE_CELLS = 32;
+
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (no table).  */
+    AirTable();
+
+    /** Default destructor (releases the image).  */
+    ~AirTable();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Determine whether a table is loaded.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The table can be queried.
+    */
+    bool isValid (void) const;
+
+    /** Determine whether the table is a mapped file.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The image is mapped read-only from a file.
+    */
+    bool isMapped (void) const;
+
+    /** Retrieve the grid and contents of the table.
+     *
+     *  @pre isValid().
+     *  @post none.
+     *  @return The value of _spec.
+    */
+    const AirTableSpec & getSpec (void) const;
+
+    /** Retrieve the image of the table.
+     *
+     *  @pre isValid().
+     *  @post none.
+     *  @return The first byte of the image (64-byte aligned).
+    */
+    const void * getImage (void) const;
+
+    /** Retrieve the size of the image.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The size in bytes (0 if no table is loaded).
+    */
+    size_t getBytes (void) const;
+
+    /** Retrieve the reason of the last failure.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The message ("" if none).
+    */
+    const char * getError (void) const;
+
+    /** Retrieve the column of a stored property.
+     *
+     *  @pre property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @return The nP x nT values (T varying fastest), NULL if the
+     *          property is not stored or its column is quantized.
+    */
+    const double * getColumn (uint32 property) const;
+
+    /** Retrieve the quantization error of a stored property.
+     *
+     *  @pre property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @return The largest error of a decoded node against
+     *          calculateProperties, relative to the magnitude of the
+     *          exact value (at least 1 kJ/kg-K for the entropy, which
+     *          passes through zero); 0 for a double column.
+    */
+    double getQuantizationError (uint32 property) const;
+
+    /******************************************************
+    **               Loading / Storing                   **
+    ******************************************************/
+
+    /** Tabulate the properties with Air::calculateProperties.
+     *
+     *  @pre spec.nP, spec.nT >= 2, the ranges are increasing and
+     *       spec.properties is not empty.
+     *  @post The table holds a new image in memory.
+     *  @param spec The grid and contents.
+     *  @return true The table was generated.
+     *  @return false The spec is invalid (see getError()).
+    */
+    bool generate (const AirTableSpec &spec);
+
+    /** Write the image to a file.
+     *
+     *  @pre isValid().
+     *  @post The file holds the image.
+     *  @param path The destination file.
+     *  @return true The file was written.
+     *  @return false The file could not be written (see getError()).
+    */
+    bool save (const char *path) const;
+
+    /** Map a table file read-only.
+     *
+     *  @pre none.
+     *  @post The table reads the mapped pages.
+     *  @param path The table file.
+     *  @param verify Whether the data checksum is verified (this reads
+     *         every page once; the header is always verified).
+     *  @return true The file holds a valid table of the current fits.
+     *  @return false The file cannot be used (see getError()).
+    */
+    bool map (const char *path, bool verify = true);
+
+    /** Use an image held in memory that the caller keeps alive (e.g.
+     *  shared memory).
+     *
+     *  @pre image is 8-byte aligned and outlives the table.
+     *  @post The table reads the image in place.
+     *  @param image The first byte of the image.
+     *  @param bytes The size of the image.
+     *  @param verify Whether the data checksum is verified.
+     *  @return true The image is a valid table of the current fits.
+     *  @return false The image cannot be used (see getError()).
+    */
+    bool attach (const void *image, size_t bytes, bool verify = true);
+
+    /** Release the image.
+     *
+     *  @pre none.
+     *  @post isValid() is false.
+     *  @return none.
+    */
+    void reset (void);
+
+    /******************************************************
+    **                   Queries                         **
+    ******************************************************/
+
+    /** Interpolate every stored property at the given state.
+     *
+     *  @pre isValid().
+     *  @post values holds the stored properties (in Property order);
+     *        the entries of the other properties are unchanged.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param values The destination, NUM_PROPERTIES entries.
+     *  @return true The state is inside the grid.
+     *  @return false The state is outside the grid (values unchanged).
+    */
+    bool lookup (double pressure, double temperature,
+                 double values[NUM_PROPERTIES]) const;
+
+    /** Interpolate one property at the given state.
+     *
+     *  @pre isValid(), property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @return The property, NaN outside the grid or if not stored.
+    */
+    double value (uint32 property, double pressure,
+                  double temperature) const;
+
+    /******************************************************
+    **                   Utilities                       **
+    ******************************************************/
+
+    /** Retrieve the name of a property (as used in reports).
+     *
+     *  @pre property < NUM_PROPERTIES.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @return The name.
+    */
+    static const char * propertyName (uint32 property);
+
+    /** Hash the curve fit coefficients, breakpoints, and constants of
+     *  the Air ADT (the generator of every table).
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The hash of the current fits.
+    */
+    static uint64 coefficientHash (void);
+
+    /** Hash a block of memory (the checksum of the image format).
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param data The first byte.
+     *  @param bytes The number of bytes.
+     *  @param seed The starting value (chains several blocks).
+     *  @return The 64-bit hash.
+    */
+    static uint64 hash (const void *data, size_t bytes, uint64 seed = 0);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    AirTableSpec _spec;                   // Grid and contents
+    const unsigned char *_image;          // The image (NULL: no table)
+    size_t _bytes;                        // Size of the image
+    void *_mapping;                       // mmap of the image (or NULL)
+    std::vector<unsigned char> _buffer;   // Generated image storage
+    const double *_columns[NUM_PROPERTIES];  // Stored columns (or NULL)
+    const float *_tiles[NUM_PROPERTIES];     // Quantized (base, scale)
+    const unsigned short *_codes[NUM_PROPERTIES];  // Quantized nodes
+    double _quantError[NUM_PROPERTIES];      // Recorded node errors
+    uint32 _tilesPerRow;                  // Tiles of each isobar
+    double _pScale,                       // Grid cells per log10 P
+           _tScale;                       // Grid cells per K
+    mutable char _error[192];             // Last failure
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Validate an image and point the queries at it.
+     *
+     *  @pre none.
+     *  @post On success the spec, columns, and scales describe the
+     *        image; on failure the table is reset.
+     *  @param image The first byte of the image.
+     *  @param bytes The size of the image.
+     *  @param verify Whether the data checksum is verified.
+     *  @return true The image is valid.
+    */
+    bool _use (const unsigned char *image, size_t bytes, bool verify);
+
+    /** Locate a state in the grid.
+     *
+     *  @pre isValid().
+     *  @post none.
+     *  @param pressure The pressure of the state (in MPa).
+     *  @param temperature The temperature of the state (in K).
+     *  @param i The log10 P index of the enclosing cell.
+     *  @param j The T index of the enclosing cell.
+     *  @param fp The fraction of the cell in log10 P.
+     *  @param ft The fraction of the cell in T.
+     *  @return true The state is inside the grid.
+    */
+    bool _locate (double pressure, double temperature, uint32 &i,
+                  uint32 &j, double &fp, double &ft) const;
+
+    /** Decode the corners of a cell of a quantized column and
+     *  interpolate them.
+     *
+     *  @pre The table is quantized and the property is stored.
+     *  @post none.
+     *  @param property The property of interest.
+     *  @param tile The tile of the cell on the lower isobar.
+     *  @param code The code of the lower corner on the lower isobar.
+     *  @param weights The bilinear weights of the corners (i, j),
+     *         (i, j + 1), (i + 1, j), (i + 1, j + 1).
+     *  @return The interpolated property.
+    */
+    double _decode (uint32 property, size_t tile, size_t code,
+                    const float weights[4]) const;
+
+    // Not copyable.
+    AirTable (const AirTable &);
+    AirTable & operator= (const AirTable &);
+
+};  // end class AirTable
+
+#endif
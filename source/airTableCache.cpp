@@ -0,0 +1,392 @@
+/******************************************************************************
+||  airTableCache.cpp      (implementation file)                             ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A persistent on-disk cache of the property tables of the equilibrium   ||
+||    air ADT.  Tables are stored in a local directory under a hash of       ||
+||    their grid, property set, interpolation scheme, and curve fit          ||
+||    coefficients; the first process generates a table under a lock file    ||
+||    and writes it atomically, later processes map the stored file.         ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airTableCache.h                                                        ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTableCache.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airTableCache.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AIR_TABLE_CACHE_POSIX
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor.  The directory is $AIR_TABLE_CACHE, else
+ *  $XDG_CACHE_HOME/air-adt, else $HOME/.cache/air-adt, else
+ *  /tmp/air-adt.  */
+AirTableCache::AirTableCache()
+  : _verify(true), _hits(0), _builds(0)
+{
+    const char *cache = getenv("AIR_TABLE_CACHE"),
+               *xdg = getenv("XDG_CACHE_HOME"),
+               *home = getenv("HOME");
+
+    if (cache && *cache)
+        _directory = cache;
+    else if (xdg && *xdg)
+        _directory = std::string(xdg) + "/air-adt";
+    else if (home && *home)
+        _directory = std::string(home) + "/.cache/air-adt";
+    else
+        _directory = "/tmp/air-adt";
+}
+
+/** Initialization constructor.
+ *
+ *  @pre none.
+ *  @post The cache uses the given directory.
+ *  @param directory The cache directory (created on demand).
+*/
+AirTableCache::AirTableCache (const char *directory)
+  : _directory(directory), _verify(true), _hits(0), _builds(0)
+{  }
+
+/** Default destructor.  */
+AirTableCache::~AirTableCache()
+{  }
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Retrieve the cache directory.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _directory.
+*/
+const std::string & AirTableCache::getDirectory (void) const
+{  return _directory;  }
+
+/** Retrieve whether the data checksum of cached tables is verified.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _verify (default true).
+*/
+bool AirTableCache::getVerify (void) const
+{  return _verify;  }
+
+/** Retrieve the number of tables mapped from the cache.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _hits.
+*/
+uint64 AirTableCache::getHits (void) const
+{  return _hits;  }
+
+/** Retrieve the number of tables generated by this object.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _builds.
+*/
+uint64 AirTableCache::getBuilds (void) const
+{  return _builds;  }
+
+/** Retrieve the reason of the last failure.  A failure to write the
+ *  cache is reported here even when load() succeeds.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The message ("" if none).
+*/
+const char * AirTableCache::getError (void) const
+{  return _error.c_str();  }
+
+/** Set whether the data checksum of cached tables is verified.
+ *
+ *  @pre none.
+ *  @post _verify is updated.
+ *  @param verify Whether every page is checked once on load.
+ *  @return none.
+*/
+void AirTableCache::setVerify (bool verify)
+{
+    _verify = verify;
+    return;
+}
+
+/******************************************************
+**                   Operations                      **
+******************************************************/
+
+/** Compute the cache key of a table configuration.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param spec The grid and contents.
+ *  @return The key.
+*/
+uint64 AirTableCache::key (const AirTableSpec &spec)
+{
+    // The fields are hashed one by one, so padding never enters the key.
+    uint64 h = AirTable::coefficientHash();
+    const uint32 words[6] = { AirTable::VERSION, spec.nP, spec.nT,
+                              spec.properties, spec.interpolation,
+                              spec.encoding };
+    const double ranges[5] = { spec.logPMin, spec.logPMax, spec.tMin,
+                               spec.tMax, spec.maxQuantError };
+
+    h = AirTable::hash(words, sizeof(words), h);
+
+    return AirTable::hash(ranges, sizeof(ranges), h);
+}
+
+/** Retrieve the cache file of a table configuration.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param spec The grid and contents.
+ *  @return The path ("<directory>/air-<key>.table").
+*/
+std::string AirTableCache::path (const AirTableSpec &spec) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/air-%016llx.table",
+             (unsigned long long)key(spec));
+
+    return _directory + name;
+}
+
+/** Map a table from the cache, generating and storing it first if
+ *  it is missing or unusable.
+ *
+ *  @pre none.
+ *  @post table holds the table of spec (mapped from the cache, or
+ *        in memory if the cache cannot be written).
+ *  @param spec The grid and contents.
+ *  @param table The destination.
+ *  @return true The table is valid.
+ *  @return false The spec is invalid (see getError()).
+*/
+bool AirTableCache::load (const AirTableSpec &spec, AirTable &table)
+{
+    std::string file = path(spec);
+
+    _error.clear();
+
+    // A table stored by an earlier job.
+    if (table.map(file.c_str(), _verify))
+    {
+        ++_hits;
+        return true;
+    }
+
+#ifdef AIR_TABLE_CACHE_POSIX
+    int lock = -1;
+
+    if (_makeDirectory())
+        lock = open((file + ".lock").c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (lock >= 0)
+    {
+        while (flock(lock, LOCK_EX) && (errno == EINTR))
+            ;
+
+        // Another job may have stored the table while this one waited.
+        if (table.map(file.c_str(), _verify))
+        {
+            close(lock);  // Releases the lock
+
+            ++_hits;
+            return true;
+        }
+    }
+    else
+        _error = "AirTableCache: cannot lock " + file;
+
+    if (!table.generate(spec))
+    {
+        _error = table.getError();
+
+        if (lock >= 0)
+            close(lock);
+
+        return false;
+    }
+
+    ++_builds;
+
+    // Serve the stored file, so that the pages are shared between jobs.
+    if ((lock >= 0) && _store(file, table)
+        && !table.map(file.c_str(), false))
+        table.generate(spec);
+
+    if (lock >= 0)
+        close(lock);
+
+    return true;
+#else
+    if (!table.generate(spec))
+    {
+        _error = table.getError();
+        return false;
+    }
+
+    ++_builds;
+    _error = "AirTableCache: caching needs POSIX file locks";
+
+    return true;
+#endif
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Create the cache directory and its parents.
+ *
+ *  @pre none.
+ *  @post The directory exists.
+ *  @return true The directory exists.
+*/
+bool AirTableCache::_makeDirectory (void)
+{
+#ifdef AIR_TABLE_CACHE_POSIX
+    std::string partial;
+
+    for (size_t i = 0; i <= _directory.size(); ++i)
+    {
+        if ((i == _directory.size()) || ((_directory[i] == '/') && i))
+        {
+            partial = _directory.substr(0, i);
+
+            if (mkdir(partial.c_str(), 0755) && (errno != EEXIST))
+            {
+                _error = "AirTableCache: cannot create " + partial;
+                return false;
+            }
+        }
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Write a table under a temporary name and rename it into place.
+ *
+ *  @pre table.isValid().
+ *  @post The file holds the table, or is unchanged on failure.
+ *  @param file The cache file.
+ *  @param table The table to be written.
+ *  @return true The file was written.
+*/
+bool AirTableCache::_store (const std::string &file, const AirTable &table)
+{
+#ifdef AIR_TABLE_CACHE_POSIX
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%ld.tmp", (long)getpid());
+
+    std::string temporary = file + suffix;
+    int fd = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0)
+    {
+        _error = "AirTableCache: cannot create " + temporary;
+        return false;
+    }
+
+    const char *data = (const char *)table.getImage();
+    size_t left = table.getBytes();
+
+    while (left > 0)
+    {
+        ssize_t written = write(fd, data, left);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        data += written;
+        left -= size_t(written);
+    }
+
+    // The data must be on disk before the rename makes it visible.
+    bool stored = !left && !fsync(fd);
+
+    if (close(fd))
+        stored = false;
+
+    if (stored && rename(temporary.c_str(), file.c_str()))
+        stored = false;
+
+    if (!stored)
+    {
+        unlink(temporary.c_str());
+        _error = "AirTableCache: cannot write " + file;
+    }
+
+    return stored;
+#else
+    (void)file;
+    (void)table;
+
+    return false;
+#endif
+}
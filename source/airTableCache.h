@@ -0,0 +1,221 @@
+/******************************************************************************
+||  airTableCache.h      (definition file)                                   ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A persistent on-disk cache of the property tables of the equilibrium   ||
+||    air ADT.  Tables are stored in a local directory under a hash of       ||
+||    their grid, property set, interpolation scheme, and curve fit          ||
+||    coefficients; the first process generates a table under a lock file    ||
+||    and writes it atomically, later processes map the stored file.         ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airTable.h                                                             ||
+||    airTableCache.cpp                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTableCache.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_TABLE_CACHE_H
+#define _GH_DEF_AIR_TABLE_CACHE_H
+
+#include "airTable.h"
+
+#include <string>
+
+/**
+ *  @class AirTableCache Keeps generated property tables in a local
+ *         directory, keyed by a hash of their configuration.
+ *
+ *  The key covers the grid, the property set, the interpolation
+ *  scheme, the image version, and AirTable::coefficientHash(), so a
+ *  change of any of them selects a new file and the table is rebuilt.
+ *  The first process that needs a table generates it while holding a
+ *  lock file; the others wait for the lock and then map the finished
+ *  file.  Files are written to a temporary name and renamed into
+ *  place, so a reader never sees a partial table.  On systems without
+ *  POSIX file locking the tables are generated without caching.
+*/
+class AirTableCache
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor.  The directory is $AIR_TABLE_CACHE, else
+     *  $XDG_CACHE_HOME/air-adt, else $HOME/.cache/air-adt, else
+     *  /tmp/air-adt.  */
+    AirTableCache();
+
+    /** Initialization constructor.
+     *
+     *  @pre none.
+     *  @post The cache uses the given directory.
+     *  @param directory The cache directory (created on demand).
+    */
+    AirTableCache (const char *directory);
+
+    /** Default destructor.  */
+    ~AirTableCache();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Retrieve the cache directory.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _directory.
+    */
+    const std::string & getDirectory (void) const;
+
+    /** Retrieve whether the data checksum of cached tables is verified.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _verify (default true).
+    */
+    bool getVerify (void) const;
+
+    /** Retrieve the number of tables mapped from the cache.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _hits.
+    */
+    uint64 getHits (void) const;
+
+    /** Retrieve the number of tables generated by this object.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _builds.
+    */
+    uint64 getBuilds (void) const;
+
+    /** Retrieve the reason of the last failure.  A failure to write the
+     *  cache is reported here even when load() succeeds.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The message ("" if none).
+    */
+    const char * getError (void) const;
+
+    /** Set whether the data checksum of cached tables is verified.
+     *
+     *  @pre none.
+     *  @post _verify is updated.
+     *  @param verify Whether every page is checked once on load.
+     *  @return none.
+    */
+    void setVerify (bool verify);
+
+    /******************************************************
+    **                   Operations                      **
+    ******************************************************/
+
+    /** Compute the cache key of a table configuration.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param spec The grid and contents.
+     *  @return The key.
+    */
+    static uint64 key (const AirTableSpec &spec);
+
+    /** Retrieve the cache file of a table configuration.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param spec The grid and contents.
+     *  @return The path ("<directory>/air-<key>.table").
+    */
+    std::string path (const AirTableSpec &spec) const;
+
+    /** Map a table from the cache, generating and storing it first if
+     *  it is missing or unusable.
+     *
+     *  @pre none.
+     *  @post table holds the table of spec (mapped from the cache, or
+     *        in memory if the cache cannot be written).
+     *  @param spec The grid and contents.
+     *  @param table The destination.
+     *  @return true The table is valid.
+     *  @return false The spec is invalid (see getError()).
+    */
+    bool load (const AirTableSpec &spec, AirTable &table);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    std::string _directory;   // The cache directory
+    bool _verify;             // Verify the data checksum on load
+    uint64 _hits,             // Tables mapped from the cache
+           _builds;           // Tables generated
+    std::string _error;       // Last failure
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Create the cache directory and its parents.
+     *
+     *  @pre none.
+     *  @post The directory exists.
+     *  @return true The directory exists.
+    */
+    bool _makeDirectory (void);
+
+    /** Write a table under a temporary name and rename it into place.
+     *
+     *  @pre table.isValid().
+     *  @post The file holds the table, or is unchanged on failure.
+     *  @param file The cache file.
+     *  @param table The table to be written.
+     *  @return true The file was written.
+    */
+    bool _store (const std::string &file, const AirTable &table);
+
+};  // end class AirTableCache
+
+#endif
@@ -0,0 +1,683 @@
+/******************************************************************************
+||  airTableShared.cpp      (implementation file)                            ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Node-wide sharing of the property tables of the equilibrium air ADT.   ||
+||    The first process that asks for a table builds it into a POSIX shared  ||
+||    memory segment named after the table configuration; the other          ||
+||    processes wait for the segment to become ready and map the image       ||
+||    read-only.  A control block holds the handshake state and the          ||
+||    reference count of the attached processes.                             ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airTableShared.h                                                       ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTableShared.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airTableShared.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AIR_TABLE_SHARED_POSIX
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/******************************************************
+**                 Segment Control                   **
+******************************************************/
+
+// Smallest page size; the control block must fit in one page.
+static const size_t MIN_PAGE_BYTES = 4096;
+
+// Process slots of the control block.
+static const uint32 MAX_ATTACHERS = 1000;
+
+// Control block magic number ("AIRSHARE").
+static const uint64 SEGMENT_MAGIC = 0x4149525348415245ull;
+
+/** Handshake states of a segment.  */
+enum SegmentState
+{
+    STATE_BUILDING,   // Created; the builder is filling the image
+    STATE_READY,      // The image is complete
+    STATE_FAILED      // The builder could not build the table
+};
+
+/**
+ *  @struct SharedControl The control block at the start of a segment.
+ *          A new segment is zero filled: building, no references.
+*/
+struct SharedControl
+{
+    std::atomic<uint64> magic,        // SEGMENT_MAGIC
+                        imageBytes;   // Size of the image
+    std::atomic<uint32> state,        // SegmentState
+                        references,   // Attached processes
+                        removed,      // The last process has detached
+                        builder,      // Process id of the builder
+                        attachers[MAX_ATTACHERS];   // Process ids (0: free)
+};
+
+// The control block is shared between processes, which only works
+// with address free (lock-free) atomics.
+static_assert((ATOMIC_INT_LOCK_FREE == 2) && (ATOMIC_LLONG_LOCK_FREE == 2),
+              "AirTableShared needs lock-free atomics");
+static_assert(sizeof(SharedControl) <= MIN_PAGE_BYTES,
+              "SharedControl does not fit its page");
+
+#ifdef AIR_TABLE_SHARED_POSIX
+
+/** Retrieve the size of the control block: one page, so that the
+ *  image that follows it can be mapped on its own.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The page size [units: bytes].
+*/
+static size_t controlBytes (void)
+{
+    static const long page = sysconf(_SC_PAGESIZE);
+
+    return (page > long(MIN_PAGE_BYTES)) ? size_t(page) : MIN_PAGE_BYTES;
+}
+
+/** Take a free process slot of a segment.
+ *
+ *  @pre The caller holds a reference.
+ *  @post The slot holds the process id of the caller.
+ *  @param control The control block.
+ *  @return The slot (MAX_ATTACHERS if all are taken; the reference is
+ *          then not recovered should the process die).
+*/
+static uint32 claimSlot (SharedControl &control)
+{
+    uint32 pid = uint32(getpid());
+
+    for (uint32 slot = 0; slot < MAX_ATTACHERS; ++slot)
+    {
+        uint32 expected = 0;
+
+        if (control.attachers[slot].compare_exchange_strong(expected, pid))
+            return slot;
+    }
+
+    return MAX_ATTACHERS;
+}
+
+/** Drop the references of the attached processes that have died
+ *  without detaching.
+ *
+ *  @pre The caller holds a reference (so the count stays above zero).
+ *  @post The slots of dead processes are free.
+ *  @param control The control block.
+ *  @return none.
+*/
+static void reapAttachers (SharedControl &control)
+{
+    for (uint32 slot = 0; slot < MAX_ATTACHERS; ++slot)
+    {
+        uint32 pid = control.attachers[slot].load();
+
+        if (   pid && kill(pid_t(pid), 0) && (errno == ESRCH)
+            && control.attachers[slot].compare_exchange_strong(pid, 0))
+            control.references.fetch_sub(1);
+    }
+
+    return;
+}
+
+/** Sleep for one polling interval (1 ms).  */
+static void waitInterval (void)
+{
+    struct timespec interval = { 0, 1000000 };
+    nanosleep(&interval, NULL);
+
+    return;
+}
+
+/** Read a monotonic clock.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The time in seconds since an arbitrary epoch.
+*/
+static double seconds (void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return double(now.tv_sec) + 1E-9 * double(now.tv_nsec);
+}
+
+/** Remove a segment name, unless it already names a newer segment.
+ *
+ *  @pre fd is the segment that should be removed.
+ *  @post The name is removed if it still refers to fd.
+ *  @param name The segment name.
+ *  @param fd The segment.
+ *  @return none.
+*/
+static void removeSegment (const std::string &name, int fd)
+{
+    int current = shm_open(name.c_str(), O_RDONLY, 0);
+    struct stat ours,
+                theirs;
+
+    if (current < 0)
+        return;
+
+    if (   !fstat(fd, &ours) && !fstat(current, &theirs)
+        && (ours.st_dev == theirs.st_dev) && (ours.st_ino == theirs.st_ino))
+        shm_unlink(name.c_str());
+
+    close(current);
+
+    return;
+}
+
+#endif
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (segment names start with "air-table").  */
+AirTableShared::AirTableShared()
+  : _prefix("air-table"), _fd(-1), _control(NULL), _image(NULL),
+    _imageBytes(0), _table(NULL), _slot(MAX_ATTACHERS), _builder(false),
+    _hugePages(false), _timeout(600.0)
+{  }
+
+/** Initialization constructor.
+ *
+ *  @pre prefix holds no '/'.
+ *  @post The segment names start with prefix (e.g. a job id, to
+ *        keep the segments of concurrent jobs apart).
+ *  @param prefix The segment name prefix.
+*/
+AirTableShared::AirTableShared (const char *prefix)
+  : _prefix(prefix), _fd(-1), _control(NULL), _image(NULL),
+    _imageBytes(0), _table(NULL), _slot(MAX_ATTACHERS), _builder(false),
+    _hugePages(false), _timeout(600.0)
+{  }
+
+/** Default destructor (detaches).  */
+AirTableShared::~AirTableShared()
+{
+    detach();
+}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+/** Determine whether this process built the attached segment.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _builder.
+*/
+bool AirTableShared::isBuilder (void) const
+{  return _builder;  }
+
+/** Retrieve the number of processes attached to the segment.
+ *
+ *  @pre A table is attached.
+ *  @post none.
+ *  @return The reference count (0 if nothing is attached).
+*/
+uint32 AirTableShared::getReferences (void) const
+{
+    if (!_control)
+        return 0;
+
+    return ((SharedControl *)_control)->references.load();
+}
+
+/** Retrieve whether the image is mapped with huge pages advised.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _hugePages (default false).
+*/
+bool AirTableShared::getHugePages (void) const
+{  return _hugePages;  }
+
+/** Retrieve the reason of the last failure.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The message ("" if none).
+*/
+const char * AirTableShared::getError (void) const
+{  return _error.c_str();  }
+
+/** Advise transparent huge pages for the image (needs
+ *  /sys/kernel/mm/transparent_hugepage/shmem_enabled set to advise
+ *  or always; ignored otherwise).
+ *
+ *  @pre none.
+ *  @post _hugePages is updated (used by the next attach()).
+ *  @param hugePages Whether huge pages are advised.
+ *  @return none.
+*/
+void AirTableShared::setHugePages (bool hugePages)
+{
+    _hugePages = hugePages;
+    return;
+}
+
+/** Set how long attach() waits for another process to build the
+ *  table.
+ *
+ *  @pre timeout > 0.
+ *  @post _timeout is updated.
+ *  @param timeout The time limit [units: s] (default 600).
+ *  @return none.
+*/
+void AirTableShared::setTimeout (double timeout)
+{
+    _timeout = timeout;
+    return;
+}
+
+/******************************************************
+**                   Operations                      **
+******************************************************/
+
+/** Retrieve the shared memory segment name of a table.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @param spec The grid and contents.
+ *  @return The name ("/<prefix>-<key>").
+*/
+std::string AirTableShared::name (const AirTableSpec &spec) const
+{
+    char key[24];
+    snprintf(key, sizeof(key), "-%016llx",
+             (unsigned long long)AirTableCache::key(spec));
+
+    return "/" + _prefix + key;
+}
+
+/** Attach to the node-wide copy of a table, building it if this
+ *  process is the first.
+ *
+ *  @pre none.
+ *  @post table reads the shared image until detach(); a previously
+ *        attached table is detached first.
+ *  @param spec The grid and contents.
+ *  @param table The destination.
+ *  @param cache The cache used by the building process (or NULL
+ *         to generate the table).
+ *  @return true The table is attached.
+ *  @return false The table could not be shared (see getError()).
+*/
+bool AirTableShared::attach (const AirTableSpec &spec, AirTable &table,
+                             AirTableCache *cache)
+{
+    detach();
+    _error.clear();
+
+#ifdef AIR_TABLE_SHARED_POSIX
+    _name = name(spec);
+
+    // A segment being torn down, or left by a dead builder, is retried.
+    for (uint32 attempt = 0; attempt < 16; ++attempt)
+    {
+        int fd = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+
+        if (fd >= 0)
+            return _build(fd, spec, table, cache);
+
+        if (errno != EEXIST)
+            break;
+
+        if ((fd = shm_open(_name.c_str(), O_RDWR, 0)) < 0)
+        {
+            if (errno == ENOENT)
+                continue;
+
+            break;
+        }
+
+        int joined = _join(fd, table);
+
+        if (joined > 0)
+            return true;
+
+        close(fd);
+
+        if (joined < 0)
+            return false;
+    }
+
+    if (_error.empty())
+        _error = "AirTableShared: cannot open " + _name + ": "
+               + strerror(errno);
+
+    return false;
+#else
+    (void)spec;
+    (void)table;
+    (void)cache;
+
+    _error = "AirTableShared: needs POSIX shared memory";
+
+    return false;
+#endif
+}
+
+/** Detach from the segment (removing it if this was the last
+ *  process) and reset the attached table.
+ *
+ *  @pre none.
+ *  @post No segment is attached.
+ *  @return none.
+*/
+void AirTableShared::detach (void)
+{
+#ifdef AIR_TABLE_SHARED_POSIX
+    if (_table)
+        _table->reset();
+
+    if (_image)
+        munmap(_image, _imageBytes);
+
+    if (_control)
+    {
+        SharedControl *control = (SharedControl *)_control;
+
+        // The references of dead processes are dropped first, so that
+        // the last live process removes the segment.
+        reapAttachers(*control);
+
+        if (_slot < MAX_ATTACHERS)
+            control->attachers[_slot].store(0);
+
+        if (control->references.fetch_sub(1) == 1)
+        {
+            control->removed.store(1);
+            removeSegment(_name, _fd);
+        }
+
+        munmap(_control, controlBytes());
+    }
+
+    if (_fd >= 0)
+        close(_fd);
+#endif
+
+    _fd = -1;
+    _control = NULL;
+    _image = NULL;
+    _imageBytes = 0;
+    _table = NULL;
+    _slot = MAX_ATTACHERS;
+    _builder = false;
+
+    return;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Create the segment and build the table into it.
+ *
+ *  @pre fd is the new, empty segment.
+ *  @post The segment is ready, or marked failed.
+ *  @return true The table is attached.
+*/
+bool AirTableShared::_build (int fd, const AirTableSpec &spec,
+                             AirTable &table, AirTableCache *cache)
+{
+#ifdef AIR_TABLE_SHARED_POSIX
+    void *mapping = MAP_FAILED;
+
+    _fd = fd;
+
+    if (!ftruncate(fd, controlBytes()))
+        mapping = mmap(NULL, controlBytes(), PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        _error = "AirTableShared: cannot create " + _name;
+        shm_unlink(_name.c_str());
+        detach();
+        return false;
+    }
+
+    SharedControl *control = (SharedControl *)mapping;
+
+    _control = mapping;
+    control->builder.store(uint32(getpid()));
+    control->references.fetch_add(1);
+    control->magic.store(SEGMENT_MAGIC);
+    _slot = claimSlot(*control);
+
+    // Build (or load) the table in private memory, then copy it in.
+    AirTable built;
+    bool loaded = cache ? cache->load(spec, built) : built.generate(spec);
+    size_t bytes = built.getBytes();
+
+    if (loaded && !ftruncate(fd, off_t(controlBytes() + bytes)))
+    {
+        mapping = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                       off_t(controlBytes()));
+
+        if (mapping != MAP_FAILED)
+        {
+#ifdef MADV_HUGEPAGE
+            if (_hugePages)
+                madvise(mapping, bytes, MADV_HUGEPAGE);
+#endif
+
+            memcpy(mapping, built.getImage(), bytes);
+            mprotect(mapping, bytes, PROT_READ);
+
+            _image = mapping;
+            _imageBytes = bytes;
+        }
+    }
+
+    if (!_image || !table.attach(_image, bytes, false))
+    {
+        const char *reason = !loaded ? (cache ? cache->getError()
+                                              : built.getError())
+                           : !_image ? "cannot size or map the segment"
+                                     : table.getError();
+
+        _error = "AirTableShared: cannot build " + _name + ": " + reason;
+
+        control->state.store(STATE_FAILED);
+        detach();
+        return false;
+    }
+
+    control->imageBytes.store(bytes);
+    control->state.store(STATE_READY);
+
+    _table = &table;
+    _builder = true;
+
+    return true;
+#else
+    (void)fd;
+    (void)spec;
+    (void)table;
+    (void)cache;
+
+    return false;
+#endif
+}
+
+/** Wait until another process has built the segment and map it.
+ *
+ *  @pre fd is an existing segment.
+ *  @post The table is attached, or the stale segment is removed.
+ *  @return 1 The table is attached.
+ *  @return 0 The segment was stale or torn down (retry).
+ *  @return -1 Failure.
+*/
+int AirTableShared::_join (int fd, AirTable &table)
+{
+#ifdef AIR_TABLE_SHARED_POSIX
+    double deadline = seconds() + _timeout;
+    struct stat status;
+
+    // The builder sizes the control block right after creating it.
+    while (!fstat(fd, &status) && (size_t(status.st_size) < controlBytes()))
+    {
+        if (seconds() > deadline)
+        {
+            _error = "AirTableShared: timed out waiting for " + _name;
+            return -1;
+        }
+
+        waitInterval();
+    }
+
+    void *mapping = mmap(NULL, controlBytes(), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        _error = "AirTableShared: cannot map " + _name;
+        return -1;
+    }
+
+    SharedControl *control = (SharedControl *)mapping;
+    uint32 state;
+
+    while ((state = control->state.load()) == STATE_BUILDING)
+    {
+        uint32 builder = control->builder.load();
+
+        // A builder that died leaves the segment building forever.
+        if (builder && kill(pid_t(builder), 0) && (errno == ESRCH))
+        {
+            removeSegment(_name, fd);
+            munmap(mapping, controlBytes());
+            return 0;
+        }
+
+        if (seconds() > deadline)
+        {
+            _error = "AirTableShared: timed out waiting for " + _name;
+            munmap(mapping, controlBytes());
+            return -1;
+        }
+
+        waitInterval();
+    }
+
+    if ((state != STATE_READY) || (control->magic.load() != SEGMENT_MAGIC))
+    {
+        _error = "AirTableShared: the builder of " + _name + " failed";
+        munmap(mapping, controlBytes());
+        return -1;
+    }
+
+    // The last process may be detaching; then a new segment is needed.
+    control->references.fetch_add(1);
+
+    if (control->removed.load())
+    {
+        control->references.fetch_sub(1);
+        munmap(mapping, controlBytes());
+        return 0;
+    }
+
+    _fd = fd;
+    _control = mapping;
+
+    // A process that died while attached still holds a slot.
+    reapAttachers(*control);
+    _slot = claimSlot(*control);
+
+    size_t bytes = size_t(control->imageBytes.load());
+
+    mapping = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd,
+                   off_t(controlBytes()));
+
+    if (mapping != MAP_FAILED)
+    {
+#ifdef MADV_HUGEPAGE
+        if (_hugePages)
+            madvise(mapping, bytes, MADV_HUGEPAGE);
+#endif
+
+        _image = mapping;
+        _imageBytes = bytes;
+    }
+
+    if (!_image || !table.attach(_image, bytes, false))
+    {
+        _error = "AirTableShared: cannot attach " + _name + ": "
+               + table.getError();
+
+        // The segment stays open for the other processes.
+        _fd = -1;
+        detach();
+        return -1;
+    }
+
+    _table = &table;
+
+    return 1;
+#else
+    (void)fd;
+    (void)table;
+
+    return -1;
+#endif
+}
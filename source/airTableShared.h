@@ -0,0 +1,252 @@
+/******************************************************************************
+||  airTableShared.h      (definition file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Node-wide sharing of the property tables of the equilibrium air ADT.   ||
+||    The first process that asks for a table builds it into a POSIX shared  ||
+||    memory segment named after the table configuration; the other          ||
+||    processes wait for the segment to become ready and map the image       ||
+||    read-only.  A control block holds the handshake state and the          ||
+||    reference count of the attached processes.                             ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airTable.h                                                             ||
+||    airTableCache.h                                                        ||
+||    airTableShared.cpp                                                     ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTableShared.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_TABLE_SHARED_H
+#define _GH_DEF_AIR_TABLE_SHARED_H
+
+#include "airTable.h"
+#include "airTableCache.h"
+
+#include <string>
+
+/**
+ *  @class AirTableShared Shares one copy of a property table between
+ *         all processes of a node through POSIX shared memory.
+ *
+ *  The segment is named after AirTableCache::key(), so the processes
+ *  that ask for the same table meet in the same segment.  The process
+ *  that creates the segment builds the table (from an AirTableCache
+ *  when one is given) and copies it in; the others wait until the
+ *  segment is marked ready and then map the image read-only.  A
+ *  control block at the start of the segment holds the handshake state,
+ *  the number of attached processes and their process ids; the last
+ *  process to detach removes the segment.  When the building process
+ *  dies, a waiting process removes the stale segment and builds the
+ *  table itself.  The reference of a process that dies while attached
+ *  is dropped by the next attach() or detach() of another process
+ *  (which checks the process ids with kill(pid, 0)).  A segment whose
+ *  processes all died stays until the table is attached again, or is
+ *  removed by hand (/dev/shm/<name> on Linux).
+ *
+ *  Segment layout:
+ *      control     one page: magic, state, reference count, builder
+ *                  process id, image size, attached process ids
+ *      image       the AirTable image (page aligned)
+*/
+class AirTableShared
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (segment names start with "air-table").  */
+    AirTableShared();
+
+    /** Initialization constructor.
+     *
+     *  @pre prefix holds no '/'.
+     *  @post The segment names start with prefix (e.g. a job id, to
+     *        keep the segments of concurrent jobs apart).
+     *  @param prefix The segment name prefix.
+    */
+    AirTableShared (const char *prefix);
+
+    /** Default destructor (detaches).  */
+    ~AirTableShared();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    /** Determine whether this process built the attached segment.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _builder.
+    */
+    bool isBuilder (void) const;
+
+    /** Retrieve the number of processes attached to the segment.
+     *
+     *  @pre A table is attached.
+     *  @post none.
+     *  @return The reference count (0 if nothing is attached).
+    */
+    uint32 getReferences (void) const;
+
+    /** Retrieve whether the image is mapped with huge pages advised.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _hugePages (default false).
+    */
+    bool getHugePages (void) const;
+
+    /** Retrieve the reason of the last failure.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The message ("" if none).
+    */
+    const char * getError (void) const;
+
+    /** Advise transparent huge pages for the image (needs
+     *  /sys/kernel/mm/transparent_hugepage/shmem_enabled set to advise
+     *  or always; ignored otherwise).
+     *
+     *  @pre none.
+     *  @post _hugePages is updated (used by the next attach()).
+     *  @param hugePages Whether huge pages are advised.
+     *  @return none.
+    */
+    void setHugePages (bool hugePages);
+
+    /** Set how long attach() waits for another process to build the
+     *  table.
+     *
+     *  @pre timeout > 0.
+     *  @post _timeout is updated.
+     *  @param timeout The time limit [units: s] (default 600).
+     *  @return none.
+    */
+    void setTimeout (double timeout);
+
+    /******************************************************
+    **                   Operations                      **
+    ******************************************************/
+
+    /** Retrieve the shared memory segment name of a table.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @param spec The grid and contents.
+     *  @return The name ("/<prefix>-<key>").
+    */
+    std::string name (const AirTableSpec &spec) const;
+
+    /** Attach to the node-wide copy of a table, building it if this
+     *  process is the first.
+     *
+     *  @pre none.
+     *  @post table reads the shared image until detach(); a previously
+     *        attached table is detached first.
+     *  @param spec The grid and contents.
+     *  @param table The destination.
+     *  @param cache The cache used by the building process (or NULL
+     *         to generate the table).
+     *  @return true The table is attached.
+     *  @return false The table could not be shared (see getError()).
+    */
+    bool attach (const AirTableSpec &spec, AirTable &table,
+                 AirTableCache *cache = NULL);
+
+    /** Detach from the segment (removing it if this was the last
+     *  process) and reset the attached table.
+     *
+     *  @pre none.
+     *  @post No segment is attached.
+     *  @return none.
+    */
+    void detach (void);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    std::string _prefix;       // Segment name prefix
+    std::string _name;         // Name of the attached segment
+    int _fd;                   // The attached segment (or -1)
+    void *_control;            // Mapped control block (or NULL)
+    void *_image;              // Mapped image (or NULL)
+    size_t _imageBytes;        // Size of the image mapping
+    AirTable *_table;          // The table reading the image
+    uint32 _slot;              // Process slot in the control block
+    bool _builder,             // This process built the segment
+         _hugePages;           // Advise huge pages for the image
+    double _timeout;           // Build wait limit [units: s]
+    std::string _error;        // Last failure
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Create the segment and build the table into it.
+     *
+     *  @pre fd is the new, empty segment.
+     *  @post The segment is ready, or marked failed.
+     *  @return true The table is attached.
+    */
+    bool _build (int fd, const AirTableSpec &spec, AirTable &table,
+                 AirTableCache *cache);
+
+    /** Wait until another process has built the segment and map it.
+     *
+     *  @pre fd is an existing segment.
+     *  @post The table is attached, or the stale segment is removed.
+     *  @return 1 The table is attached.
+     *  @return 0 The segment was stale or torn down (retry).
+     *  @return -1 Failure.
+    */
+    int _join (int fd, AirTable &table);
+
+    // Not copyable.
+    AirTableShared (const AirTableShared &);
+    AirTableShared & operator= (const AirTableShared &);
+
+};  // end class AirTableShared
+
+#endif
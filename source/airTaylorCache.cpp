@@ -0,0 +1,566 @@
+/******************************************************************************
+||  airTaylorCache.cpp      (implementation file)                            ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A neighborhood cache for the equilibrium air ADT.  An exact state      ||
+||    (the anchor) is stored together with the analytic pressure and         ||
+||    temperature derivatives of the curve fit properties.  Queries near     ||
+||    the anchor are answered with a first- or second-order Taylor           ||
+||    expansion when the estimated truncation error is inside the user       ||
+||    tolerance; otherwise the anchor is refreshed with an exact             ||
+||    evaluation.                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airCoefficients.h                                                      ||
+||    airTaylorCache.h                                                       ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTaylorCache.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airTaylorCache.h"
+#include "airCoefficients.h"
+#include "airStats.h"
+
+/******************************************************
+**               Local Helper Functions              **
+******************************************************/
+
+/** Evaluate the logarithmic temperature derivatives of an exponential
+ *  curve fit (enthalpy, specific heat, and thermal conductivity), where
+ *  ln(phi) = c0*x^4 + c1*x^3 + c2*x^2 + c3*x + c4 and x = ln(T / 10000).
+ *
+ *  @pre temperature > 0.
+ *  @post none.
+ *  @param c The five coefficients of the curve fit row.
+ *  @param temperature The temperature of the state in K.
+ *  @param lnPhi The natural log of the property.
+ *  @param g_T The derivative d(ln phi)/dT [units: 1/K].
+ *  @param g_TT The derivative d^2(ln phi)/dT^2 [units: 1/K^2].
+ *  @param g_TTT The derivative d^3(ln phi)/dT^3 [units: 1/K^3].
+ *  @return none.
+*/
+static void expFitDerivatives (const double c[5], double temperature,
+                               double &lnPhi, double &g_T, double &g_TT,
+                               double &g_TTT)
+{
+    double x = log(temperature / 10000.0);
+
+    // The fit and its derivatives with respect to x.
+    double f0 = (((c[0] * x + c[1]) * x + c[2]) * x + c[3]) * x + c[4],
+           f1 = ((4.0 * c[0] * x + 3.0 * c[1]) * x + 2.0 * c[2]) * x + c[3],
+           f2 = (12.0 * c[0] * x + 6.0 * c[1]) * x + 2.0 * c[2],
+           f3 = 24.0 * c[0] * x + 6.0 * c[1];
+
+    double T2 = temperature * temperature;
+
+    // dx/dT = 1/T, so the chain rule gives
+    //    d(ln phi)/dT     = f1 / T
+    //    d^2(ln phi)/dT^2 = (f2 - f1) / T^2
+    //    d^3(ln phi)/dT^3 = (f3 - 3 f2 + 2 f1) / T^3
+    lnPhi = f0;
+    g_T   = f1 / temperature;
+    g_TT  = (f2 - f1) / T2;
+    g_TTT = (f3 - (3.0 * f2) + (2.0 * f1)) / (T2 * temperature);
+
+    return;
+}
+
+/** Evaluate the logarithmic temperature derivatives of a polynomial
+ *  curve fit (compressibility factor and viscosity), where
+ *  phi = c0 + c1*x + ... + cn*x^n and x = T / 1000.
+ *
+ *  @pre The fit evaluates to a positive value.
+ *  @post none.
+ *  @param c The coefficients of the curve fit row (ascending powers).
+ *  @param n The number of coefficients in the row.
+ *  @param temperature The temperature of the state in K.
+ *  @param lnPhi The natural log of the property.
+ *  @param g_T The derivative d(ln phi)/dT [units: 1/K].
+ *  @param g_TT The derivative d^2(ln phi)/dT^2 [units: 1/K^2].
+ *  @param g_TTT The derivative d^3(ln phi)/dT^3 [units: 1/K^3].
+ *  @return none.
+*/
+static void polyFitDerivatives (const double *c, uint32 n,
+                                double temperature, double &lnPhi,
+                                double &g_T, double &g_TT, double &g_TTT)
+{
+    double x = temperature / 1000.0;
+
+    double f0 = 0.0,
+           f1 = 0.0,
+           f2 = 0.0,
+           f3 = 0.0;
+
+    // Horner evaluation of the fit and its first three derivatives
+    // with respect to x (f2 and f3 are carried divided by 2! and 3!).
+    for (uint32 i = n; i-- > 0; )
+    {
+        f3 = f3 * x + f2;
+        f2 = f2 * x + f1;
+        f1 = f1 * x + f0;
+        f0 = f0 * x + c[i];
+    }
+
+    // dx/dT = 1/1000; form the ratios (d^n phi/dT^n) / phi.
+    double q1 = f1 / (1.0E3 * f0),
+           q2 = 2.0 * f2 / (1.0E6 * f0),
+           q3 = 6.0 * f3 / (1.0E9 * f0);
+
+    lnPhi = log(f0);
+    g_T   = q1;
+    g_TT  = q2 - (q1 * q1);
+    g_TTT = q3 - (3.0 * q1 * q2) + (2.0 * q1 * q1 * q1);
+
+    return;
+}
+
+/******************************************************
+**           Constructors / Destructors              **
+******************************************************/
+
+/** Default constructor (second order, 1E-6 relative tolerance).  */
+AirTaylorCache::AirTaylorCache()
+  : _anchor(), _rows(), _valid(false), _expanded(false),
+    _tolerance(1E-6), _order(2),
+    _hits(0), _refreshes(0), _bypasses(0), _misses(0)
+{}
+
+/** Copy constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created from the copied values.
+ *  @param copyFrom An AirTaylorCache object whose values are copied.
+ *  @return none.
+*/
+AirTaylorCache::AirTaylorCache (const AirTaylorCache &copyFrom)
+  : _anchor(copyFrom._anchor), _rows(copyFrom._rows),
+    _valid(copyFrom._valid), _expanded(copyFrom._expanded),
+    _tolerance(copyFrom._tolerance), _order(copyFrom._order),
+    _hits(copyFrom._hits), _refreshes(copyFrom._refreshes),
+    _bypasses(copyFrom._bypasses), _misses(copyFrom._misses)
+{
+    for (uint32 i = 0; i < _NUM_PRIMARY; ++i)
+    {
+        _phi[i]     = copyFrom._phi[i];
+        _phi_P[i]   = copyFrom._phi_P[i];
+        _phi_T[i]   = copyFrom._phi_T[i];
+        _phi_PP[i]  = copyFrom._phi_PP[i];
+        _phi_PT[i]  = copyFrom._phi_PT[i];
+        _phi_TT[i]  = copyFrom._phi_TT[i];
+        _phi_PPP[i] = copyFrom._phi_PPP[i];
+        _phi_PPT[i] = copyFrom._phi_PPT[i];
+        _phi_PTT[i] = copyFrom._phi_PTT[i];
+        _phi_TTT[i] = copyFrom._phi_TTT[i];
+    }
+}
+
+/** Initialization constructor.
+ *
+ *  @pre none.
+ *  @post A new object is created with an empty anchor.
+ *  @param tolerance The largest estimated relative error of the
+ *         expanded curve fit properties that is accepted.
+ *  @param order The order of the Taylor expansion (1 or 2).
+*/
+AirTaylorCache::AirTaylorCache (double tolerance, uint32 order)
+  : _anchor(), _rows(), _valid(false), _expanded(false),
+    _tolerance(tolerance), _order(2),
+    _hits(0), _refreshes(0), _bypasses(0), _misses(0)
+{  setOrder(order);  }
+
+/** Default destructor.  */
+AirTaylorCache::~AirTaylorCache() {}
+
+/******************************************************
+**               Accessors / Mutators                **
+******************************************************/
+
+////////////////////
+//    Getters
+////////////////////
+
+/** Retrieve the accepted relative error of the expansion.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _tolerance [-dimensionless-].
+*/
+double AirTaylorCache::getTolerance (void) const
+{  return _tolerance;  }
+
+/** Retrieve the order of the Taylor expansion.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _order (1 or 2).
+*/
+uint32 AirTaylorCache::getOrder (void) const
+{  return _order;  }
+
+/** Retrieve the number of queries answered by the expansion.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _hits.
+*/
+uint64 AirTaylorCache::getHits (void) const
+{  return _hits;  }
+
+/** Retrieve the number of anchors whose derivatives were
+ *  evaluated.
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _refreshes.
+*/
+uint64 AirTaylorCache::getRefreshes (void) const
+{  return _refreshes;  }
+
+/** Retrieve the number of queries evaluated exactly by Air (misses,
+ *  T <= 500 K, and out of range).
+ *
+ *  @pre The object is instantiated.
+ *  @post none.
+ *  @return The value of _bypasses.
+*/
+uint64 AirTaylorCache::getBypasses (void) const
+{  return _bypasses;  }
+
+////////////////////
+//    Setters
+////////////////////
+
+/** Set the accepted relative error of the expansion.
+ *
+ *  @pre The object is instantiated.
+ *  @post _tolerance is updated; the anchor is kept.
+ *  @param tolerance The accepted relative error [-dimensionless-].
+ *  @return none.
+*/
+void AirTaylorCache::setTolerance (double tolerance)
+{  _tolerance = tolerance;  }
+
+/** Set the order of the Taylor expansion.
+ *
+ *  @pre The object is instantiated.
+ *  @post _order is updated (clamped to 1 or 2).
+ *  @param order The order of the expansion.
+ *  @return none.
+*/
+void AirTaylorCache::setOrder (uint32 order)
+{  _order = (order <= 1) ? 1 : 2;  }
+
+/** Discard the anchor state and zero the hit counters.
+ *
+ *  @pre The object is instantiated.
+ *  @post The next query performs an exact evaluation.
+ *  @return none.
+*/
+void AirTaylorCache::reset (void)
+{
+    _anchor.reset();
+    _valid = false;
+    _expanded = false;
+
+    _hits = 0;
+    _refreshes = 0;
+    _bypasses = 0;
+    _misses = 0;
+
+    return;
+}
+
+/** Calculate the properties of air at the given pressure and
+ *  temperature, expanding about the anchor state when possible.
+ *
+ *  Every exact evaluation becomes the new anchor, but its derivatives
+ *  are only evaluated once a later query uses the same curve fit rows,
+ *  so on incoherent inputs a miss costs the exact evaluation and a
+ *  copy of the state.  After _MISS_STREAK consecutive misses only
+ *  every _MISS_STREAK-th anchor has its derivatives evaluated.
+ *
+ *  The tolerance bounds the estimated error of the five curve fit
+ *  properties (enthalpy, specific heat, thermal conductivity,
+ *  viscosity, compressibility factor).  The derived properties
+ *  inherit their error: density, which goes with the square of the
+ *  compressibility factor, reaches about twice the tolerance, and
+ *  gamma and the speed of sound amplify the specific heat error
+ *  where it approaches the gas constant.
+ *
+ *  @pre The object is instantiated.
+ *  @post The properties are stored in state.  When the expansion
+ *        is rejected, the exact state becomes the new anchor.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param state The Air object which receives the properties.
+ *  @return true The calculation was performed successfully.
+ *  @return false The calculation could not be performed.
+*/
+bool AirTaylorCache::calculateProperties (double pressure,
+                                          double temperature, Air &state)
+{
+    AIR_STATS_COUNT(CALLS_TAYLOR);
+
+    // Only a state that uses the coefficient rows of the anchor can be
+    // expanded, since the fits are only piecewise continuous.  States
+    // out of range or at or below 500 K (and NaN inputs) use no rows.
+    if (_valid && _anchor.hasRows(pressure, temperature, _rows))
+    {
+        if (   !_expanded
+            && (   (_misses <= _MISS_STREAK)
+                || ((_misses % _MISS_STREAK) == 0)))
+        {
+            _setDerivatives();
+            ++_refreshes;
+
+            AIR_STATS_COUNT(TAYLOR_REFRESH);
+        }
+
+        if (_expanded && _expand(pressure, temperature, state))
+        {
+            ++_hits;
+            _misses = 0;
+            return true;
+        }
+    }
+
+    ++_bypasses;
+    AIR_STATS_COUNT(TAYLOR_BYPASS);
+
+    Air::Rows rows;
+
+    if (!state.getRows(pressure, temperature, rows))
+        return state.calculateProperties(pressure, temperature);
+
+    state.calculateProperties(pressure, temperature, rows);
+
+    // The exact state is the new anchor; its derivatives wait for a
+    // query that needs them.
+    ++_misses;
+
+    _anchor = state;
+    _rows = rows;
+    _valid = true;
+    _expanded = false;
+
+    return true;
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Expand the anchor state to the given state.
+ *
+ *  @pre _expanded is true and the state uses the rows of the anchor.
+ *  @post When the expansion is accepted, its properties are stored in
+ *        state; otherwise state is unchanged.
+ *  @param pressure The air pressure of the state (in MPa).
+ *  @param temperature The air temperature of the state (in K).
+ *  @param state The Air object which receives the properties.
+ *  @return true The estimated error is inside the tolerance.
+ *  @return false The expansion was rejected.
+*/
+bool AirTaylorCache::_expand (double pressure, double temperature,
+                              Air &state) const
+{
+    double dP = pressure - _anchor.getPressure(),        // [units: MPa]
+           dT = temperature - _anchor.getTemperature();  // [units: K]
+
+    double phi[_NUM_PRIMARY];
+
+    for (uint32 i = 0; i < _NUM_PRIMARY; ++i)
+    {
+        double t1 = (_phi_P[i] * dP) + (_phi_T[i] * dT),
+               t2 = (0.5 * _phi_PP[i] * dP * dP)
+                  + (_phi_PT[i] * dP * dT)
+                  + (0.5 * _phi_TT[i] * dT * dT);
+
+        double error;
+
+        // The truncation error is estimated by the first neglected
+        // term of the expansion.
+        if (_order == 1)
+        {
+            phi[i] = _phi[i] + t1;
+            error = fabs(t2);
+        }
+        else
+        {
+            double t3 = (  (_phi_PPP[i] * dP * dP * dP)
+                         + (3.0 * _phi_PPT[i] * dP * dP * dT)
+                         + (3.0 * _phi_PTT[i] * dP * dT * dT)
+                         + (_phi_TTT[i] * dT * dT * dT)) / 6.0;
+
+            phi[i] = _phi[i] + t1 + t2;
+            error = fabs(t3);
+        }
+
+        // Written so that a NaN estimate rejects the expansion.
+        if (!(error <= _tolerance * fabs(_phi[i])))
+            return false;
+    }
+
+    // Units: kJ/kg, kJ/kg-K, W/m-K, kg/m-s, and -dimensionless-.
+    state.setPrimaryProperties(pressure, temperature, phi[0], phi[1],
+                               phi[2], phi[3], phi[4]);
+
+    return true;
+}
+
+/** Evaluate the derivatives of the anchor state.
+ *
+ *  @pre _anchor holds the properties calculated at a valid pressure
+ *       and a temperature above 500 K, and _rows holds its rows.
+ *  @post The derivatives are updated and _expanded is true.
+ *  @return none.
+*/
+void AirTaylorCache::_setDerivatives (void)
+{
+    const Air &state = _anchor;
+
+    double T = state.getTemperature(),          // [units: K]
+           P = state.getPressure(),             // [units: MPa]
+           p = state.getPressure() / 0.101325;  // [units: atm]
+
+    // Logarithmic derivatives of each primary property with respect
+    // to L = ln(P) and T.  Since the units of each property are a
+    // constant multiple of the fit units, these are unit-free.  The
+    // log-linear pressure interpolation makes ln(phi) linear in L, so
+    // every derivative of second or higher order in L vanishes.
+    double g_L[_NUM_PRIMARY],
+           g_T[_NUM_PRIMARY],
+           g_LT[_NUM_PRIMARY],
+           g_TT[_NUM_PRIMARY],
+           g_LTT[_NUM_PRIMARY],
+           g_TTT[_NUM_PRIMARY];
+
+    double p1 = _rows.pLower,
+           p2 = _rows.pUpper;
+
+    const uint32 *rows[_NUM_PRIMARY] = { _rows.h, _rows.cp, _rows.k,
+                                         _rows.mu, _rows.z };
+
+    // Log-linear interpolation between the pressure contours:
+    //    ln(phi) = (1 - w) ln(phi_1) + w ln(phi_2)
+    //    w = (ln p - ln p1) / (ln p2 - ln p1)
+    double dL = log(p2) - log(p1),
+           w = (log(p) - log(p1)) / dL;
+
+    for (uint32 i = 0; i < _NUM_PRIMARY; ++i)
+    {
+        double lnPhi[2], gT[2], gTT[2], gTTT[2];
+
+        for (uint32 j = 0; j < 2; ++j)
+        {
+            uint32 row = rows[i][j];
+
+            switch (i)
+            {
+                case 0:
+                    expFitDerivatives(AirCoefficients::hCoeffs[row], T,
+                                      lnPhi[j], gT[j], gTT[j], gTTT[j]);
+                    break;
+                case 1:
+                    expFitDerivatives(AirCoefficients::cpCoeffs[row], T,
+                                      lnPhi[j], gT[j], gTT[j], gTTT[j]);
+                    break;
+                case 2:
+                    expFitDerivatives(AirCoefficients::kCoeffs[row], T,
+                                      lnPhi[j], gT[j], gTT[j], gTTT[j]);
+                    break;
+                case 3:
+                    polyFitDerivatives(AirCoefficients::muCoeffs[row], 6, T,
+                                       lnPhi[j], gT[j], gTT[j], gTTT[j]);
+                    break;
+                default:
+                    polyFitDerivatives(AirCoefficients::zCoeffs[row], 5, T,
+                                       lnPhi[j], gT[j], gTT[j], gTTT[j]);
+                    break;
+            }
+        }
+
+        g_L[i]   = (lnPhi[1] - lnPhi[0]) / dL;
+        g_T[i]   = ((1.0 - w) * gT[0]) + (w * gT[1]);
+        g_TT[i]  = ((1.0 - w) * gTT[0]) + (w * gTT[1]);
+        g_TTT[i] = ((1.0 - w) * gTTT[0]) + (w * gTTT[1]);
+        g_LT[i]  = (gT[1] - gT[0]) / dL;
+        g_LTT[i] = (gTT[1] - gTT[0]) / dL;
+    }
+
+    _phi[0] = state.getEnthalpy();
+    _phi[1] = state.getSpecificHeat();
+    _phi[2] = state.getThermalConductivity();
+    _phi[3] = state.getDynamicViscosity();
+    _phi[4] = state.getCompressibilityFactor();
+
+    for (uint32 i = 0; i < _NUM_PRIMARY; ++i)
+    {
+        double f = _phi[i],
+               L = g_L[i],
+               t = g_T[i];
+
+        // Derivatives of phi = exp(ln phi) with respect to L and T.
+        double phi_L   = f * L,
+               phi_LL  = f * L * L,
+               phi_LLL = f * L * L * L,
+               phi_LT  = f * ((L * t) + g_LT[i]),
+               phi_LLT = f * ((L * L * t) + (2.0 * L * g_LT[i])),
+               phi_LTT = f * (  (L * t * t) + (2.0 * t * g_LT[i])
+                              + (L * g_TT[i]) + g_LTT[i]);
+
+        // Convert to derivatives with respect to P [MPa] using
+        // d/dP = (1/P) d/dL.
+        _phi_P[i]   = phi_L / P;
+        _phi_PP[i]  = (phi_LL - phi_L) / (P * P);
+        _phi_PPP[i] = (phi_LLL - (3.0 * phi_LL) + (2.0 * phi_L)) / (P * P * P);
+        _phi_PT[i]  = phi_LT / P;
+        _phi_PPT[i] = (phi_LLT - phi_LT) / (P * P);
+        _phi_PTT[i] = phi_LTT / P;
+
+        _phi_T[i]   = f * t;
+        _phi_TT[i]  = f * ((t * t) + g_TT[i]);
+        _phi_TTT[i] = f * ((t * t * t) + (3.0 * t * g_TT[i]) + g_TTT[i]);
+    }
+
+    _expanded = true;
+
+    return;
+}
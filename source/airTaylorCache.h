@@ -0,0 +1,275 @@
+/******************************************************************************
+||  airTaylorCache.h      (definition file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    A neighborhood cache for the equilibrium air ADT.  An exact state      ||
+||    (the anchor) is stored together with the analytic pressure and         ||
+||    temperature derivatives of the curve fit properties.  Queries near     ||
+||    the anchor are answered with a first- or second-order Taylor           ||
+||    expansion when the estimated truncation error is inside the user       ||
+||    tolerance; otherwise the anchor is refreshed with an exact             ||
+||    evaluation.                                                            ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airTaylorCache.cpp                                                     ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTaylorCache.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_TAYLOR_CACHE_H
+#define _GH_DEF_AIR_TAYLOR_CACHE_H
+
+#include "air.h"
+
+/**
+ *  @class AirTaylorCache Answers property lookups near a stored exact
+ *         state with a Taylor expansion in pressure and temperature.
+*/
+class AirTaylorCache
+{
+  public:
+    /******************************************************
+    **           Constructors / Destructors              **
+    ******************************************************/
+
+    /** Default constructor (second order, 1E-6 relative tolerance).  */
+    AirTaylorCache();
+
+    /** Copy constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created from the copied values.
+     *  @param copyFrom An AirTaylorCache object whose values are copied.
+     *  @return none.
+    */
+    AirTaylorCache (const AirTaylorCache &copyFrom);
+
+    /** Initialization constructor.
+     *
+     *  @pre none.
+     *  @post A new object is created with an empty anchor.
+     *  @param tolerance The largest estimated relative error of the
+     *         expanded curve fit properties that is accepted.
+     *  @param order The order of the Taylor expansion (1 or 2).
+    */
+    AirTaylorCache (double tolerance, uint32 order = 2);
+
+    /** Default destructor.  */
+    ~AirTaylorCache();
+
+    /******************************************************
+    **               Accessors / Mutators                **
+    ******************************************************/
+
+    ////////////////////
+    //    Getters
+    ////////////////////
+
+    /** Retrieve the accepted relative error of the expansion.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _tolerance [-dimensionless-].
+    */
+    double getTolerance (void) const;
+
+    /** Retrieve the order of the Taylor expansion.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _order (1 or 2).
+    */
+    uint32 getOrder (void) const;
+
+    /** Retrieve the number of queries answered by the expansion.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _hits.
+    */
+    uint64 getHits (void) const;
+
+    /** Retrieve the number of anchors whose derivatives were
+     *  evaluated.
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _refreshes.
+    */
+    uint64 getRefreshes (void) const;
+
+    /** Retrieve the number of queries evaluated exactly by Air (misses,
+     *  T <= 500 K, and out of range).
+     *
+     *  @pre The object is instantiated.
+     *  @post none.
+     *  @return The value of _bypasses.
+    */
+    uint64 getBypasses (void) const;
+
+    ////////////////////
+    //    Setters
+    ////////////////////
+
+    /** Set the accepted relative error of the expansion.
+     *
+     *  @pre The object is instantiated.
+     *  @post _tolerance is updated; the anchor is kept.
+     *  @param tolerance The accepted relative error [-dimensionless-].
+     *  @return none.
+    */
+    void setTolerance (double tolerance);
+
+    /** Set the order of the Taylor expansion.
+     *
+     *  @pre The object is instantiated.
+     *  @post _order is updated (clamped to 1 or 2).
+     *  @param order The order of the expansion.
+     *  @return none.
+    */
+    void setOrder (uint32 order);
+
+    /** Discard the anchor state and zero the hit counters.
+     *
+     *  @pre The object is instantiated.
+     *  @post The next query performs an exact evaluation.
+     *  @return none.
+    */
+    void reset (void);
+
+    /** Calculate the properties of air at the given pressure and
+     *  temperature, expanding about the anchor state when possible.
+     *
+     *  Every exact evaluation becomes the new anchor, but its
+     *  derivatives are only evaluated once a later query uses the
+     *  same curve fit rows, so on incoherent inputs a miss costs the
+     *  exact evaluation and a copy of the state.  After _MISS_STREAK
+     *  consecutive misses only every _MISS_STREAK-th anchor has its
+     *  derivatives evaluated.
+     *
+     *  The tolerance bounds the estimated error of the five curve fit
+     *  properties (enthalpy, specific heat, thermal conductivity,
+     *  viscosity, compressibility factor).  The derived properties
+     *  inherit their error: density, which goes with the square of the
+     *  compressibility factor, reaches about twice the tolerance, and
+     *  gamma and the speed of sound amplify the specific heat error
+     *  where it approaches the gas constant.
+     *
+     *  @pre The object is instantiated.
+     *  @post The properties are stored in state.  When the expansion
+     *        is rejected, the exact state becomes the new anchor.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param state The Air object which receives the properties.
+     *  @return true The calculation was performed successfully.
+     *  @return false The calculation could not be performed.
+    */
+    bool calculateProperties (double pressure, double temperature,
+                              Air &state);
+
+  private:
+    /******************************************************
+    **                     Members                       **
+    ******************************************************/
+
+    // Number of curve fit (primary) properties carried by the expansion:
+    //    enthalpy, specific heat, thermal cond., viscosity, comp. factor
+    static const uint32 _NUM_PRIMARY = 5;
+
+    // Consecutive misses after which only every _MISS_STREAK-th anchor
+    // has its derivatives evaluated (incoherent inputs).
+    static const uint32 _MISS_STREAK = 8;
+
+    Air _anchor;         // The exact state that is expanded about.
+    Air::Rows _rows;     // The curve fit rows of the anchor.
+    bool _valid,         // Whether _anchor holds a usable state.
+         _expanded;      // Whether the derivatives below are _anchor's.
+
+    double _tolerance;   // Accepted relative error [-dimensionless-]
+    uint32 _order;       // Order of the expansion (1 or 2).
+
+    uint64 _hits,        // Queries answered by the expansion.
+           _refreshes,   // Anchors whose derivatives were evaluated.
+           _bypasses;    // Queries evaluated exactly.
+    uint32 _misses;      // Consecutive exact evaluations.
+
+    // Anchor values and (P, T) derivatives of each primary property.
+    // The third derivatives are only used to estimate the error.
+    // Units follow the Air accessors; pressure derivatives are per MPa.
+    double _phi[_NUM_PRIMARY],
+           _phi_P[_NUM_PRIMARY],
+           _phi_T[_NUM_PRIMARY],
+           _phi_PP[_NUM_PRIMARY],
+           _phi_PT[_NUM_PRIMARY],
+           _phi_TT[_NUM_PRIMARY],
+           _phi_PPP[_NUM_PRIMARY],
+           _phi_PPT[_NUM_PRIMARY],
+           _phi_PTT[_NUM_PRIMARY],
+           _phi_TTT[_NUM_PRIMARY];
+
+    /******************************************************
+    **                 Helper Methods                    **
+    ******************************************************/
+
+    /** Expand the anchor state to the given state.
+     *
+     *  @pre _expanded is true and the state uses the rows of the anchor.
+     *  @post When the expansion is accepted, its properties are stored
+     *        in state; otherwise state is unchanged.
+     *  @param pressure The air pressure of the state (in MPa).
+     *  @param temperature The air temperature of the state (in K).
+     *  @param state The Air object which receives the properties.
+     *  @return true The estimated error is inside the tolerance.
+     *  @return false The expansion was rejected.
+    */
+    bool _expand (double pressure, double temperature, Air &state) const;
+
+    /** Evaluate the derivatives of the anchor state.
+     *
+     *  @pre _anchor holds the properties calculated at a valid pressure
+     *       and a temperature above 500 K, and _rows holds its rows.
+     *  @post The derivatives are updated and _expanded is true.
+     *  @return none.
+    */
+    void _setDerivatives (void);
+
+};  // end class AirTaylorCache
+
+#endif
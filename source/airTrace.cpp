@@ -0,0 +1,897 @@
+/******************************************************************************
+||  airTrace.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Input trace capture for the equilibrium air ADT.  Every                ||
+||    calculateProperties and calculateProps_PH call (and optionally its     ||
+||    results) is copied into a per-thread chunk; a background thread        ||
+||    encodes full chunks with XOR compression of each field against its    ||
+||    previous value and appends them to the trace file.  AirTraceReader    ||
+||    decodes a trace for offline replay.                                    ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airTrace.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTrace.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airTrace.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#ifdef AIR_ENABLE_TRACE
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+// Trace file magic number.
+static const char MAGIC[8] = { 'A', 'I', 'R', 'T', 'R', 'A', 'C', 'E' };
+
+// XOR state slots of a chunk: pressure, temperature, enthalpy, outputs.
+static const uint32 SLOT_PRESSURE = 0,
+                    SLOT_INPUT = 1,   // + kind
+                    SLOT_OUTPUT = 3,
+                    NUM_SLOTS = 3 + AirTrace::NUM_OUTPUTS;
+
+// Record tag bits.
+static const unsigned char TAG_PH = 1,
+                           TAG_VALID = 2,
+                           TAG_OUTPUTS = 4;
+
+// Largest chunk accepted by the reader [units: bytes].
+static const uint32 MAX_CHUNK = 1u << 26;
+
+/******************************************************
+**                 Value Encoding                    **
+******************************************************/
+
+/** Append a value unencoded, in native byte order.
+ *
+ *  @pre out has room for 8 bytes.
+ *  @post none.
+ *  @param out The next free byte.
+ *  @param value The value to be copied.
+ *  @return The next free byte after the value.
+*/
+static inline unsigned char * putRaw (unsigned char *out, double value)
+{
+    memcpy(out, &value, sizeof(value));
+    return out + sizeof(value);
+}
+
+/** XOR a value with the previous value of its field and append it.
+ *
+ *  @pre out has room for 9 bytes.
+ *  @post previous holds the bits of value.
+ *  @param out The next free byte.
+ *  @param previous The previous bits of the field.
+ *  @param value The value to be encoded.
+ *  @return The next free byte after the value.
+*/
+static inline unsigned char * putValue (unsigned char *out,
+                                        uint64 &previous, double value)
+{
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint64 x = bits ^ previous;
+    previous = bits;
+
+    if (!x)
+    {
+        *out++ = 0;
+        return out;
+    }
+
+    // Whole zero bytes at either end, found by halving (x is not
+    // zero, so lead + trail <= 7).
+    uint32 lead = 0,
+           trail = 0;
+    uint64 high = x,
+           low = x;
+
+    for (uint32 width = 32; width >= 8; width /= 2)
+    {
+        if (!(high >> (64 - width)))
+        {
+            lead += width / 8;
+            high <<= width;
+        }
+
+        if (!(low << (64 - width)))
+        {
+            trail += width / 8;
+            low >>= width;
+        }
+    }
+
+    *out++ = (unsigned char)(0x80 | (lead << 3) | trail);
+
+    // All 8 bytes are stored (there is room for them) and the unused
+    // ones are overwritten by the next value; the fixed stores merge
+    // into one.
+    for (uint32 i = 0; i < 8; ++i)
+        out[i] = (unsigned char)(low >> (8 * i));
+
+    return out + (8 - lead - trail);
+}
+
+/** Decode a value encoded by putValue.
+ *
+ *  @pre none.
+ *  @post in advances past the value; previous holds its bits.
+ *  @param in The next byte to be read.
+ *  @param end The end of the chunk data.
+ *  @param previous The previous bits of the field.
+ *  @param value The decoded value.
+ *  @return true The value was decoded.
+ *  @return false The data is corrupt.
+*/
+static bool getValue (const unsigned char *&in, const unsigned char *end,
+                      uint64 &previous, double &value)
+{
+    if (in >= end)
+        return false;
+
+    unsigned char head = *in++;
+    uint64 x = 0;
+
+    if (head)
+    {
+        uint32 lead = (head >> 3) & 7,
+               trail = head & 7,
+               n = 8 - lead - trail;
+
+        if (!(head & 0x80) || (lead + trail > 7) || (n > size_t(end - in)))
+            return false;
+
+        for (uint32 i = 0; i < n; ++i)
+            x |= uint64(*in++) << (8 * (trail + i));
+    }
+
+    previous ^= x;
+    memcpy(&value, &previous, sizeof(value));
+
+    return true;
+}
+
+/******************************************************
+**                 Trace Session                     **
+******************************************************/
+
+std::atomic<bool> AirTrace::_recording(false);
+thread_local uint32 AirTrace::_depth = 0;
+thread_local AirTrace::Writer *AirTrace::_writer = NULL;
+
+/**
+ *  @struct AirTrace::Chunk Unencoded records of one thread: the tag
+ *          byte, then the values in native byte order.
+*/
+struct AirTrace::Chunk
+{
+    uint32 thread,                  // Writer number
+           records,                 // Records in data
+           bytes;                   // Used bytes of data
+    unsigned char data[CHUNK_BYTES];
+};
+
+/**
+ *  @struct AirTrace::Writer The chunk being filled by one thread.
+*/
+struct AirTrace::Writer
+{
+    uint32 thread;                  // Writer number
+    Chunk *chunk;                   // NULL until the first record
+};
+
+#ifdef AIR_ENABLE_TRACE
+
+/**
+ *  @struct Session The open trace file and its background writer.
+ *          Every member is guarded by lock.
+*/
+struct Session
+{
+    std::mutex lock;
+    std::condition_variable wake;               // New chunk or closing
+    std::deque<AirTrace::Chunk *> pending;      // Chunks to be written
+    std::vector<AirTrace::Chunk *> spare;       // Written chunks
+    std::vector<AirTrace::Writer *> writers;    // Writers of live threads
+    std::thread flusher;                        // The background writer
+    FILE *file;                                 // NULL: no trace
+    bool closing,                               // stop() is draining
+         failed;                                // A write failed
+    uint32 threads;                             // Writers created
+    uint64 records,                             // Records written
+           bytes;                               // Data bytes written
+
+    Session() : file(NULL), closing(false), failed(false), threads(0),
+                records(0), bytes(0)  {  }
+};
+
+// Reached through a function so that it is constructed before the
+// first writer is attached, whatever the static initialization order of
+// the program is.
+static Session & session (void)
+{
+    static Session trace;
+    return trace;
+}
+
+// Whether the valid records carry their outputs.
+static std::atomic<bool> recordOutputs(false);
+
+/** Queue the chunk of a writer (or recycle it when it is empty).
+ *
+ *  @pre The session lock is held.
+ *  @post writer.chunk is NULL.
+ *  @param trace The session.
+ *  @param writer The writer of interest.
+ *  @return none.
+*/
+static void submitChunk (Session &trace, AirTrace::Writer &writer)
+{
+    if (!writer.chunk)
+        return;
+
+    if (writer.chunk->records && trace.file)
+    {
+        trace.pending.push_back(writer.chunk);
+        trace.wake.notify_one();
+    }
+    else
+        trace.spare.push_back(writer.chunk);
+
+    writer.chunk = NULL;
+
+    return;
+}
+
+/** Queue the chunk of a writer and give it an empty one.
+ *
+ *  @pre none.
+ *  @post writer.chunk is empty.
+ *  @param writer The writer of the calling thread.
+ *  @return The new chunk.
+*/
+static AirTrace::Chunk * swapChunk (AirTrace::Writer &writer)
+{
+    Session &trace = session();
+    std::lock_guard<std::mutex> guard(trace.lock);
+
+    submitChunk(trace, writer);
+
+    AirTrace::Chunk *chunk;
+
+    if (trace.spare.empty())
+        chunk = new AirTrace::Chunk;
+    else
+    {
+        chunk = trace.spare.back();
+        trace.spare.pop_back();
+    }
+
+    chunk->thread = writer.thread;
+    chunk->records = 0;
+    chunk->bytes = 0;
+
+    writer.chunk = chunk;
+
+    return chunk;
+}
+
+/** Encode the records of a chunk.  Every chunk starts with a cleared
+ *  XOR state, so that it decodes on its own.
+ *
+ *  @pre encoded has room for chunk.records * AirTrace::MAX_RECORD
+ *       bytes.
+ *  @post none.
+ *  @param chunk The unencoded records.
+ *  @param encoded The destination.
+ *  @return The number of encoded bytes.
+*/
+static uint32 encodeChunk (const AirTrace::Chunk &chunk,
+                           unsigned char *encoded)
+{
+    uint64 previous[NUM_SLOTS] = { 0 };
+
+    const unsigned char *in = chunk.data;
+    unsigned char *out = encoded;
+
+    for (uint32 r = 0; r < chunk.records; ++r)
+    {
+        unsigned char tag = *in++;
+        uint32 kind = (tag & TAG_PH) ? AirTrace::KIND_PH : AirTrace::KIND_PT,
+               values = (tag & TAG_OUTPUTS) ? 2 + AirTrace::NUM_OUTPUTS : 2;
+
+        *out++ = tag;
+
+        for (uint32 v = 0; v < values; ++v, in += sizeof(double))
+        {
+            uint32 slot = (v == 0) ? SLOT_PRESSURE
+                        : (v == 1) ? SLOT_INPUT + kind
+                        :            SLOT_OUTPUT + (v - 2);
+            double value;
+
+            memcpy(&value, in, sizeof(value));
+            out = putValue(out, previous[slot], value);
+        }
+    }
+
+    return uint32(out - encoded);
+}
+
+/** Append the queued chunks to the trace file until stop() has drained
+ *  the queue (the body of the background writer).
+ *
+ *  @pre The trace file is open.
+ *  @post The queue is empty and closing is set.
+ *  @return none.
+*/
+static void flushChunks (void)
+{
+    Session &trace = session();
+    std::vector<unsigned char> encoded;
+    std::unique_lock<std::mutex> guard(trace.lock);
+
+    for (;;)
+    {
+        while (trace.pending.empty() && !trace.closing)
+            trace.wake.wait(guard);
+
+        if (trace.pending.empty())
+            break;
+
+        AirTrace::Chunk *chunk = trace.pending.front();
+        trace.pending.pop_front();
+
+        // The chunk belongs to this thread until it is recycled.
+        guard.unlock();
+
+        encoded.resize(size_t(chunk->records) * AirTrace::MAX_RECORD);
+
+        uint32 bytes = encodeChunk(*chunk, encoded.data()),
+               header[3] = { chunk->thread, chunk->records, bytes };
+
+        bool written =
+               (fwrite(header, sizeof(header), 1, trace.file) == 1)
+            && (fwrite(encoded.data(), 1, bytes, trace.file) == bytes);
+
+        guard.lock();
+
+        if (written)
+        {
+            trace.records += chunk->records;
+            trace.bytes += bytes;
+        }
+        else
+            trace.failed = true;
+
+        trace.spare.push_back(chunk);
+    }
+
+    return;
+}
+
+/**
+ *  @class WriterOwner Queues the last chunk of a thread and releases its
+ *         writer when the thread exits.
+*/
+class WriterOwner
+{
+  public:
+    AirTrace::Writer *writer;
+
+    WriterOwner() : writer(NULL)  {  }
+
+    ~WriterOwner()
+    {
+        if (!writer)
+            return;
+
+        Session &trace = session();
+        std::lock_guard<std::mutex> guard(trace.lock);
+        std::vector<AirTrace::Writer *> &writers = trace.writers;
+
+        submitChunk(trace, *writer);
+
+        for (size_t i = 0; i < writers.size(); ++i)
+        {
+            if (writers[i] == writer)
+            {
+                writers.erase(writers.begin() + i);
+                break;
+            }
+        }
+
+        delete writer;
+    }
+};
+
+static thread_local WriterOwner owner;
+
+/** Stop the trace that is still being recorded at exit, so that the
+ *  background writer is joined before the session is destroyed.  */
+static void stopAtExit (void)
+{
+    AirTrace::stop();
+    return;
+}
+
+/**
+ *  @struct EnvironmentStart Starts recording at program start when the
+ *          environment variable AIR_TRACE names a trace file.
+*/
+static struct EnvironmentStart
+{
+    EnvironmentStart()
+    {
+        const char *path = getenv("AIR_TRACE"),
+                   *outputs = getenv("AIR_TRACE_OUTPUTS");
+
+        if (!path || !*path)
+            return;
+
+        if (!AirTrace::start(path, outputs && atoi(outputs)))
+            fprintf(stderr, "AirTrace: cannot record to %s\n", path);
+    }
+} environmentStart;
+
+#endif
+
+/******************************************************
+**                 Public Methods                    **
+******************************************************/
+
+/** Determine whether the recording hooks were compiled in.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return true The library was built with AIR_ENABLE_TRACE.
+*/
+bool AirTrace::enabled (void)
+{
+#ifdef AIR_ENABLE_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Start recording to a new trace file.
+ *
+ *  @pre No trace is being recorded.
+ *  @post The calls of every thread are recorded until stop().
+ *  @param path The trace file (truncated).
+ *  @param outputs Whether the results of the valid calls are
+ *         recorded as well.
+ *  @return true Recording has started.
+ *  @return false The file could not be created, a trace is already
+ *          being recorded, or the hooks are not compiled in.
+*/
+bool AirTrace::start (const char *path, bool outputs)
+{
+#ifdef AIR_ENABLE_TRACE
+    Session &trace = session();
+    std::lock_guard<std::mutex> guard(trace.lock);
+
+    if (trace.file)
+        return false;
+
+    FILE *file = fopen(path, "wb");
+
+    if (!file)
+        return false;
+
+    uint32 header[2] = { VERSION, outputs ? FLAG_OUTPUTS : 0 };
+
+    if (   (fwrite(MAGIC, sizeof(MAGIC), 1, file) != 1)
+        || (fwrite(header, sizeof(header), 1, file) != 1))
+    {
+        fclose(file);
+        return false;
+    }
+
+    trace.file = file;
+    trace.closing = false;
+    trace.failed = false;
+    trace.records = 0;
+    trace.bytes = 0;
+    trace.flusher = std::thread(flushChunks);
+
+    // The session is constructed before the handler is registered, so
+    // the handler runs before the session is destroyed.
+    static bool atExit = false;
+
+    if (!atExit)
+        atExit = !atexit(stopAtExit);
+
+    recordOutputs.store(outputs, std::memory_order_relaxed);
+    _recording.store(true, std::memory_order_release);
+
+    return true;
+#else
+    (void)path;
+    (void)outputs;
+
+    return false;
+#endif
+}
+
+/** Stop recording, write the buffered records, and close the file.
+ *
+ *  @pre No thread is inside an Air call (the buffers of the live
+ *       threads are drained).
+ *  @post The trace file is complete and closed.
+ *  @return true Every chunk was written.
+ *  @return false No trace was open or a write failed.
+*/
+bool AirTrace::stop (void)
+{
+#ifdef AIR_ENABLE_TRACE
+    Session &trace = session();
+
+    {
+        std::lock_guard<std::mutex> guard(trace.lock);
+
+        if (!trace.file || trace.closing)
+            return false;
+
+        _recording.store(false, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < trace.writers.size(); ++i)
+            submitChunk(trace, *trace.writers[i]);
+
+        trace.closing = true;
+        trace.wake.notify_one();
+    }
+
+    trace.flusher.join();
+
+    std::lock_guard<std::mutex> guard(trace.lock);
+
+    bool written = !trace.failed;
+
+    if (fclose(trace.file))
+        written = false;
+
+    trace.file = NULL;
+    trace.closing = false;
+
+    for (size_t i = 0; i < trace.spare.size(); ++i)
+        delete trace.spare[i];
+
+    trace.spare.clear();
+
+    return written;
+#else
+    return false;
+#endif
+}
+
+/** Retrieve the number of records and encoded bytes of the current
+ *  (or last) trace that have been written to the file.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The count.
+*/
+uint64 AirTrace::getRecords (void)
+{
+#ifdef AIR_ENABLE_TRACE
+    Session &trace = session();
+    std::lock_guard<std::mutex> guard(trace.lock);
+
+    return trace.records;
+#else
+    return 0;
+#endif
+}
+
+uint64 AirTrace::getBytes (void)
+{
+#ifdef AIR_ENABLE_TRACE
+    Session &trace = session();
+    std::lock_guard<std::mutex> guard(trace.lock);
+
+    return trace.bytes;
+#else
+    return 0;
+#endif
+}
+
+/******************************************************
+**                 Helper Methods                    **
+******************************************************/
+
+/** Copy one call into the chunk of the calling thread.
+ *
+ *  @pre A trace is being recorded.
+ *  @post The record is appended; a full chunk is queued for the
+ *        background writer first.
+ *  @return none.
+*/
+void AirTrace::_record (uint32 kind, double pressure, double input,
+                        const Air &state, bool valid)
+{
+#ifdef AIR_ENABLE_TRACE
+    if (!_writer)
+    {
+        Writer *writer = new Writer;
+        writer->chunk = NULL;
+
+        Session &trace = session();
+        std::lock_guard<std::mutex> guard(trace.lock);
+
+        writer->thread = trace.threads++;
+        trace.writers.push_back(writer);
+
+        owner.writer = writer;
+        _writer = writer;
+    }
+
+    Writer &writer = *_writer;
+    Chunk *chunk = writer.chunk;
+
+    if (!chunk || (chunk->bytes + RAW_RECORD > CHUNK_BYTES))
+        chunk = swapChunk(writer);
+
+    bool outputs = valid && recordOutputs.load(std::memory_order_relaxed);
+
+    unsigned char *out = chunk->data + chunk->bytes;
+
+    *out++ = (unsigned char)((kind == KIND_PH ? TAG_PH : 0)
+                             | (valid ? TAG_VALID : 0)
+                             | (outputs ? TAG_OUTPUTS : 0));
+
+    // The background writer encodes the values (encodeChunk).  They
+    // are stored one at a time: a fixed-size memcpy is a single move,
+    // a variable one is a call.
+    out = putRaw(out, pressure);
+    out = putRaw(out, input);
+
+    if (outputs)
+    {
+        out = putRaw(out, state.getTemperature());
+        out = putRaw(out, state.getEnthalpy());
+        out = putRaw(out, state.getSpecificHeat());
+        out = putRaw(out, state.getThermalConductivity());
+        out = putRaw(out, state.getDynamicViscosity());
+        out = putRaw(out, state.getCompressibilityFactor());
+    }
+
+    chunk->bytes = uint32(out - chunk->data);
+    ++chunk->records;
+#else
+    (void)kind;
+    (void)pressure;
+    (void)input;
+    (void)state;
+    (void)valid;
+#endif
+
+    return;
+}
+
+/******************************************************
+**              AirTraceReader Methods               **
+******************************************************/
+
+/** Default constructor (no file).  */
+AirTraceReader::AirTraceReader()
+  : _file(NULL), _flags(0), _chunks(0), _position(0), _remaining(0)
+{
+    _error[0] = '\0';
+}
+
+/** Default destructor (closes the file).  */
+AirTraceReader::~AirTraceReader()
+{
+    if (_file)
+        fclose(_file);
+}
+
+/** Open a trace and read its header.
+ *
+ *  @pre none.
+ *  @post The reader is positioned at the first record.
+ *  @param path The trace file.
+ *  @return true The file is a trace of a supported version.
+ *  @return false The file cannot be read (see getError()).
+*/
+bool AirTraceReader::open (const char *path)
+{
+    if (_file)
+        fclose(_file);
+
+    _flags = 0;
+    _chunks = 0;
+    _remaining = 0;
+    _error[0] = '\0';
+
+    if (!(_file = fopen(path, "rb")))
+    {
+        snprintf(_error, sizeof(_error), "cannot open %s", path);
+        return false;
+    }
+
+    char magic[sizeof(MAGIC)];
+    uint32 header[2];
+
+    if (   (fread(magic, sizeof(magic), 1, _file) != 1)
+        || (fread(header, sizeof(header), 1, _file) != 1)
+        || memcmp(magic, MAGIC, sizeof(MAGIC)))
+    {
+        snprintf(_error, sizeof(_error), "%s is not a trace", path);
+        return false;
+    }
+
+    if (header[0] != AirTrace::VERSION)
+    {
+        snprintf(_error, sizeof(_error), "%s: unsupported version %u",
+                 path, header[0]);
+        return false;
+    }
+
+    _flags = header[1];
+
+    return true;
+}
+
+/** Decode the next record.
+ *
+ *  @pre open() succeeded.
+ *  @post The reader advances by one record.
+ *  @param record The destination.
+ *  @return true A record was decoded.
+ *  @return false The end of the trace, or a corrupt chunk
+ *          (getError() is not empty).
+*/
+bool AirTraceReader::next (AirTrace::Record &record)
+{
+    if (!_file || _error[0])
+        return false;
+
+    while (!_remaining)
+    {
+        if (!_nextChunk())
+            return false;
+    }
+
+    const unsigned char *in = &_data[0] + _position,
+                        *end = &_data[0] + _data.size();
+
+    unsigned char tag = *in++;
+
+    record.kind = (tag & TAG_PH) ? AirTrace::KIND_PH : AirTrace::KIND_PT;
+    record.valid = (tag & TAG_VALID) != 0;
+    record.hasOutputs = (tag & TAG_OUTPUTS) != 0;
+
+    bool decoded =
+           getValue(in, end, _previous[SLOT_PRESSURE], record.pressure)
+        && getValue(in, end, _previous[SLOT_INPUT + record.kind],
+                    record.input);
+
+    for (uint32 o = 0; decoded && record.hasOutputs
+                       && (o < AirTrace::NUM_OUTPUTS); ++o)
+        decoded = getValue(in, end, _previous[SLOT_OUTPUT + o],
+                           record.outputs[o]);
+
+    if (!decoded || (tag & ~(TAG_PH | TAG_VALID | TAG_OUTPUTS)))
+    {
+        snprintf(_error, sizeof(_error), "corrupt record in chunk %llu",
+                 (unsigned long long)_chunks);
+        return false;
+    }
+
+    _position = size_t(in - &_data[0]);
+    --_remaining;
+
+    return true;
+}
+
+/** Retrieve whether the valid records carry their outputs.
+ *
+ *  @pre open() succeeded.
+ *  @post none.
+ *  @return true The trace was recorded with outputs.
+*/
+bool AirTraceReader::hasOutputs (void) const
+{  return (_flags & AirTrace::FLAG_OUTPUTS) != 0;  }
+
+/** Retrieve the number of chunks read so far.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The value of _chunks.
+*/
+uint64 AirTraceReader::getChunks (void) const
+{  return _chunks;  }
+
+/** Retrieve the reason of the last failure.
+ *
+ *  @pre none.
+ *  @post none.
+ *  @return The message ("" if none).
+*/
+const char * AirTraceReader::getError (void) const
+{  return _error;  }
+
+/** Read the next chunk.
+ *
+ *  @pre _remaining is zero.
+ *  @post _data holds the chunk and the XOR state is cleared.
+ *  @return true A chunk was read.
+ *  @return false The end of the file or a read error.
+*/
+bool AirTraceReader::_nextChunk (void)
+{
+    uint32 header[3];
+    size_t got = fread(header, 1, sizeof(header), _file);
+
+    if (!got && feof(_file))
+        return false;
+
+    if ((got != sizeof(header)) || (header[2] > MAX_CHUNK)
+        || (header[1] && !header[2]))
+    {
+        snprintf(_error, sizeof(_error), "truncated chunk %llu",
+                 (unsigned long long)_chunks);
+        return false;
+    }
+
+    _data.resize(header[2]);
+
+    if (header[2] && (fread(&_data[0], 1, header[2], _file) != header[2]))
+    {
+        snprintf(_error, sizeof(_error), "truncated chunk %llu",
+                 (unsigned long long)_chunks);
+        return false;
+    }
+
+    _position = 0;
+    _remaining = header[1];
+    memset(_previous, 0, sizeof(_previous));
+    ++_chunks;
+
+    return true;
+}
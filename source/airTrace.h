@@ -0,0 +1,357 @@
+/******************************************************************************
+||  airTrace.h      (definition file)                                        ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Input trace capture for the equilibrium air ADT.  Every                ||
+||    calculateProperties and calculateProps_PH call (and optionally its     ||
+||    results) is encoded into a per-thread chunk with XOR compression of    ||
+||    each field against its previous value; full chunks are appended to     ||
+||    the trace file by a background thread.  AirTraceReader decodes a       ||
+||    trace for offline replay.                                              ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airTrace.cpp                                                           ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTrace.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_TRACE_H
+#define _GH_DEF_AIR_TRACE_H
+
+#include "air.h"
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+/**
+ *  @class AirTrace Records the inputs (and optionally the outputs) of
+ *         every Air::calculateProperties and Air::calculateProps_PH call
+ *         to a compact binary trace.
+ *
+ *  The calls are only recorded when the library is compiled with
+ *  AIR_ENABLE_TRACE defined (CMake option AIR_ENABLE_TRACE); otherwise
+ *  the AIR_TRACE_* macros expand to nothing and start() fails.  Each
+ *  thread copies its records unencoded into its own chunk buffer; full
+ *  chunks are handed to a background thread that encodes them and
+ *  appends them to the file, so the calling threads neither encode nor
+ *  wait for I/O.
+ *
+ *  Recording is started with start() or, without code changes, by
+ *  setting the environment variable AIR_TRACE to the trace path (and
+ *  AIR_TRACE_OUTPUTS=1 to also record the outputs).  A trace that is
+ *  still being recorded at exit is stopped then.
+ *
+ *  File format (native byte order):
+ *      header:  "AIRTRACE", uint32 version, uint32 flags (FLAG_OUTPUTS)
+ *      chunks:  uint32 thread, uint32 records, uint32 bytes, data
+ *  Every record starts with a tag byte (bit 0: P-H call, bit 1: valid
+ *  result, bit 2: outputs follow), followed by the pressure, the
+ *  temperature or enthalpy, and the outputs.  Each value is XOR-ed
+ *  with the previous value of the same field in the chunk: an
+ *  unchanged value takes one byte, otherwise a byte holding the
+ *  counts of leading and trailing zero bytes precedes the remaining
+ *  bytes.  Chunks decode independently of each other.
+*/
+class AirTrace
+{
+  public:
+    /** The recorded API calls.  */
+    enum Kind
+    {
+        KIND_PT,   // Air::calculateProperties
+        KIND_PH    // Air::calculateProps_PH
+    };
+
+    /** The recorded outputs.  */
+    enum Output
+    {
+        OUT_TEMPERATURE,     // [units: K]
+        OUT_ENTHALPY,        // [units: kJ/kg]
+        OUT_SPECIFIC_HEAT,   // [units: kJ/kg-K]
+        OUT_THERMAL_COND,    // [units: W/m-K]
+        OUT_VISCOSITY,       // [units: kg/m-s]
+        OUT_COMP_FACTOR,     // -dimensionless-
+        NUM_OUTPUTS
+    };
+
+    // Trace format version.
+    static const uint32 VERSION = 1;
+
+    // Header flag: the valid records carry their outputs.
+    static const uint32 FLAG_OUTPUTS = 1;
+
+    // Size of the chunk buffers of the calling threads [units: bytes].
+    static const uint32 CHUNK_BYTES = 65536;
+
+    // Largest unencoded record: the tag, then 8 bytes per value.
+    static const uint32 RAW_RECORD = 1 + 8 * (2 + NUM_OUTPUTS);
+
+    // Largest encoded record: the tag, then 9 bytes per value.
+    static const uint32 MAX_RECORD = 1 + 9 * (2 + NUM_OUTPUTS);
+
+    /**
+     *  @struct Record One decoded API call.
+    */
+    struct Record
+    {
+        uint32 kind;                 // KIND_PT or KIND_PH
+        double pressure,             // [units: MPa]
+               input;                // Temperature [K] or enthalpy [kJ/kg]
+        bool valid,                  // The call returned true
+             hasOutputs;             // outputs holds the results
+        double outputs[NUM_OUTPUTS];
+    };
+
+    struct Chunk;
+    struct Writer;
+
+    /** Determine whether the recording hooks were compiled in.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The library was built with AIR_ENABLE_TRACE.
+    */
+    static bool enabled (void);
+
+    /** Start recording to a new trace file.
+     *
+     *  @pre No trace is being recorded.
+     *  @post The calls of every thread are recorded until stop().
+     *  @param path The trace file (truncated).
+     *  @param outputs Whether the results of the valid calls are
+     *         recorded as well.
+     *  @return true Recording has started.
+     *  @return false The file could not be created, a trace is already
+     *          being recorded, or the hooks are not compiled in.
+    */
+    static bool start (const char *path, bool outputs = false);
+
+    /** Stop recording, write the buffered records, and close the file.
+     *
+     *  @pre No thread is inside an Air call (the buffers of the live
+     *       threads are drained).
+     *  @post The trace file is complete and closed.
+     *  @return true Every chunk was written.
+     *  @return false No trace was open or a write failed.
+    */
+    static bool stop (void);
+
+    /** Determine whether a trace is being recorded.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return true The hooks record the calls.
+    */
+    static bool recording (void)
+    {  return _recording.load(std::memory_order_relaxed);  }
+
+    /** Retrieve the number of records and encoded bytes of the current
+     *  (or last) trace that have been written to the file.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The count.
+    */
+    static uint64 getRecords (void);
+    static uint64 getBytes (void);
+
+    /** Mark the start of a calculateProps_PH call, so that its inner
+     *  calculateProperties call is not recorded on its own.
+     *
+     *  @pre none.
+     *  @post The nesting depth of the calling thread is incremented.
+     *  @return none.
+    */
+    static void enter (void)
+    {  ++_depth;  }
+
+    /** Record a calculateProperties call (unless it is nested in a
+     *  calculateProps_PH call).
+     *
+     *  @pre none.
+     *  @post The call is appended to the chunk of the calling thread.
+     *  @param pressure The input pressure [units: MPa].
+     *  @param temperature The input temperature [units: K].
+     *  @param state The evaluated state.
+     *  @param valid The result of the call.
+     *  @return none.
+    */
+    static void recordPT (double pressure, double temperature,
+                          const Air &state, bool valid)
+    {
+        if (!_depth && recording())
+            _record(KIND_PT, pressure, temperature, state, valid);
+    }
+
+    /** Record a calculateProps_PH call and leave its nesting level.
+     *
+     *  @pre enter() was called by this call.
+     *  @post The call is appended to the chunk of the calling thread.
+     *  @param pressure The input pressure [units: MPa].
+     *  @param enthalpy The input enthalpy [units: kJ/kg].
+     *  @param state The evaluated state.
+     *  @param valid The result of the call.
+     *  @return none.
+    */
+    static void recordPH (double pressure, double enthalpy,
+                          const Air &state, bool valid)
+    {
+        if (!--_depth && recording())
+            _record(KIND_PH, pressure, enthalpy, state, valid);
+    }
+
+  private:
+    // Whether the hooks record (set between start() and stop()).
+    static std::atomic<bool> _recording;
+
+    // calculateProps_PH nesting depth of the calling thread.
+    static thread_local uint32 _depth;
+
+    // The chunk writer of the calling thread (NULL until first use).
+    static thread_local Writer *_writer;
+
+    /** Copy one call into the chunk of the calling thread.
+     *
+     *  @pre A trace is being recorded.
+     *  @post The record is appended; a full chunk is queued for the
+     *        background writer first.
+     *  @return none.
+    */
+    static void _record (uint32 kind, double pressure, double input,
+                         const Air &state, bool valid);
+};
+
+/**
+ *  @class AirTraceReader Decodes the records of a trace file.
+*/
+class AirTraceReader
+{
+  public:
+    /** Default constructor (no file).  */
+    AirTraceReader();
+
+    /** Default destructor (closes the file).  */
+    ~AirTraceReader();
+
+    /** Open a trace and read its header.
+     *
+     *  @pre none.
+     *  @post The reader is positioned at the first record.
+     *  @param path The trace file.
+     *  @return true The file is a trace of a supported version.
+     *  @return false The file cannot be read (see getError()).
+    */
+    bool open (const char *path);
+
+    /** Decode the next record.
+     *
+     *  @pre open() succeeded.
+     *  @post The reader advances by one record.
+     *  @param record The destination.
+     *  @return true A record was decoded.
+     *  @return false The end of the trace, or a corrupt chunk
+     *          (getError() is not empty).
+    */
+    bool next (AirTrace::Record &record);
+
+    /** Retrieve whether the valid records carry their outputs.
+     *
+     *  @pre open() succeeded.
+     *  @post none.
+     *  @return true The trace was recorded with outputs.
+    */
+    bool hasOutputs (void) const;
+
+    /** Retrieve the number of chunks read so far.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The value of _chunks.
+    */
+    uint64 getChunks (void) const;
+
+    /** Retrieve the reason of the last failure.
+     *
+     *  @pre none.
+     *  @post none.
+     *  @return The message ("" if none).
+    */
+    const char * getError (void) const;
+
+  private:
+    FILE *_file;                         // The trace file
+    uint32 _flags;                       // Header flags
+    uint64 _chunks;                      // Chunks read
+    std::vector<unsigned char> _data;    // The current chunk
+    size_t _position;                    // Next byte of _data
+    uint32 _remaining;                   // Records left in _data
+    uint64 _previous[3 + AirTrace::NUM_OUTPUTS];  // XOR state
+    char _error[128];                    // Last failure
+
+    /** Read the next chunk.
+     *
+     *  @pre _remaining is zero.
+     *  @post _data holds the chunk and the XOR state is cleared.
+     *  @return true A chunk was read.
+     *  @return false The end of the file or a read error.
+    */
+    bool _nextChunk (void);
+
+    // Not copyable.
+    AirTraceReader (const AirTraceReader &);
+    AirTraceReader & operator= (const AirTraceReader &);
+};
+
+// The recording hooks of the library.  Without AIR_ENABLE_TRACE they
+// compile to nothing.
+#ifdef AIR_ENABLE_TRACE
+#define AIR_TRACE_ENTER()  AirTrace::enter()
+#define AIR_TRACE_PT(pressure, temperature, state, valid) \
+    AirTrace::recordPT((pressure), (temperature), (state), (valid))
+#define AIR_TRACE_PH(pressure, enthalpy, state, valid) \
+    AirTrace::recordPH((pressure), (enthalpy), (state), (valid))
+#else
+#define AIR_TRACE_ENTER()  ((void)0)
+#define AIR_TRACE_PT(pressure, temperature, state, valid)  ((void)0)
+#define AIR_TRACE_PH(pressure, enthalpy, state, valid)  ((void)0)
+#endif
+
+#endif
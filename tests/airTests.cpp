@@ -0,0 +1,657 @@
+/******************************************************************************
+||  airTests.cpp      (implementation file)                                  ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Pass/fail checks of the equilibrium air ADT, run by ctest: the         ||
+||    save/map round trip and checksum of AirTable, duplicate input          ||
+||    coalescing of AirBatch against plain rows, incremental AirField        ||
+||    updates at zero tolerance against a full evaluation, AirStream         ||
+||    against calculateProperties, the regime schedule of AirBatch against   ||
+||    input order, the outputs of AirDouble against Air, and (when built as  ||
+||    C++20) co_await on AirAsync against AirBatch.  Each check is selected  ||
+||    by name on the command line and exits non-zero on failure.             ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||    airAsync.h                                                             ||
+||    airBatch.h                                                             ||
+||    airField.h                                                             ||
+||    airPrecision.h                                                         ||
+||    airStream.h                                                            ||
+||    airTable.h                                                             ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airTests.cpp
+ *  @date 2026-10-18
+*/
+
+#include "air.h"
+#include "airAsync.h"
+#include "airBatch.h"
+#include "airField.h"
+#include "airPrecision.h"
+#include "airStream.h"
+#include "airTable.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+/******************************************************
+**                  Check Support                    **
+******************************************************/
+
+static uint32 failures = 0;
+
+#define AIR_CHECK(condition)                                              \
+    do                                                                    \
+    {                                                                     \
+        if (!(condition))                                                 \
+        {                                                                 \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__,        \
+                    __LINE__, #condition);                                \
+            ++failures;                                                   \
+        }                                                                 \
+    } while (0)
+
+/** Fill an interleaved array of (pressure, temperature) pairs that
+ *  covers the whole ADT range: log-uniform pressures from 1E-4 to
+ *  100 atm and uniform temperatures from 200 to 29000 K, with every
+ *  eighth state at or below 500 K.
+ *
+ *  @pre none.
+ *  @post states holds 2 * count values.
+ *  @param states The destination vector.
+ *  @param count The number of states.
+ *  @param seed The seed of the pseudo-random generator.
+ *  @return none.
+*/
+static void makeStates (std::vector<double> &states, size_t count,
+                        uint64 seed)
+{
+    states.resize(2 * count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        double u = double(seed >> 11) / 9007199254740992.0;
+
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        double v = double(seed >> 11) / 9007199254740992.0;
+
+        states[2 * i] = 0.101325 * pow(10.0, -4.0 + 6.0 * u);
+        states[2 * i + 1] = (i % 8 == 0) ? 200.0 + 300.0 * v
+                                         : 200.0 + 28800.0 * v;
+    }
+
+    return;
+}
+
+/******************************************************
+**                     Checks                        **
+******************************************************/
+
+/** A saved table maps back to the same image and the same lookups,
+ *  a corrupted data section fails the checksum, and a quantized table
+ *  stays within its error limit.  */
+static void checkTable (void)
+{
+    const char *path = "airTests.table";
+
+    AirTableSpec spec;
+    spec.nP = 11;
+    spec.nT = 120;
+
+    AirTable table;
+    AIR_CHECK(table.generate(spec));
+    AIR_CHECK(table.save(path));
+
+    AirTable mapped;
+    AIR_CHECK(mapped.map(path));
+    AIR_CHECK(mapped.isMapped());
+    AIR_CHECK(mapped.getBytes() == table.getBytes());
+    AIR_CHECK(!memcmp(mapped.getImage(), table.getImage(),
+                      table.getBytes()));
+
+    std::vector<double> states;
+    makeStates(states, 1000, 1);
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        double expected[AirTable::NUM_PROPERTIES],
+               actual[AirTable::NUM_PROPERTIES];
+
+        bool inside = table.lookup(states[2 * i], states[2 * i + 1],
+                                   expected);
+
+        AIR_CHECK(mapped.lookup(states[2 * i], states[2 * i + 1], actual)
+                  == inside);
+
+        if (inside)
+            AIR_CHECK(!memcmp(expected, actual, sizeof(expected)));
+    }
+
+    mapped.reset();
+
+    // Flip one bit of the last column.
+    FILE *file = fopen(path, "r+b");
+    AIR_CHECK(file != NULL);
+
+    if (file)
+    {
+        long offset = long(table.getBytes()) - 8;
+        unsigned char byte = 0;
+
+        AIR_CHECK(!fseek(file, offset, SEEK_SET));
+        AIR_CHECK(fread(&byte, 1, 1, file) == 1);
+        byte ^= 1;
+        AIR_CHECK(!fseek(file, offset, SEEK_SET));
+        AIR_CHECK(fwrite(&byte, 1, 1, file) == 1);
+        fclose(file);
+    }
+
+    AIR_CHECK(!mapped.map(path));
+    AIR_CHECK(mapped.map(path, false));
+
+    mapped.reset();
+    remove(path);
+
+    // A quantized table keeps every column within the error limit: the
+    // columns that do not fit stay doubles, equal to the double table.
+    AirTableSpec quantizedSpec = spec;
+    quantizedSpec.encoding = AirTable::ENCODING_Q16;
+
+    AirTable quantized,
+             attached;
+    AIR_CHECK(quantized.generate(quantizedSpec));
+    AIR_CHECK(attached.attach(quantized.getImage(), quantized.getBytes(),
+                              true));
+
+    size_t values = size_t(spec.nP) * spec.nT;
+
+    for (uint32 p = 0; p < AirTable::NUM_PROPERTIES; ++p)
+    {
+        const double *column = attached.getColumn(p);
+
+        AIR_CHECK(attached.getQuantizationError(p)
+                  <= quantizedSpec.maxQuantError);
+
+        if (column)
+            AIR_CHECK(!memcmp(column, table.getColumn(p),
+                              values * sizeof(double)));
+    }
+
+    return;
+}
+
+/** Coalesced batches give the rows of the plain batch, bit for bit.  */
+static void checkCoalesce (void)
+{
+    const size_t count = 20000;
+
+    std::vector<double> distinct, states(2 * count);
+    makeStates(distinct, 1000, 2);
+
+    // Runs of equal pairs and scattered repeats of the distinct pairs.
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t source = (i < count / 2) ? (i / 16) % 1000
+                                        : (i * 7919) % 1000;
+
+        states[2 * i] = distinct[2 * source];
+        states[2 * i + 1] = distinct[2 * source + 1];
+    }
+
+    AirBatch plain, coalesced;
+    size_t columns = plain.getNumColumns();
+
+    std::vector<double> expected(count * columns), actual(count * columns);
+    std::vector<unsigned char> expectedValid(count), actualValid(count);
+
+    size_t evaluated = plain.evaluate(AirBatch::INPUT_PT, &states[0],
+                                      count, &expected[0],
+                                      &expectedValid[0]);
+
+    AIR_CHECK(coalesced.setCoalesce(AirBatch::COALESCE_EXACT));
+    AIR_CHECK(coalesced.evaluate(AirBatch::INPUT_PT, &states[0], count,
+                                 &actual[0], &actualValid[0])
+              == evaluated);
+    AIR_CHECK(!memcmp(&expected[0], &actual[0],
+                      expected.size() * sizeof(double)));
+    AIR_CHECK(expectedValid == actualValid);
+
+    // A quantum far below the spacing of the distinct pairs only
+    // merges exact duplicates.
+    AIR_CHECK(coalesced.setCoalesce(AirBatch::COALESCE_QUANTIZED, 1E-12));
+    AIR_CHECK(coalesced.evaluate(AirBatch::INPUT_PT, &states[0], count,
+                                 &actual[0], &actualValid[0])
+              == evaluated);
+    AIR_CHECK(!memcmp(&expected[0], &actual[0],
+                      expected.size() * sizeof(double)));
+
+    // Chunked calls down to a few states.
+    AIR_CHECK(coalesced.setCoalesce(AirBatch::COALESCE_EXACT));
+
+    for (size_t first = 0; first < count; first += 5)
+    {
+        size_t n = (count - first < 5) ? (count - first) : 5;
+
+        coalesced.evaluate(AirBatch::INPUT_PT, &states[2 * first], n,
+                           &actual[first * columns]);
+    }
+
+    AIR_CHECK(!memcmp(&expected[0], &actual[0],
+                      expected.size() * sizeof(double)));
+
+    return;
+}
+
+/** Incremental updates at zero tolerance reproduce a full evaluation
+ *  of the current inputs, bit for bit.  */
+static void checkField (void)
+{
+    const size_t cells = 5000;
+
+    std::vector<double> states;
+    makeStates(states, cells, 3);
+
+    AirField field(cells);
+    AIR_CHECK(field.setColumns("density,enthalpy,viscosity,gamma"));
+    field.setInputs(&states[0]);
+    AIR_CHECK(field.update() == cells);
+
+    AirBatch batch(field.getBatch());
+    uint32 columns = batch.getNumColumns();
+    std::vector<double> rows(cells * columns);
+
+    for (uint32 step = 0; step < 5; ++step)
+    {
+        // Move every tenth cell, some of them by one ulp.
+        for (size_t i = step; i < cells; i += 10)
+        {
+            if (i % 20 == step)
+                states[2 * i + 1] = nextafter(states[2 * i + 1], 1E9);
+            else
+                states[2 * i] *= 1.001;
+        }
+
+        field.setInputs(&states[0]);
+        AIR_CHECK(field.update() == (cells - step + 9) / 10);
+
+        batch.evaluate(AirBatch::INPUT_PT, &states[0], cells, &rows[0]);
+
+        for (uint32 c = 0; c < columns; ++c)
+        {
+            const double *column = field.getColumn(c);
+
+            for (size_t i = 0; i < cells; ++i)
+                AIR_CHECK(!memcmp(&column[i], &rows[i * columns + c],
+                                  sizeof(double)));
+        }
+    }
+
+    // Nothing moved.
+    AIR_CHECK(field.update() == 0);
+
+    return;
+}
+
+/** AirStream gives the results of calculateProperties, bit for bit,
+ *  on coherent and on scattered inputs.  */
+static void checkStream (void)
+{
+    std::vector<double> scattered;
+    makeStates(scattered, 20000, 4);
+
+    // A coherent sweep that crosses the pressure contours, the
+    // breakpoints, and the 500 K shortcut.
+    std::vector<double> coherent;
+
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        coherent.push_back(0.101325 * pow(10.0, -4.0 + 6.0 * i / 19999.0));
+        coherent.push_back(300.0 + 28000.0 * ((i * 37) % 20000) / 20000.0);
+    }
+
+    // The contours themselves.
+    for (int e = -4; e <= 2; ++e)
+    {
+        coherent.push_back(0.101325 * pow(10.0, e));
+        coherent.push_back(6000.0);
+    }
+
+    const std::vector<double> *inputs[2] = { &scattered, &coherent };
+
+    for (uint32 n = 0; n < 2; ++n)
+    {
+        const std::vector<double> &states = *inputs[n];
+
+        AirStream stream;
+        Air expected, actual;
+
+        for (size_t i = 0; i < states.size() / 2; ++i)
+        {
+            bool valid = expected.calculateProperties(states[2 * i],
+                                                      states[2 * i + 1]);
+
+            AIR_CHECK(stream.calculateProperties(states[2 * i],
+                                                 states[2 * i + 1],
+                                                 actual) == valid);
+            AIR_CHECK(!memcmp(&expected, &actual, sizeof(Air)));
+        }
+
+        AIR_CHECK(stream.getHits() + stream.getRefreshes() > 0);
+    }
+
+    return;
+}
+
+/** The regime schedule gives the rows of the input order, bit for
+ *  bit, whether a block is sorted (scattered inputs) or not (a
+ *  coherent sweep).  */
+static void checkSchedule (void)
+{
+    const size_t count = 20000;
+
+    std::vector<double> scattered;
+    makeStates(scattered, count, 5);
+
+    // Out of range pairs give NaN rows in place.
+    scattered[2 * 17] = -1.0;
+    scattered[2 * 4000 + 1] = 40000.0;
+
+    std::vector<double> coherent;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        coherent.push_back(0.101325 * pow(10.0, -4.0 + 6.0 * i / 19999.0));
+        coherent.push_back(400.0 + 20000.0 * i / 19999.0);
+    }
+
+    const std::vector<double> *inputs[2] = { &scattered, &coherent };
+
+    for (uint32 n = 0; n < 2; ++n)
+    {
+        const std::vector<double> &states = *inputs[n];
+
+        AirBatch plain, scheduled;
+        size_t columns = plain.getNumColumns();
+
+        std::vector<double> expected(count * columns),
+                            actual(count * columns);
+        std::vector<unsigned char> expectedValid(count), actualValid(count);
+
+        size_t evaluated = plain.evaluate(AirBatch::INPUT_PT, &states[0],
+                                          count, &expected[0],
+                                          &expectedValid[0]);
+
+        AIR_CHECK(scheduled.setSchedule(AirBatch::SCHEDULE_REGIME));
+        AIR_CHECK(scheduled.evaluate(AirBatch::INPUT_PT, &states[0], count,
+                                     &actual[0], &actualValid[0])
+                  == evaluated);
+        AIR_CHECK(!memcmp(&expected[0], &actual[0],
+                          expected.size() * sizeof(double)));
+        AIR_CHECK(expectedValid == actualValid);
+    }
+
+    return;
+}
+
+/** AirDouble has every output of Air and agrees with it to rounding
+ *  (the rows are re-expanded, so the results are not bit for bit).  */
+static void checkPrecision (void)
+{
+    const size_t count = 20000;
+
+    std::vector<double> states;
+    makeStates(states, count, 6);
+
+    Air expected;
+    AirDouble actual;
+    double worst = 0.0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        double pressure = states[2 * i],
+               temperature = states[2 * i + 1];
+
+        AIR_CHECK(expected.calculateProperties(pressure, temperature)
+                  == actual.calculateProperties(pressure, temperature));
+
+        const double pairs[][2] =
+        {
+            { expected.getEnthalpy(),       actual.getEnthalpy()       },
+            { expected.getInternalEnergy(), actual.getInternalEnergy() },
+            { expected.getDensity(),        actual.getDensity()        },
+            { expected.getSpecificHeat(),   actual.getSpecificHeat()   },
+            { expected.getGamma(),          actual.getGamma()          },
+            { expected.getThermalConductivity(),
+              actual.getThermalConductivity()                          },
+            { expected.getPrandtlNumber(),  actual.getPrandtlNumber()  },
+            { expected.getDynamicViscosity(),
+              actual.getDynamicViscosity()                             },
+            { expected.getKinematicViscosity(),
+              actual.getKinematicViscosity()                           },
+            { expected.getCompressibilityFactor(),
+              actual.getCompressibilityFactor()                        },
+            { expected.getGasConstant(),    actual.getGasConstant()    },
+            { expected.getMolarMass(),      actual.getMolarMass()      },
+            { expected.getEntropy(),        actual.getEntropy()        },
+            { expected.getSoundSpeed(),     actual.getSoundSpeed()     },
+            { expected.getRefractionIndex(),
+              actual.getRefractionIndex()                              },
+            { expected.getGibbsFreeEnergy(),
+              actual.getGibbsFreeEnergy()                              },
+            { expected.getHelmholtzFreeEnergy(),
+              actual.getHelmholtzFreeEnergy()                          },
+            { expected.getChemicalPotential(),
+              actual.getChemicalPotential()                            },
+            { expected.getSchmidtNumber(),  actual.getSchmidtNumber()  },
+            { expected.getLewisNumber(),    actual.getLewisNumber()    },
+            { expected.getThermalDiffusivity(),
+              actual.getThermalDiffusivity()                           }
+        };
+
+        for (size_t p = 0; p < sizeof(pairs) / sizeof(pairs[0]); ++p)
+        {
+            double error = fabs(pairs[p][1] - pairs[p][0]);
+
+            if (pairs[p][0] != 0.0)
+                error /= fabs(pairs[p][0]);
+
+            if (error > worst)
+                worst = error;
+        }
+    }
+
+    AIR_CHECK(worst < 1E-8);
+
+    return;
+}
+
+#ifdef AIR_ASYNC_COROUTINES
+/**
+ *  @struct CheckTask A coroutine that starts at once and frees itself
+ *          when it returns.
+*/
+struct CheckTask
+{
+    struct promise_type
+    {
+        CheckTask get_return_object (void)
+        {  return CheckTask();  }
+
+        std::suspend_never initial_suspend (void) noexcept
+        {  return std::suspend_never();  }
+
+        std::suspend_never final_suspend (void) noexcept
+        {  return std::suspend_never();  }
+
+        void return_void (void)
+        {  }
+
+        void unhandled_exception (void)
+        {  std::terminate();  }
+    };
+};
+
+/** Evaluate a batch with co_await, then an empty one (which does not
+ *  suspend), and report both counts.
+ *
+ *  @pre The references outlive the coroutine (done is waited for).
+ *  @post values holds the rows; done holds the two counts.
+ *  @return The coroutine.
+*/
+static CheckTask awaitRows (AirAsync &pool, const AirBatch &batch,
+                            const std::vector<double> &states,
+                            std::vector<double> &values,
+                            std::vector<unsigned char> &valid,
+                            std::promise<std::pair<size_t, size_t> > &done)
+{
+    size_t count = states.size() / 2,
+           evaluated = co_await pool.evaluate(batch, AirBatch::INPUT_PT,
+                                              &states[0], count, &values[0],
+                                              &valid[0]),
+           none = co_await pool.evaluate(batch, AirBatch::INPUT_PT,
+                                         &states[0], 0, &values[0]);
+
+    done.set_value(std::make_pair(evaluated, none));
+}
+
+/** co_await on AirAsync resumes with the rows and the count of
+ *  AirBatch, bit for bit.  */
+static void checkCoroutine (void)
+{
+    const size_t count = 20000;
+
+    std::vector<double> states;
+    makeStates(states, count, 7);
+
+    // Out of range pairs give NaN rows in place.
+    states[2 * 23] = -1.0;
+
+    AirBatch batch;
+    size_t columns = batch.getNumColumns();
+
+    std::vector<double> expected(count * columns),
+                        actual(count * columns);
+    std::vector<unsigned char> expectedValid(count), actualValid(count);
+
+    size_t evaluated = batch.evaluate(AirBatch::INPUT_PT, &states[0], count,
+                                      &expected[0], &expectedValid[0]);
+
+    AirAsync pool(2, 1000);
+    std::promise<std::pair<size_t, size_t> > done;
+    std::future<std::pair<size_t, size_t> > counts = done.get_future();
+
+    awaitRows(pool, batch, states, actual, actualValid, done);
+
+    std::pair<size_t, size_t> result = counts.get();
+
+    // The coroutine finishes inside the completion of its submission.
+    pool.wait();
+
+    AIR_CHECK(result.first == evaluated);
+    AIR_CHECK(result.second == 0);
+    AIR_CHECK(!memcmp(&expected[0], &actual[0],
+                      expected.size() * sizeof(double)));
+    AIR_CHECK(expectedValid == actualValid);
+
+    return;
+}
+#endif
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+/**
+ *  @struct TestCase One named check.
+*/
+struct TestCase
+{
+    const char *name;
+    void (*check)(void);
+};
+
+static const TestCase tests[] =
+{
+    { "table",     checkTable     },
+    { "coalesce",  checkCoalesce  },
+    { "field",     checkField     },
+    { "stream",    checkStream    },
+    { "schedule",  checkSchedule  },
+    { "precision", checkPrecision },
+#ifdef AIR_ASYNC_COROUTINES
+    { "coroutine", checkCoroutine }
+#endif
+};
+
+static const uint32 numTests = sizeof(tests) / sizeof(tests[0]);
+
+int main (int argc, char *argv[])
+{
+    uint32 run = 0;
+
+    for (uint32 t = 0; t < numTests; ++t)
+    {
+        bool selected = (argc < 2);
+
+        for (int i = 1; i < argc; ++i)
+            selected = selected || !strcmp(argv[i], tests[t].name);
+
+        if (!selected)
+            continue;
+
+        uint32 before = failures;
+        tests[t].check();
+        ++run;
+
+        fprintf(stderr, "%-10s %s\n", tests[t].name,
+                (failures == before) ? "passed" : "FAILED");
+    }
+
+    if (run == 0)
+    {
+        fprintf(stderr, "usage: %s [check...]\n", argv[0]);
+        return 2;
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,794 @@
+/******************************************************************************
+||  airEval.cpp      (implementation file)                                   ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Streaming command-line evaluator for the equilibrium air ADT.  Rows    ||
+||    of (pressure, temperature) or (pressure, enthalpy) are read as CSV or  ||
+||    raw binary doubles from files or stdin, evaluated in parallel          ||
+||    batches, and written in input order.  A reader thread, a pool of       ||
+||    worker threads, and the writing main thread overlap through a fixed    ||
+||    pool of blocks, so memory stays bounded for inputs of any length.      ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    C++17 (<charconv>)                                                     ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airEval.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/******************************************************
+**                  Configuration                    **
+******************************************************/
+
+enum Format
+{
+    FORMAT_CSV,      // One "P,T" (or "P,h") pair per line
+    FORMAT_BINARY    // Native-endian doubles, two per input record
+};
+
+// Bytes of one binary input record.
+static const size_t RECORD_BYTES = 2 * sizeof(double);
+
+// Longest std::to_chars result of a double plus its separator.
+static const size_t FIELD_CHARS = 25;
+
+/** The command-line options.  */
+struct Options
+{
+    uint32 input;                     // AirBatch::INPUT_PT or INPUT_PH
+    Format inputFormat,
+           outputFormat;
+    AirBatch batch;                   // The output columns
+    uint32 threads;                   // Evaluation threads
+    size_t blockBytes;                // Input bytes per block
+    int precision;                    // Significant digits (0: shortest)
+    bool header,                      // Write a CSV header line
+         stats;                       // Report the throughput on stderr
+    std::vector<const char *> files;  // Inputs ("-" is stdin)
+    const char *output;               // Output file (NULL: stdout)
+};
+
+/******************************************************
+**                     Blocks                        **
+******************************************************/
+
+/** A slice of one input file that ends on a record boundary.  Blocks
+ *  are recycled through the free queue, so the buffers grow to the
+ *  largest slice once and are then reused.  */
+struct Block
+{
+    uint64 sequence;              // Position in the output
+    uint32 file;                  // Index of the input file
+    bool fileStart;               // Whether the slice starts the file
+    std::string input;            // The raw input bytes
+    std::vector<double> states,   // The parsed input pairs
+                        values;   // The evaluated rows
+    std::string output;           // The formatted rows
+    uint64 lines,                 // Input lines in the slice (CSV)
+           rows,                  // Evaluated rows
+           invalid;               // Rows of NaN
+    uint64 errorLine;             // Line of a parse error (0: none)
+    const char *error;            // The parse error (NULL: none)
+};
+
+/** A blocking FIFO of blocks.  Once closed, pop() drains the queue
+ *  and then returns NULL.  */
+class BlockQueue
+{
+  public:
+    BlockQueue() : _closed(false) {}
+
+    void push (Block *block)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _blocks.push_back(block);
+        _ready.notify_one();
+    }
+
+    Block * pop (void)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _ready.wait(lock, [this] { return _closed || !_blocks.empty(); });
+
+        if (_blocks.empty())
+            return NULL;
+
+        Block *block = _blocks.front();
+        _blocks.pop_front();
+        return block;
+    }
+
+    void close (void)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        _ready.notify_all();
+    }
+
+  private:
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::deque<Block *> _blocks;
+    bool _closed;
+};
+
+/** Hands the evaluated blocks to the writer in sequence order.  */
+class Reorder
+{
+  public:
+    Reorder() : _next(0), _total(~0ull), _aborted(false) {}
+
+    /** Store an evaluated block.  */
+    void put (Block *block)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _blocks[block->sequence] = block;
+
+        if (block->sequence == _next)
+            _ready.notify_one();
+    }
+
+    /** Record the number of blocks read (no more will be put).  */
+    void finish (uint64 total)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _total = total;
+        _ready.notify_one();
+    }
+
+    /** Release the writer without the remaining blocks.  */
+    void abort (void)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _aborted = true;
+        _ready.notify_one();
+    }
+
+    /** Wait for the next block in sequence order.
+     *
+     *  @return The block, or NULL after the last block (or an abort).
+    */
+    Block * next (void)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _ready.wait(lock, [this] {
+            return _aborted || _next == _total ||
+                   (!_blocks.empty() && _blocks.begin()->first == _next);
+        });
+
+        if (_aborted || _next == _total)
+            return NULL;
+
+        Block *block = _blocks.begin()->second;
+        _blocks.erase(_blocks.begin());
+        ++_next;
+        return block;
+    }
+
+  private:
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::map<uint64, Block *> _blocks;
+    uint64 _next,
+           _total;
+    bool _aborted;
+};
+
+/******************************************************
+**                    Parsing                        **
+******************************************************/
+
+/** Skip spaces, tabs, and carriage returns.  */
+static const char * skipBlank (const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        ++p;
+
+    return p;
+}
+
+/** Parse one number and the blanks that follow it.  */
+static bool parseField (const char *&p, const char *end, double &value)
+{
+    if (p < end && *p == '+')
+        ++p;
+
+    std::from_chars_result result = std::from_chars(p, end, value);
+
+    if (result.ec != std::errc())
+        return false;
+
+    p = skipBlank(result.ptr, end);
+    return true;
+}
+
+/** Parse a line holding two numbers separated by a comma, semicolon,
+ *  or blanks.  */
+static bool parsePair (const char *p, const char *end, double pair[2])
+{
+    if (!parseField(p, end, pair[0]))
+        return false;
+
+    if (p < end && (*p == ',' || *p == ';'))
+        p = skipBlank(p + 1, end);
+
+    return parseField(p, end, pair[1]) && (p == end);
+}
+
+/** Parse the CSV lines of a block.  Blank lines and lines starting
+ *  with '#' are skipped; the first other line of a file is skipped as
+ *  a header when it does not parse.  */
+static void parseCsv (Block &block)
+{
+    const char *p = block.input.data(),
+               *end = p + block.input.size();
+    bool header = block.fileStart;
+
+    while (p < end)
+    {
+        const char *eol = static_cast<const char *>(
+                              memchr(p, '\n', size_t(end - p)));
+
+        if (!eol)
+            eol = end;
+
+        ++block.lines;
+
+        const char *first = skipBlank(p, eol);
+        double pair[2];
+
+        if (first == eol || *first == '#')
+            ;
+        else if (parsePair(first, eol, pair))
+        {
+            block.states.push_back(pair[0]);
+            block.states.push_back(pair[1]);
+            header = false;
+        }
+        else if (header)
+            header = false;
+        else
+        {
+            block.errorLine = block.lines;
+            block.error = "expected two numbers";
+            return;
+        }
+
+        p = (eol == end) ? end : eol + 1;
+    }
+
+    return;
+}
+
+/** Copy the binary records of a block.  */
+static void parseBinary (Block &block)
+{
+    size_t records = block.input.size() / RECORD_BYTES;
+
+    block.states.resize(2 * records);
+
+    if (records > 0)
+        memcpy(&block.states[0], block.input.data(),
+               records * RECORD_BYTES);
+
+    if (block.input.size() % RECORD_BYTES)
+        block.error = "truncated record at the end of the input";
+
+    return;
+}
+
+/******************************************************
+**                   Formatting                      **
+******************************************************/
+
+/** Format the evaluated rows as CSV.  */
+static void formatCsv (const Options &options, Block &block)
+{
+    uint32 columns = options.batch.getNumColumns();
+
+    block.output.resize(block.rows * (columns * FIELD_CHARS + 1));
+
+    char *o = &block.output[0];
+    const double *value = block.values.data();
+
+    for (uint64 r = 0; r < block.rows; ++r)
+    {
+        for (uint32 c = 0; c < columns; ++c, ++value)
+        {
+            std::to_chars_result result = (options.precision > 0) ?
+                std::to_chars(o, o + FIELD_CHARS, *value,
+                              std::chars_format::general,
+                              options.precision) :
+                std::to_chars(o, o + FIELD_CHARS, *value);
+
+            o = result.ptr;
+            *o++ = (c + 1 < columns) ? ',' : '\n';
+        }
+    }
+
+    block.output.resize(size_t(o - block.output.data()));
+    return;
+}
+
+/******************************************************
+**                   Pipeline                        **
+******************************************************/
+
+/** Parse, evaluate, and format one block.  */
+static void processBlock (const Options &options, Block &block)
+{
+    block.states.clear();
+    block.output.clear();
+    block.lines = 0;
+    block.errorLine = 0;
+    block.error = NULL;
+
+    if (options.inputFormat == FORMAT_CSV)
+        parseCsv(block);
+    else
+        parseBinary(block);
+
+    block.rows = block.states.size() / 2;
+    block.values.resize(block.rows * options.batch.getNumColumns());
+
+    uint64 evaluated = options.batch.evaluate(options.input,
+                                              block.states.data(),
+                                              block.rows,
+                                              block.values.data());
+
+    block.invalid = block.rows - evaluated;
+
+    if (options.outputFormat == FORMAT_CSV)
+        formatCsv(options, block);
+    else
+        block.output.assign(
+            reinterpret_cast<const char *>(block.values.data()),
+            block.values.size() * sizeof(double));
+
+    return;
+}
+
+/** Worker thread: evaluate blocks until the work queue is drained.  */
+static void evaluateBlocks (const Options &options, BlockQueue &work,
+                            Reorder &reorder)
+{
+    while (Block *block = work.pop())
+    {
+        processBlock(options, *block);
+        reorder.put(block);
+    }
+
+    return;
+}
+
+/** Find the end of the last whole record in a partially read slice.
+ *
+ *  @return The number of bytes to keep (0: no whole record yet).
+*/
+static size_t recordBoundary (const Options &options,
+                              const std::string &input)
+{
+    if (options.inputFormat == FORMAT_BINARY)
+        return input.size() - input.size() % RECORD_BYTES;
+
+    size_t newline = input.rfind('\n');
+    return (newline == std::string::npos) ? 0 : newline + 1;
+}
+
+/** Reader thread: slice the inputs into blocks on record boundaries.
+ *  A block never spans two files.  On failure, error receives the
+ *  message and the blocks read so far are still written.  */
+static void readInputs (const Options &options, BlockQueue &freeBlocks,
+                        BlockQueue &work, Reorder &reorder,
+                        const std::atomic<bool> &aborted,
+                        std::string &error)
+{
+    uint64 sequence = 0;
+    std::string carry;
+
+    for (uint32 f = 0; f < options.files.size() && error.empty(); ++f)
+    {
+        const char *name = options.files[f];
+        bool useStdin = (strcmp(name, "-") == 0);
+        FILE *in = useStdin ? stdin : fopen(name, "rb");
+
+        if (!in)
+        {
+            error = std::string("cannot open ") + name;
+            break;
+        }
+
+        bool start = true,
+             eof = false;
+
+        carry.clear();
+
+        while (!eof && !aborted)
+        {
+            Block *block = freeBlocks.pop();
+
+            if (!block || aborted)
+                break;
+
+            block->input.swap(carry);
+            carry.clear();
+
+            // Read until the slice holds a whole record (a CSV line may
+            // be longer than one block).
+            size_t keep = 0;
+
+            for (;;)
+            {
+                size_t have = block->input.size();
+
+                block->input.resize(have + options.blockBytes);
+
+                size_t got = fread(&block->input[have], 1,
+                                   options.blockBytes, in);
+
+                block->input.resize(have + got);
+
+                if (got < options.blockBytes)
+                {
+                    if (ferror(in))
+                        error = std::string("cannot read ") + name;
+
+                    eof = true;
+                    keep = block->input.size();
+                    break;
+                }
+
+                if ((keep = recordBoundary(options, block->input)) > 0)
+                    break;
+            }
+
+            carry.assign(block->input, keep, std::string::npos);
+            block->input.resize(keep);
+
+            if (block->input.empty() && !start)
+            {
+                freeBlocks.push(block);
+                continue;
+            }
+
+            block->sequence = sequence++;
+            block->file = f;
+            block->fileStart = start;
+            start = false;
+            work.push(block);
+        }
+
+        if (!useStdin)
+            fclose(in);
+
+        if (aborted)
+            break;
+    }
+
+    work.close();
+    reorder.finish(sequence);
+    return;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options] [FILE...]\n"
+            "  --mode pt|ph         input pairs: (P [MPa], T [K]) or\n"
+            "                       (P [MPa], h [kJ/kg]) (default pt)\n"
+            "  --format csv|binary  input format (default csv)\n"
+            "  --output-format F    output format (default: input format)\n"
+            "  --properties LIST    comma-separated output columns, or\n"
+            "                       \"all\" (default all)\n"
+            "  --coalesce exact|Q   evaluate duplicate inputs once, either\n"
+            "                       exact or equal to a relative quantum Q\n"
+            "  --precision N        significant digits of CSV output\n"
+            "                       (default: shortest round trip)\n"
+            "  --header             write a CSV header line\n"
+            "  --threads N          evaluation threads (default: cores)\n"
+            "  --block-bytes N      input bytes per block (default 1048576)\n"
+            "  --output FILE        write to FILE (default stdout)\n"
+            "  --stats              report the throughput on stderr\n"
+            "Reads stdin when no FILE (or \"-\") is given.  Binary inputs\n"
+            "and outputs are native-endian doubles.  Rows that cannot be\n"
+            "evaluated are written as NaN.  Properties:",
+            program);
+
+    for (uint32 i = 0; i < AirBatch::NUM_PROPERTIES; ++i)
+        fprintf(stderr, " %s", AirBatch::propertyName(i));
+
+    fprintf(stderr, "\n");
+    return;
+}
+
+/** Parse a format name.  */
+static bool parseFormat (const char *name, Format &format)
+{
+    if (!strcmp(name, "csv"))
+        format = FORMAT_CSV;
+    else if (!strcmp(name, "binary"))
+        format = FORMAT_BINARY;
+    else
+        return false;
+
+    return true;
+}
+
+int main (int argc, char *argv[])
+{
+    Options options;
+    bool valid = true,
+         outputFormatSet = false;
+
+    options.input = AirBatch::INPUT_PT;
+    options.inputFormat = FORMAT_CSV;
+    options.outputFormat = FORMAT_CSV;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    options.blockBytes = 1 << 20;
+    options.precision = 0;
+    options.header = false;
+    options.stats = false;
+    options.output = NULL;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--mode") && hasValue)
+        {
+            const char *mode = argv[++i];
+
+            if (!strcmp(mode, "pt"))
+                options.input = AirBatch::INPUT_PT;
+            else if (!strcmp(mode, "ph"))
+                options.input = AirBatch::INPUT_PH;
+            else
+                valid = false;
+        }
+        else if (!strcmp(argv[i], "--format") && hasValue)
+            valid = parseFormat(argv[++i], options.inputFormat);
+        else if (!strcmp(argv[i], "--output-format") && hasValue)
+        {
+            valid = parseFormat(argv[++i], options.outputFormat);
+            outputFormatSet = true;
+        }
+        else if (!strcmp(argv[i], "--properties") && hasValue)
+            valid = options.batch.setColumns(argv[++i]);
+        else if (!strcmp(argv[i], "--coalesce") && hasValue)
+        {
+            const char *mode = argv[++i];
+
+            valid = !strcmp(mode, "exact") ?
+                    options.batch.setCoalesce(AirBatch::COALESCE_EXACT) :
+                    options.batch.setCoalesce(AirBatch::COALESCE_QUANTIZED,
+                                              atof(mode));
+        }
+        else if (!strcmp(argv[i], "--precision") && hasValue)
+        {
+            options.precision = atoi(argv[++i]);
+            valid = (options.precision >= 1) && (options.precision <= 17);
+        }
+        else if (!strcmp(argv[i], "--header"))
+            options.header = true;
+        else if (!strcmp(argv[i], "--threads") && hasValue)
+        {
+            options.threads = uint32(strtoul(argv[++i], NULL, 10));
+            valid = (options.threads > 0);
+        }
+        else if (!strcmp(argv[i], "--block-bytes") && hasValue)
+        {
+            options.blockBytes = size_t(strtoull(argv[++i], NULL, 10));
+            valid = (options.blockBytes >= 4096);
+        }
+        else if (!strcmp(argv[i], "--output") && hasValue)
+            options.output = argv[++i];
+        else if (!strcmp(argv[i], "--stats"))
+            options.stats = true;
+        else if (!strcmp(argv[i], "-") || strncmp(argv[i], "--", 2))
+            options.files.push_back(argv[i]);
+        else
+            valid = false;
+    }
+
+    if (!valid)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (!outputFormatSet)
+        options.outputFormat = options.inputFormat;
+
+    if (options.files.empty())
+        options.files.push_back("-");
+
+    // Keep whole binary records in every full block.
+    options.blockBytes -= options.blockBytes % RECORD_BYTES;
+
+    FILE *out = options.output ? fopen(options.output, "wb") : stdout;
+
+    if (!out)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], options.output);
+        return 1;
+    }
+
+    // Two blocks per worker keep every stage busy; the pool bounds the
+    // memory to about (2 * threads + 2) blocks of input and output.
+    uint32 poolSize = 2 * options.threads + 2;
+    std::vector<std::unique_ptr<Block> > pool;
+    BlockQueue freeBlocks,
+               work;
+    Reorder reorder;
+    std::atomic<bool> aborted(false);
+    std::string readError;
+
+    for (uint32 i = 0; i < poolSize; ++i)
+    {
+        pool.push_back(std::unique_ptr<Block>(new Block()));
+        freeBlocks.push(pool.back().get());
+    }
+
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    std::thread reader(readInputs, std::cref(options),
+                       std::ref(freeBlocks), std::ref(work),
+                       std::ref(reorder), std::cref(aborted),
+                       std::ref(readError));
+    std::vector<std::thread> workers;
+
+    for (uint32 i = 0; i < options.threads; ++i)
+        workers.push_back(std::thread(evaluateBlocks, std::cref(options),
+                                      std::ref(work), std::ref(reorder)));
+
+    if (options.header && options.outputFormat == FORMAT_CSV)
+    {
+        for (uint32 c = 0; c < options.batch.getNumColumns(); ++c)
+            fprintf(out, "%s%s", (c > 0) ? "," : "",
+                    AirBatch::propertyName(options.batch.getColumn(c)));
+
+        fprintf(out, "\n");
+    }
+
+    // The main thread writes the blocks in input order.
+    uint64 line = 0,
+           rows = 0,
+           invalid = 0,
+           bytesIn = 0,
+           bytesOut = 0;
+    int status = 0;
+
+    while (Block *block = reorder.next())
+    {
+        if (block->fileStart)
+            line = 0;
+
+        if (fwrite(block->output.data(), 1, block->output.size(), out)
+            != block->output.size())
+        {
+            fprintf(stderr, "%s: write failed\n", argv[0]);
+            status = 1;
+        }
+        else if (block->error)
+        {
+            const char *name = options.files[block->file];
+
+            if (block->errorLine)
+                fprintf(stderr, "%s: %s:%llu: %s\n", argv[0], name,
+                        (unsigned long long)(line + block->errorLine),
+                        block->error);
+            else
+                fprintf(stderr, "%s: %s: %s\n", argv[0], name,
+                        block->error);
+
+            status = 1;
+        }
+
+        line += block->lines;
+        rows += block->rows;
+        invalid += block->invalid;
+        bytesIn += block->input.size();
+        bytesOut += block->output.size();
+
+        if (status)
+        {
+            aborted = true;
+            freeBlocks.close();
+            reorder.abort();
+            break;
+        }
+
+        freeBlocks.push(block);
+    }
+
+    reader.join();
+
+    for (uint32 i = 0; i < workers.size(); ++i)
+        workers[i].join();
+
+    if (!readError.empty())
+    {
+        fprintf(stderr, "%s: %s\n", argv[0], readError.c_str());
+        status = 1;
+    }
+
+    if ((fflush(out) != 0) || (options.output && (fclose(out) != 0)))
+    {
+        fprintf(stderr, "%s: write failed\n", argv[0]);
+        status = 1;
+    }
+
+    if (options.stats)
+    {
+        double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+        fprintf(stderr,
+                "%llu rows (%llu NaN) in %.3f s: %.0f rows/s, "
+                "%.1f MB/s in, %.1f MB/s out, %u threads\n",
+                (unsigned long long)rows, (unsigned long long)invalid,
+                seconds, rows / seconds, bytesIn / seconds * 1e-6,
+                bytesOut / seconds * 1e-6, options.threads);
+    }
+
+    return status;
+}
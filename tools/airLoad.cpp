@@ -0,0 +1,504 @@
+/******************************************************************************
+||  airLoad.cpp      (implementation file)                                   ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Loopback load generator for the air property daemon (airServer).       ||
+||    Each client thread keeps a fixed number of requests in flight on its   ||
+||    own connection, measures the round-trip latency of every request, and  ||
+||    optionally checks the returned rows against a local AirBatch           ||
+||    evaluation.  The report is JSON and includes the metrics of the        ||
+||    daemon.                                                                ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airProtocol.h                                                          ||
+||    Linux (Unix domain sockets)                                            ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airLoad.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+#include "airProtocol.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Distinct random states cycled through by each client.
+static const uint32 POOL_STATES = 65536;
+
+/** The command-line options.  */
+struct LoadOptions
+{
+    const char *path;         // Socket of the daemon
+    uint32 clients,           // Connections (one thread each)
+           states,            // States per request
+           depth,             // Requests in flight per connection
+           mode,              // AIR_MODE_PT or AIR_MODE_PH
+           properties;        // Mask of AirBatch::Property bits
+    double seconds;           // Duration of the run
+    bool verify;              // Compare the rows with AirBatch
+    uint64 seed;
+};
+
+/** What one client measured.  */
+struct ClientResult
+{
+    uint64 requests,
+           states,
+           mismatches;        // Replies that differ from AirBatch
+    std::vector<double> pool,      // The states sent (built untimed)
+                        latency;   // Round trip of each request [us]
+    std::string error;
+};
+
+static double nowSeconds (void)
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/******************************************************
+**                    Sockets                        **
+******************************************************/
+
+static int connectTo (const char *path)
+{
+    sockaddr_un address;
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+    if (fd >= 0 && connect(fd, (sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
+static bool sendAll (int fd, const void *data, size_t bytes)
+{
+    const char *p = (const char *)data;
+
+    while (bytes > 0)
+    {
+        ssize_t sent = send(fd, p, bytes, MSG_NOSIGNAL);
+
+        if (sent <= 0)
+            return false;
+
+        p += sent;
+        bytes -= size_t(sent);
+    }
+
+    return true;
+}
+
+static bool receiveAll (int fd, void *data, size_t bytes)
+{
+    char *p = (char *)data;
+
+    while (bytes > 0)
+    {
+        ssize_t got = recv(fd, p, bytes, 0);
+
+        if (got <= 0)
+            return false;
+
+        p += got;
+        bytes -= size_t(got);
+    }
+
+    return true;
+}
+
+/** Send one request.  */
+static bool sendRequest (int fd, uint32 id, uint32 mode, uint32 properties,
+                         const double *states, uint32 count)
+{
+    AirRequestHeader header;
+
+    header.magic = AIR_REQUEST_MAGIC;
+    header.id = id;
+    header.mode = mode;
+    header.properties = properties;
+    header.count = count;
+    header.reserved = 0;
+
+    return sendAll(fd, &header, sizeof(header)) &&
+           sendAll(fd, states, 2 * sizeof(double) * count);
+}
+
+/** Receive one reply; payload is resized to hold it.  */
+static bool receiveReply (int fd, AirReplyHeader &header,
+                          std::vector<char> &payload)
+{
+    if (!receiveAll(fd, &header, sizeof(header)) ||
+        header.magic != AIR_REPLY_MAGIC)
+        return false;
+
+    payload.resize(header.bytes);
+    return header.bytes == 0 || receiveAll(fd, &payload[0], header.bytes);
+}
+
+/******************************************************
+**                    Clients                        **
+******************************************************/
+
+/** Random states inside the range of the ADT.  */
+static void randomStates (std::vector<double> &pool, uint32 mode,
+                          uint64 seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> logP(-4.0, 1.0),
+                                           T(200.0, 25000.0);
+    Air air;
+
+    pool.resize(2 * POOL_STATES);
+
+    for (uint32 i = 0; i < POOL_STATES; ++i)
+    {
+        double pressure = pow(10.0, logP(rng)),
+               temperature = T(rng);
+
+        pool[2 * i] = pressure;
+        pool[2 * i + 1] = temperature;
+
+        if (mode == AIR_MODE_PH && air.calculateProperties(pressure,
+                                                           temperature))
+            pool[2 * i + 1] = air.getEnthalpy();
+    }
+
+    return;
+}
+
+/** One connection: keep depth requests in flight until the time is up,
+ *  then drain the outstanding replies.  */
+static void runClient (const LoadOptions *options, ClientResult *result)
+{
+    std::vector<double> sendTime(options->depth);
+    std::vector<char> payload;
+    std::vector<double> expected;
+    AirBatch reference;
+
+    if (options->properties)
+    {
+        uint32 columns[AirBatch::NUM_PROPERTIES],
+               count = 0;
+
+        for (uint32 p = 0; p < AirBatch::NUM_PROPERTIES; ++p)
+            if (options->properties & (1u << p))
+                columns[count++] = p;
+
+        reference.setColumns(columns, count);
+    }
+
+    int fd = connectTo(options->path);
+
+    if (fd < 0)
+    {
+        result->error = std::string("cannot connect to ") + options->path;
+        return;
+    }
+
+    uint32 slots = POOL_STATES / options->states,
+           sent = 0,
+           received = 0;
+    double end = nowSeconds() + options->seconds;
+    const double *first = &result->pool[0];
+
+    while (sent < options->depth && sendRequest(fd, sent, options->mode,
+           options->properties, first + 2 * size_t(sent % slots) *
+           options->states, options->states))
+        sendTime[sent++ % options->depth] = nowSeconds();
+
+    while (received < sent)
+    {
+        AirReplyHeader header;
+
+        if (!receiveReply(fd, header, payload) ||
+            header.status != AIR_STATUS_OK || header.id != received)
+        {
+            result->error = "bad reply";
+            break;
+        }
+
+        double now = nowSeconds();
+        const double *states = first + 2 * size_t(received % slots) *
+                                           options->states;
+
+        result->latency.push_back(
+            1e6 * (now - sendTime[received % options->depth]));
+        ++result->requests;
+        result->states += header.count;
+
+        if (options->verify)
+        {
+            expected.resize(size_t(options->states) *
+                            reference.getNumColumns());
+            reference.evaluate(options->mode == AIR_MODE_PH ?
+                               AirBatch::INPUT_PH : AirBatch::INPUT_PT,
+                               states, options->states, &expected[0]);
+
+            if (header.bytes != expected.size() * sizeof(double) ||
+                memcmp(&payload[0], &expected[0], header.bytes) != 0)
+                ++result->mismatches;
+        }
+
+        ++received;
+
+        if (now < end)
+        {
+            if (!sendRequest(fd, sent, options->mode, options->properties,
+                             first + 2 * size_t(sent % slots) *
+                                     options->states, options->states))
+            {
+                result->error = "send failed";
+                break;
+            }
+
+            sendTime[sent++ % options->depth] = nowSeconds();
+        }
+    }
+
+    close(fd);
+    return;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static double percentile (std::vector<double> &values, double q)
+{
+    if (values.empty())
+        return 0.0;
+
+    size_t k = std::min(values.size() - 1, size_t(q * values.size()));
+    std::nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --socket PATH      daemon socket (default /tmp/air-adt.sock)\n"
+            "  --clients N        connections (default 4)\n"
+            "  --states N         states per request (default 64)\n"
+            "  --depth N          requests in flight per client (default 4)\n"
+            "  --seconds S        duration (default 2)\n"
+            "  --mode pt|ph       request mode (default pt)\n"
+            "  --properties LIST  comma-separated columns (default all)\n"
+            "  --verify           compare every reply with AirBatch\n"
+            "  --seed N           random state seed (default 2014)\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    LoadOptions options;
+    bool valid = true;
+
+    options.path = "/tmp/air-adt.sock";
+    options.clients = 4;
+    options.states = 64;
+    options.depth = 4;
+    options.mode = AIR_MODE_PT;
+    options.properties = 0;
+    options.seconds = 2.0;
+    options.verify = false;
+    options.seed = 2014;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--socket") && hasValue)
+            options.path = argv[++i];
+        else if (!strcmp(argv[i], "--clients") && hasValue)
+            options.clients = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--states") && hasValue)
+            options.states = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--depth") && hasValue)
+            options.depth = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--seconds") && hasValue)
+            options.seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--mode") && hasValue)
+        {
+            const char *mode = argv[++i];
+
+            valid = !strcmp(mode, "pt") || !strcmp(mode, "ph");
+            options.mode = strcmp(mode, "ph") ? AIR_MODE_PT : AIR_MODE_PH;
+        }
+        else if (!strcmp(argv[i], "--properties") && hasValue)
+        {
+            const char *name = argv[++i];
+
+            for (;;)
+            {
+                const char *end = strchr(name, ',');
+                size_t length = end ? size_t(end - name) : strlen(name);
+                uint32 property;
+
+                if (!AirBatch::findProperty(name, length, property))
+                {
+                    valid = false;
+                    break;
+                }
+
+                options.properties |= 1u << property;
+
+                if (!end)
+                    break;
+
+                name = end + 1;
+            }
+        }
+        else if (!strcmp(argv[i], "--verify"))
+            options.verify = true;
+        else if (!strcmp(argv[i], "--seed") && hasValue)
+            options.seed = strtoull(argv[++i], NULL, 10);
+        else
+            valid = false;
+    }
+
+    if (!valid || options.clients == 0 || options.depth == 0 ||
+        options.states == 0 || options.states > AIR_MAX_STATES)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<ClientResult> results(options.clients);
+    std::vector<std::thread> threads;
+
+    for (uint32 i = 0; i < options.clients; ++i)
+    {
+        results[i].requests = 0;
+        results[i].states = 0;
+        results[i].mismatches = 0;
+        randomStates(results[i].pool, options.mode, options.seed + i);
+    }
+
+    double start = nowSeconds();
+
+    for (uint32 i = 0; i < options.clients; ++i)
+        threads.push_back(std::thread(runClient, &options, &results[i]));
+
+    for (uint32 i = 0; i < options.clients; ++i)
+        threads[i].join();
+
+    double seconds = nowSeconds() - start;
+    uint64 requests = 0,
+           states = 0,
+           mismatches = 0;
+    std::vector<double> latency;
+    int status = 0;
+
+    for (uint32 i = 0; i < options.clients; ++i)
+    {
+        if (!results[i].error.empty())
+        {
+            fprintf(stderr, "%s: client %u: %s\n", argv[0], i,
+                    results[i].error.c_str());
+            status = 1;
+        }
+
+        requests += results[i].requests;
+        states += results[i].states;
+        mismatches += results[i].mismatches;
+        latency.insert(latency.end(), results[i].latency.begin(),
+                       results[i].latency.end());
+    }
+
+    double mean = 0.0;
+
+    for (size_t i = 0; i < latency.size(); ++i)
+        mean += latency[i];
+
+    mean = latency.empty() ? 0.0 : mean / double(latency.size());
+
+    printf("{\"clients\":%u,\"states_per_request\":%u,\"depth\":%u,"
+           "\"seconds\":%.3f,\"requests\":%llu,\"states\":%llu,"
+           "\"requests_per_s\":%.0f,\"states_per_s\":%.0f,",
+           options.clients, options.states, options.depth, seconds,
+           (unsigned long long)requests, (unsigned long long)states,
+           double(requests) / seconds, double(states) / seconds);
+    printf("\"latency_us\":{\"mean\":%.2f,\"p50\":%.2f,\"p90\":%.2f,"
+           "\"p99\":%.2f,\"max\":%.2f},", mean,
+           percentile(latency, 0.5), percentile(latency, 0.9),
+           percentile(latency, 0.99), percentile(latency, 1.0));
+
+    if (options.verify)
+        printf("\"mismatches\":%llu,", (unsigned long long)mismatches);
+
+    // The daemon's view, including its batch sizes.
+    int fd = connectTo(options.path);
+    AirReplyHeader header;
+    std::vector<char> payload;
+
+    if (fd >= 0 && sendRequest(fd, 0, AIR_MODE_STATS, 0, NULL, 0) &&
+        receiveReply(fd, header, payload) && !payload.empty())
+        printf("\"server\":%.*s}\n", int(payload.size()), &payload[0]);
+    else
+        printf("\"server\":null}\n");
+
+    if (fd >= 0)
+        close(fd);
+
+    return (status || mismatches) ? 1 : 0;
+}
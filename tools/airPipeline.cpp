@@ -0,0 +1,547 @@
+/******************************************************************************
+||  airPipeline.cpp      (implementation file)                               ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Real-time sensor pipeline over shared-memory rings.  A synthetic       ||
+||    producer writes paced (P, T) samples into an AirRing, an evaluator     ||
+||    drains it in batches through AirBatch and writes density, viscosity,   ||
+||    and sound speed into a second ring, and a consumer measures the        ||
+||    end-to-end latency of every sample from its acquisition time.  The     ||
+||    stages run as separate processes (or threads), and a full ring either  ||
+||    stalls the stage behind it or drops samples.                           ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airRing.h                                                              ||
+||    toolLatency.h                                                          ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airPipeline.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+#include "airRing.h"
+#include "toolLatency.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/******************************************************
+**                    Records                        **
+******************************************************/
+
+/** A sensor sample (the input ring).  */
+struct SensorSample
+{
+    uint64 sequence;        // Sample number
+    uint64 stampNs;         // Acquisition time (toolNowNs)
+    double pressure,        // [MPa]
+           temperature;     // [K]
+};
+
+/** The properties of a sample (the output ring).  */
+struct SensorResult
+{
+    uint64 sequence;
+    uint64 stampNs;         // Acquisition time of the sample
+    double density,         // [kg/m^3]
+           viscosity,       // [Pa s]
+           soundSpeed;      // [m/s]
+};
+
+// Output columns of the evaluator, in SensorResult order.
+static const uint32 RESULT_COLUMNS[] =
+{
+    AirBatch::DENSITY, AirBatch::VISCOSITY, AirBatch::SOUND_SPEED
+};
+
+static const uint32 NUM_RESULT_COLUMNS = 3;
+
+/** The options shared by the stages.  */
+struct PipelineOptions
+{
+    double rate,            // Samples per second (0: unpaced)
+           seconds;         // Duration of production
+    uint32 capacity,        // Slots per ring
+           batch;           // Largest evaluator batch
+    bool drop,              // Drop samples when the input ring is full
+         threads,           // Run the stages as threads
+         named;             // Attach to named rings in each process
+};
+
+/** What the stages measured (in shared memory; each stage writes
+ *  only its own line).  */
+struct PipelineStats
+{
+    alignas(64) uint64 startNs,
+                       produced,
+                       dropped,
+                       producerStalls;      // Input ring found full
+    alignas(64) uint64 evaluated,
+                       batches,
+                       evaluatorStalls;     // Output ring found full
+    alignas(64) uint64 consumed,
+                       lost,                // Sequence gaps
+                       reordered,
+                       firstNs,
+                       lastNs;
+    double checksum;
+    ToolLatency latency;                    // Acquisition to consumer
+};
+
+/** Spin briefly, then give the processor away.  */
+static void idle (uint32 &spins)
+{
+    if (++spins < 64)
+        return;
+
+    spins = 0;
+    std::this_thread::yield();
+    return;
+}
+
+/******************************************************
+**                     Stages                        **
+******************************************************/
+
+/** The synthetic producer: a pressure and temperature sweep sampled at
+ *  the given rate.  Under the drop policy the samples that find the
+ *  ring full are skipped (their sequence numbers leave gaps).  */
+static void produce (const PipelineOptions &options, AirRing &ring,
+                     PipelineStats &stats)
+{
+    const double PI = 3.14159265358979;
+    uint64 start = stats.startNs,
+           end = start + uint64(options.seconds * 1e9),
+           sequence = 0;
+    double period = (options.rate > 0.0) ? 1e9 / options.rate : 0.0;
+    uint32 spins = 0;
+
+    for (;;)
+    {
+        uint64 now = toolNowNs();
+
+        if (now >= end)
+            break;
+
+        // The samples whose acquisition time has passed.
+        uint64 due = (period > 0.0) ?
+                     uint64(double(now - start) / period) + 1 :
+                     sequence + options.batch;
+
+        if (sequence >= due)
+        {
+            idle(spins);
+            continue;
+        }
+
+        void *slots;
+        uint32 n = ring.reserve(slots, uint32(std::min<uint64>(
+                                due - sequence, options.batch)));
+
+        if (n == 0)
+        {
+            ++stats.producerStalls;
+
+            if (options.drop)
+            {
+                stats.dropped += due - sequence;
+                sequence = due;
+            }
+
+            idle(spins);
+            continue;
+        }
+
+        SensorSample *sample = static_cast<SensorSample *>(slots);
+
+        for (uint32 i = 0; i < n; ++i, ++sequence)
+        {
+            double t = (period > 0.0) ? 1e-9 * period * double(sequence) :
+                                        1e-9 * double(now - start);
+
+            sample[i].sequence = sequence;
+            sample[i].stampNs = (period > 0.0) ?
+                start + uint64(period * double(sequence)) : now;
+            sample[i].pressure = 0.05 * (1.5 + sin(2.0 * PI * 3.0 * t));
+            sample[i].temperature = 1100.0 + 800.0 * sin(2.0 * PI * t);
+        }
+
+        ring.commit(n);
+        stats.produced += n;
+    }
+
+    ring.close();
+    return;
+}
+
+/** The evaluator: batches of samples to batches of properties.  It
+ *  only takes as many samples as the output ring can hold, so a slow
+ *  consumer backs up into the input ring.  */
+static void evaluate (const PipelineOptions &options, AirRing &input,
+                      AirRing &output, PipelineStats &stats)
+{
+    AirBatch batch;
+    std::vector<double> states(2 * options.batch),
+                        values(NUM_RESULT_COLUMNS * options.batch);
+    uint32 spins = 0;
+
+    batch.setColumns(RESULT_COLUMNS, NUM_RESULT_COLUMNS);
+
+    for (;;)
+    {
+        const void *records;
+        uint32 n = input.peek(records, options.batch);
+
+        if (n == 0)
+        {
+            if (input.isDrained())
+                break;
+
+            idle(spins);
+            continue;
+        }
+
+        void *slots;
+        uint32 m;
+
+        while ((m = output.reserve(slots, n)) == 0)
+        {
+            ++stats.evaluatorStalls;
+            idle(spins);
+        }
+
+        n = std::min(n, m);
+
+        const SensorSample *sample =
+            static_cast<const SensorSample *>(records);
+        SensorResult *result = static_cast<SensorResult *>(slots);
+
+        for (uint32 i = 0; i < n; ++i)
+        {
+            states[2 * i] = sample[i].pressure;
+            states[2 * i + 1] = sample[i].temperature;
+        }
+
+        batch.evaluate(AirBatch::INPUT_PT, &states[0], n, &values[0]);
+
+        for (uint32 i = 0; i < n; ++i)
+        {
+            result[i].sequence = sample[i].sequence;
+            result[i].stampNs = sample[i].stampNs;
+            result[i].density = values[3 * i];
+            result[i].viscosity = values[3 * i + 1];
+            result[i].soundSpeed = values[3 * i + 2];
+        }
+
+        output.commit(n);
+        input.release(n);
+        stats.evaluated += n;
+        ++stats.batches;
+    }
+
+    output.close();
+    return;
+}
+
+/** The consumer: end-to-end latency and sequence checks.  */
+static void consume (AirRing &ring, PipelineStats &stats)
+{
+    ToolLatency latency;
+    uint64 expected = 0;
+    uint32 spins = 0;
+
+    for (;;)
+    {
+        const void *records;
+        uint32 n = ring.peek(records, 256);
+
+        if (n == 0)
+        {
+            if (ring.isDrained())
+                break;
+
+            idle(spins);
+            continue;
+        }
+
+        const SensorResult *result =
+            static_cast<const SensorResult *>(records);
+        uint64 now = toolNowNs();
+
+        if (stats.consumed == 0)
+            stats.firstNs = now;
+
+        for (uint32 i = 0; i < n; ++i)
+        {
+            latency.add(now - result[i].stampNs);
+            stats.checksum += result[i].density;
+
+            if (result[i].sequence > expected)
+                stats.lost += result[i].sequence - expected;
+            else if (result[i].sequence < expected)
+                ++stats.reordered;
+
+            expected = result[i].sequence + 1;
+        }
+
+        ring.release(n);
+        stats.consumed += n;
+        stats.lastNs = now;
+    }
+
+    stats.latency = latency;
+    return;
+}
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+/** Run one stage in a child process.  */
+static pid_t spawn (int stage, const PipelineOptions &options,
+                    AirRing &input, AirRing &output,
+                    const std::string &inName, const std::string &outName,
+                    PipelineStats &stats)
+{
+    pid_t pid = fork();
+
+    if (pid != 0)
+        return pid;
+
+    // A named ring is attached afresh, as an unrelated process would.
+    if (options.named && !((stage == 2 || input.open(inName.c_str())) &&
+                           (stage == 0 || output.open(outName.c_str()))))
+        _exit(1);
+
+    if (stage == 0)
+        produce(options, input, stats);
+    else if (stage == 1)
+        evaluate(options, input, output, stats);
+    else
+        consume(output, stats);
+
+    _exit(0);
+}
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --rate HZ         samples per second, 0 = unpaced "
+            "(default 100000)\n"
+            "  --seconds S       production time (default 2)\n"
+            "  --capacity N      slots per ring, a power of two "
+            "(default 4096)\n"
+            "  --batch N         largest evaluator batch (default 64)\n"
+            "  --policy P        block or drop when the input ring is "
+            "full\n"
+            "                    (default block)\n"
+            "  --threads         run the stages as threads, not "
+            "processes\n"
+            "  --named           attach each process to named rings\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    PipelineOptions options;
+    bool valid = true;
+
+    options.rate = 100000.0;
+    options.seconds = 2.0;
+    options.capacity = 4096;
+    options.batch = 64;
+    options.drop = false;
+    options.threads = false;
+    options.named = false;
+
+    for (int i = 1; i < argc && valid; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--rate") && hasValue)
+            options.rate = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seconds") && hasValue)
+            options.seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--capacity") && hasValue)
+            options.capacity = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--batch") && hasValue)
+            options.batch = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--policy") && hasValue)
+        {
+            const char *policy = argv[++i];
+
+            valid = !strcmp(policy, "block") || !strcmp(policy, "drop");
+            options.drop = !strcmp(policy, "drop");
+        }
+        else if (!strcmp(argv[i], "--threads"))
+            options.threads = true;
+        else if (!strcmp(argv[i], "--named"))
+            options.named = true;
+        else
+            valid = false;
+    }
+
+    if (!valid || options.batch == 0 || !(options.seconds > 0.0) ||
+        options.rate < 0.0 || (options.threads && options.named))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // The statistics are shared with the child processes.
+    void *mapping = mmap(NULL, sizeof(PipelineStats),
+                         PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                         -1, 0);
+
+    if (mapping == MAP_FAILED)
+    {
+        perror("mmap");
+        return 1;
+    }
+
+    PipelineStats &stats = *new (mapping) PipelineStats();
+    std::string inName, outName;
+    AirRing input, output;
+
+    if (options.named)
+    {
+        char prefix[64];
+        snprintf(prefix, sizeof(prefix), "/air-pipeline-%d", int(getpid()));
+        inName = std::string(prefix) + "-in";
+        outName = std::string(prefix) + "-out";
+    }
+
+    if (!input.create(options.named ? inName.c_str() : NULL,
+                      options.capacity, sizeof(SensorSample)) ||
+        !output.create(options.named ? outName.c_str() : NULL,
+                       options.capacity, sizeof(SensorResult)))
+    {
+        fprintf(stderr, "%s: %s%s\n", argv[0], input.getError(),
+                output.getError());
+        return 1;
+    }
+
+    stats.startNs = toolNowNs();
+    int status = 0;
+
+    if (options.threads)
+    {
+        std::thread consumer(consume, std::ref(output), std::ref(stats)),
+                    evaluator(evaluate, std::cref(options), std::ref(input),
+                              std::ref(output), std::ref(stats)),
+                    producer(produce, std::cref(options), std::ref(input),
+                             std::ref(stats));
+
+        producer.join();
+        evaluator.join();
+        consumer.join();
+    }
+    else
+    {
+        pid_t children[3];
+
+        for (int stage = 2; stage >= 0; --stage)
+            children[stage] = spawn(stage, options, input, output, inName,
+                                    outName, stats);
+
+        for (int stage = 0; stage < 3; ++stage)
+        {
+            int result = 1;
+
+            if (children[stage] < 0 ||
+                waitpid(children[stage], &result, 0) != children[stage] ||
+                !WIFEXITED(result) || WEXITSTATUS(result) != 0)
+                status = 1;
+        }
+    }
+
+    if (options.named)
+    {
+        AirRing::remove(inName.c_str());
+        AirRing::remove(outName.c_str());
+    }
+
+    double seconds = 1e-9 * double(stats.lastNs - stats.firstNs);
+    std::string latency;
+
+    stats.latency.json(latency);
+    printf("{\"stages\":\"%s\",\"rate\":%.0f,\"seconds\":%.2f,"
+           "\"capacity\":%u,\"batch\":%u,\"policy\":\"%s\",\n"
+           " \"produced\":%llu,\"dropped\":%llu,\"producer_stalls\":%llu,"
+           "\"evaluated\":%llu,\"batches\":%llu,\"mean_batch\":%.1f,"
+           "\"evaluator_stalls\":%llu,\n"
+           " \"consumed\":%llu,\"lost\":%llu,\"reordered\":%llu,"
+           "\"throughput_per_s\":%.0f,\"checksum\":%.6e,\n"
+           " \"latency_us\":%s}\n",
+           options.threads ? "threads" : "processes", options.rate,
+           options.seconds, options.capacity, options.batch,
+           options.drop ? "drop" : "block",
+           (unsigned long long)stats.produced,
+           (unsigned long long)stats.dropped,
+           (unsigned long long)stats.producerStalls,
+           (unsigned long long)stats.evaluated,
+           (unsigned long long)stats.batches,
+           stats.batches ? double(stats.evaluated) / double(stats.batches)
+                         : 0.0,
+           (unsigned long long)stats.evaluatorStalls,
+           (unsigned long long)stats.consumed,
+           (unsigned long long)stats.lost,
+           (unsigned long long)stats.reordered,
+           (seconds > 0.0) ? double(stats.consumed) / seconds : 0.0,
+           stats.checksum, latency.c_str());
+
+    if (stats.consumed != stats.produced || stats.reordered)
+        status = 1;
+
+    munmap(mapping, sizeof(PipelineStats));
+    return status;
+}
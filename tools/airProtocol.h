@@ -0,0 +1,120 @@
+/******************************************************************************
+||  airProtocol.h      (definition file)                                     ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    The binary protocol of the air property daemon (airServer).  Every     ||
+||    frame is a fixed header of six native-endian 32-bit words followed by  ||
+||    a payload: requests carry (P, T) or (P, h) pairs of doubles, replies   ||
+||    carry the selected property columns of every state.  The header is     ||
+||    shared by the daemon, the load generator, and any client written in    ||
+||    another language.                                                      ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airProtocol.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_AIR_PROTOCOL_H
+#define _GH_DEF_AIR_PROTOCOL_H
+
+#include "air.h"
+
+/*  A request is an AirRequestHeader followed by count pairs of doubles,
+ *  (pressure [MPa], temperature [K]) for AIR_MODE_PT or (pressure [MPa],
+ *  enthalpy [kJ/kg]) for AIR_MODE_PH.  properties is a mask of
+ *  AirBatch::Property bits (0 selects every property).
+ *
+ *  The reply is an AirReplyHeader followed by bytes of payload: count
+ *  rows of columns doubles, one column per selected property in enum
+ *  order, with NaN rows for states that cannot be evaluated.  An
+ *  AIR_MODE_STATS request (count 0) is answered with a JSON document of
+ *  the daemon, per-client, and per-peer (closed connections) metrics
+ *  instead.
+ *
+ *  Requests on one connection are answered in order; id is echoed so a
+ *  client may pipeline.  After an AIR_STATUS_BAD_REQUEST reply the
+ *  daemon closes the connection.
+*/
+
+// Frame magic numbers ("AIRQ" and "AIRR" in little-endian order).
+static const uint32 AIR_REQUEST_MAGIC = 0x51524941;
+static const uint32 AIR_REPLY_MAGIC = 0x52524941;
+
+// Largest number of states in one request.
+static const uint32 AIR_MAX_STATES = 65536;
+
+/** The kind of request.  */
+enum AirRequestMode
+{
+    AIR_MODE_PT = 0,     // (pressure, temperature) pairs
+    AIR_MODE_PH = 1,     // (pressure, enthalpy) pairs
+    AIR_MODE_STATS = 2   // Metrics (JSON payload)
+};
+
+/** The outcome of a request.  */
+enum AirReplyStatus
+{
+    AIR_STATUS_OK = 0,
+    AIR_STATUS_BAD_REQUEST = 1
+};
+
+/** The fixed part of a request frame.  */
+struct AirRequestHeader
+{
+    uint32 magic;        // AIR_REQUEST_MAGIC
+    uint32 id;           // Echoed in the reply
+    uint32 mode;         // AirRequestMode
+    uint32 properties;   // Mask of AirBatch::Property bits (0: all)
+    uint32 count;        // Number of states (at most AIR_MAX_STATES)
+    uint32 reserved;     // Zero
+};
+
+/** The fixed part of a reply frame.  */
+struct AirReplyHeader
+{
+    uint32 magic;        // AIR_REPLY_MAGIC
+    uint32 id;           // The id of the request
+    uint32 status;       // AirReplyStatus
+    uint32 columns;      // Doubles per state
+    uint32 count;        // Number of states
+    uint32 bytes;        // Payload bytes that follow
+};
+
+#endif
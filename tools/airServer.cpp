@@ -0,0 +1,911 @@
+/******************************************************************************
+||  airServer.cpp      (implementation file)                                 ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Local property daemon for the equilibrium air ADT.  Clients connect    ||
+||    over a Unix domain socket and send (P, T) or (P, h) batches in the     ||
+||    binary protocol of airProtocol.h.  A single epoll event loop reads     ||
+||    every ready connection, coalesces the complete requests that share a   ||
+||    mode and property set into one AirBatch evaluation, and scatters the   ||
+||    rows back in per-connection order.  Per-client request latency is      ||
+||    kept in log2 histograms, merged per peer process when the client       ||
+||    disconnects, and served as JSON.                                       ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    airBatch.h                                                             ||
+||    airProtocol.h                                                          ||
+||    toolLatency.h                                                          ||
+||    Linux (epoll)                                                          ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file airServer.cpp
+ *  @date 2026-10-18
+*/
+
+#include "airBatch.h"
+#include "airProtocol.h"
+#include "toolLatency.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// epoll key of the listening socket (clients are numbered from 1).
+static const uint64 LISTEN_KEY = 0;
+
+// Reading from a client stops while more reply bytes than this are
+// waiting to be sent to it.
+static const size_t MAX_BACKLOG = 16 << 20;
+
+// Largest number of bytes read from one client per wakeup.
+static const size_t MAX_READ = 4 << 20;
+
+// Largest number of peer processes whose metrics are kept after their
+// connections close; the least recently closed peer is folded into a
+// single "other" record beyond this.
+static const size_t MAX_PEERS = 256;
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop (int)
+{  stopRequested = 1;  }
+
+/******************************************************
+**                    Server                         **
+******************************************************/
+
+/** One connection.  */
+struct Client
+{
+    int fd;
+    std::string in,           // Bytes of incomplete requests
+                out;          // Reply bytes not yet sent
+    size_t outSent;           // Bytes of out already sent
+    uint32 events;            // The registered epoll events
+    uint32 inFlight;          // Requests waiting for evaluation
+    bool eof,                 // The peer stopped sending
+         closing;             // Close after the output is flushed
+    uint32 pid,               // Peer process (SO_PEERCRED)
+           uid;
+    uint64 requests,
+           states;
+    ToolLatency latency;      // Complete request to reply queued
+};
+
+/** The merged metrics of the closed connections of one peer process.  */
+struct Peer
+{
+    uint32 pid,
+           uid;
+    uint64 connections,
+           requests,
+           states,
+           lastClosed;        // Time the last connection closed [ns]
+    ToolLatency latency;
+};
+
+/** The requests with one mode and property set since the last
+ *  evaluation, concatenated into one batch.  */
+struct Group
+{
+    uint32 mode,
+           properties;
+    AirBatch batch;
+    std::vector<double> states,
+                        values;
+};
+
+/** A request waiting for its group to be evaluated.  */
+struct Pending
+{
+    uint64 client;        // Key of the client
+    uint32 id,            // Request id
+           group,         // Index in _groups
+           count;         // Number of states
+    size_t first;         // First state in the group batch
+    uint64 arrival;       // Time the request was complete [ns]
+};
+
+class Server
+{
+  public:
+    Server (uint64 windowNs, uint32 maxBatch, bool verbose)
+      : _epoll(-1), _listen(-1), _nextKey(1), _otherPeers(),
+        _windowNs(windowNs), _maxBatch(maxBatch), _verbose(verbose),
+        _pendingStates(0), _pendingSince(0), _connections(0), _batches(0),
+        _batchRequests(0), _batchStates(0)
+    {}
+
+    ~Server()
+    {
+        while (!_clients.empty())
+            _close(_clients.begin()->first);
+
+        if (_listen >= 0)
+        {
+            close(_listen);
+            unlink(_path.c_str());
+        }
+
+        if (_epoll >= 0)
+            close(_epoll);
+    }
+
+    /** Bind the socket; a stale socket file is replaced.  */
+    bool listenOn (const char *path)
+    {
+        sockaddr_un address;
+
+        if (strlen(path) >= sizeof(address.sun_path))
+        {
+            fprintf(stderr, "airServer: socket path too long\n");
+            return false;
+        }
+
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strcpy(address.sun_path, path);
+
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        _listen = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK |
+                         SOCK_CLOEXEC, 0);
+
+        if (_epoll < 0 || _listen < 0)
+        {
+            perror("airServer: socket");
+            return false;
+        }
+
+        if (bind(_listen, (sockaddr *)&address, sizeof(address)) != 0)
+        {
+            // A socket file nobody accepts on is left by a dead daemon.
+            bool inUse = (errno == EADDRINUSE),
+                 live = false;
+
+            if (inUse)
+            {
+                int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+                live = (probe >= 0) && (connect(probe, (sockaddr *)&address,
+                                                sizeof(address)) == 0);
+
+                if (probe >= 0)
+                    close(probe);
+            }
+
+            if (!inUse || live)
+            {
+                fprintf(stderr, "airServer: cannot bind %s%s\n", path,
+                        live ? " (a daemon is running)" : "");
+                return false;
+            }
+
+            unlink(path);
+
+            if (bind(_listen, (sockaddr *)&address, sizeof(address)) != 0)
+            {
+                perror("airServer: bind");
+                return false;
+            }
+        }
+
+        _path = path;
+
+        if (listen(_listen, 128) != 0)
+        {
+            perror("airServer: listen");
+            return false;
+        }
+
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = LISTEN_KEY;
+        return epoll_ctl(_epoll, EPOLL_CTL_ADD, _listen, &event) == 0;
+    }
+
+    /** Serve until SIGINT or SIGTERM.  */
+    void run (void)
+    {
+        std::vector<epoll_event> events(256);
+
+        while (!stopRequested)
+        {
+            int timeout = -1;
+
+            if (!_pending.empty())
+            {
+                uint64 age = toolNowNs() - _pendingSince;
+                timeout = (age < _windowNs) ?
+                          int((_windowNs - age + 999999) / 1000000) : 0;
+            }
+
+            int ready = epoll_wait(_epoll, &events[0],
+                                   int(events.size()), timeout);
+
+            if (ready < 0 && errno != EINTR)
+            {
+                perror("airServer: epoll_wait");
+                break;
+            }
+
+            for (int i = 0; i < ready; ++i)
+            {
+                uint64 key = events[i].data.u64;
+
+                if (key == LISTEN_KEY)
+                {
+                    _accept();
+                    continue;
+                }
+
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                    _read(key);
+
+                if (events[i].events & EPOLLOUT)
+                    _flush(key);
+            }
+
+            // Every request that arrived during this wakeup (or inside
+            // the coalescing window) shares one evaluation.
+            if (!_pending.empty() &&
+                (_pendingStates >= _maxBatch ||
+                 toolNowNs() - _pendingSince >= _windowNs))
+                _evaluate();
+
+            _reap();
+        }
+
+        _evaluate();
+        return;
+    }
+
+    /** The daemon and per-client metrics as JSON.  */
+    std::string statsJson (void) const
+    {
+        std::string out;
+        char text[256];
+
+        snprintf(text, sizeof(text),
+                 "{\"connections\":%llu,\"batches\":%llu,"
+                 "\"requests\":%llu,\"states\":%llu,"
+                 "\"requests_per_batch\":%.2f,\"states_per_batch\":%.1f,"
+                 "\"latency_us\":",
+                 (unsigned long long)_connections,
+                 (unsigned long long)_batches,
+                 (unsigned long long)_batchRequests,
+                 (unsigned long long)_batchStates,
+                 _batches ? double(_batchRequests) / double(_batches) : 0.0,
+                 _batches ? double(_batchStates) / double(_batches) : 0.0);
+        out += text;
+        _latency.json(out);
+        out += ",\"clients\":[";
+
+        for (std::map<uint64, Client>::const_iterator it = _clients.begin();
+             it != _clients.end(); ++it)
+        {
+            snprintf(text, sizeof(text),
+                     "%s{\"client\":%llu,\"pid\":%u,\"uid\":%u,"
+                     "\"requests\":%llu,\"states\":%llu,\"latency_us\":",
+                     (it == _clients.begin()) ? "" : ",",
+                     (unsigned long long)it->first,
+                     it->second.pid, it->second.uid,
+                     (unsigned long long)it->second.requests,
+                     (unsigned long long)it->second.states);
+            out += text;
+            it->second.latency.json(out);
+            out += "}";
+        }
+
+        out += "],\"peers\":[";
+
+        for (std::map<uint64, Peer>::const_iterator it = _peers.begin();
+             it != _peers.end(); ++it)
+        {
+            out += (it == _peers.begin()) ? "" : ",";
+            _peerJson(it->second, true, out);
+        }
+
+        out += "],\"other_peers\":";
+        _peerJson(_otherPeers, false, out);
+        out += "}";
+        return out;
+    }
+
+  private:
+    int _epoll,
+        _listen;
+    std::string _path;
+    std::map<uint64, Client> _clients;
+    uint64 _nextKey;
+
+    std::map<uint64, Peer> _peers;    // Closed clients by (uid, pid)
+    Peer _otherPeers;                 // Peers beyond MAX_PEERS
+
+    uint64 _windowNs;                 // Coalescing window
+    uint32 _maxBatch;                 // States that end the window
+    bool _verbose;
+
+    std::vector<Group> _groups;       // Batches being collected
+    std::vector<Pending> _pending;    // Requests in arrival order
+    uint64 _pendingStates,
+           _pendingSince;
+
+    uint64 _connections,
+           _batches,
+           _batchRequests,
+           _batchStates;
+    ToolLatency _latency;             // Every request
+
+    /** Append the JSON record of a peer.  */
+    static void _peerJson (const Peer &peer, bool identified,
+                           std::string &out)
+    {
+        char text[192];
+
+        if (identified)
+        {
+            snprintf(text, sizeof(text), "{\"pid\":%u,\"uid\":%u,",
+                     peer.pid, peer.uid);
+            out += text;
+        }
+        else
+            out += "{";
+
+        snprintf(text, sizeof(text),
+                 "\"connections\":%llu,\"requests\":%llu,\"states\":%llu,"
+                 "\"latency_us\":",
+                 (unsigned long long)peer.connections,
+                 (unsigned long long)peer.requests,
+                 (unsigned long long)peer.states);
+        out += text;
+        peer.latency.json(out);
+        out += "}";
+        return;
+    }
+
+    /** Merge the metrics of a closing client into its peer record.  */
+    void _retire (const Client &client)
+    {
+        uint64 key = (uint64(client.uid) << 32) | client.pid;
+
+        if (!_peers.count(key) && _peers.size() >= MAX_PEERS)
+        {
+            std::map<uint64, Peer>::iterator oldest = _peers.begin();
+
+            for (std::map<uint64, Peer>::iterator it = _peers.begin();
+                 it != _peers.end(); ++it)
+                if (it->second.lastClosed < oldest->second.lastClosed)
+                    oldest = it;
+
+            _otherPeers.connections += oldest->second.connections;
+            _otherPeers.requests += oldest->second.requests;
+            _otherPeers.states += oldest->second.states;
+            _otherPeers.latency.merge(oldest->second.latency);
+            _peers.erase(oldest);
+        }
+
+        Peer &peer = _peers[key];
+
+        peer.pid = client.pid;
+        peer.uid = client.uid;
+        ++peer.connections;
+        peer.requests += client.requests;
+        peer.states += client.states;
+        peer.lastClosed = toolNowNs();
+        peer.latency.merge(client.latency);
+        return;
+    }
+
+    /** Whether a client has stopped sending and has been answered.  */
+    static bool _finished (const Client &client)
+    {
+        return (client.eof || client.closing) && client.inFlight == 0 &&
+               client.outSent == client.out.size();
+    }
+
+    /** Close the finished clients.  */
+    void _reap (void)
+    {
+        std::map<uint64, Client>::iterator it = _clients.begin();
+
+        while (it != _clients.end())
+        {
+            uint64 key = (it++)->first;
+
+            if (_finished(_clients[key]))
+                _close(key);
+        }
+
+        return;
+    }
+
+    /** Update the registered events of a client.  A client with nothing
+     *  to wait for is removed from the epoll set, so a hang-up is not
+     *  reported again while its last requests are pending.  */
+    void _update (uint64 key)
+    {
+        Client &client = _clients[key];
+        size_t backlog = client.out.size() - client.outSent;
+        uint32 events = 0;
+
+        if (!client.eof && !client.closing && backlog < MAX_BACKLOG)
+            events |= EPOLLIN;
+
+        if (backlog > 0)
+            events |= EPOLLOUT;
+
+        if (events != client.events)
+        {
+            epoll_event event;
+            event.events = events;
+            event.data.u64 = key;
+
+            if (events == 0)
+                epoll_ctl(_epoll, EPOLL_CTL_DEL, client.fd, NULL);
+            else
+                epoll_ctl(_epoll, client.events ? EPOLL_CTL_MOD :
+                          EPOLL_CTL_ADD, client.fd, &event);
+
+            client.events = events;
+        }
+
+        return;
+    }
+
+    void _accept (void)
+    {
+        for (;;)
+        {
+            int fd = accept4(_listen, NULL, NULL,
+                             SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+            if (fd < 0)
+                return;
+
+            uint64 key = _nextKey++;
+            Client &client = _clients[key];
+
+            client.fd = fd;
+            client.outSent = 0;
+            client.events = EPOLLIN;
+            client.inFlight = 0;
+            client.eof = false;
+            client.closing = false;
+            client.requests = 0;
+            client.states = 0;
+
+            // Unknown peers (no credentials) share the record (0, 0).
+            ucred credentials;
+            socklen_t length = sizeof(credentials);
+
+            if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials,
+                           &length) == 0)
+            {
+                client.pid = uint32(credentials.pid);
+                client.uid = uint32(credentials.uid);
+            }
+            else
+            {
+                client.pid = 0;
+                client.uid = 0;
+            }
+
+            epoll_event event;
+            event.events = EPOLLIN;
+            event.data.u64 = key;
+            epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event);
+            ++_connections;
+
+            if (_verbose)
+                fprintf(stderr, "airServer: client %llu connected\n",
+                        (unsigned long long)key);
+        }
+    }
+
+    void _close (uint64 key)
+    {
+        Client &client = _clients[key];
+
+        if (_verbose)
+        {
+            std::string latency;
+            client.latency.json(latency);
+            fprintf(stderr, "airServer: client %llu closed: %llu requests,"
+                    " %llu states, latency_us %s\n",
+                    (unsigned long long)key,
+                    (unsigned long long)client.requests,
+                    (unsigned long long)client.states, latency.c_str());
+        }
+
+        if (client.events)
+            epoll_ctl(_epoll, EPOLL_CTL_DEL, client.fd, NULL);
+
+        close(client.fd);
+        _retire(client);
+        _clients.erase(key);
+        return;
+    }
+
+    void _read (uint64 key)
+    {
+        Client &client = _clients[key];
+        char buffer[65536];
+        size_t total = 0;
+
+        while (total < MAX_READ)
+        {
+            ssize_t got = recv(client.fd, buffer, sizeof(buffer), 0);
+
+            if (got > 0)
+            {
+                client.in.append(buffer, size_t(got));
+                total += size_t(got);
+            }
+            else if (got == 0)
+            {
+                client.eof = true;
+                break;
+            }
+            else if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            else if (errno != EINTR)
+            {
+                client.eof = true;
+                client.in.clear();
+                break;
+            }
+        }
+
+        _parse(key);
+        _update(key);
+        return;
+    }
+
+    /** Queue a reply header and payload.  */
+    void _reply (Client &client, uint32 id, uint32 status, uint32 columns,
+                 uint32 count, const void *payload, size_t bytes)
+    {
+        AirReplyHeader header;
+
+        header.magic = AIR_REPLY_MAGIC;
+        header.id = id;
+        header.status = status;
+        header.columns = columns;
+        header.count = count;
+        header.bytes = uint32(bytes);
+
+        client.out.append((const char *)&header, sizeof(header));
+
+        if (bytes)
+            client.out.append((const char *)payload, bytes);
+        return;
+    }
+
+    /** Split the complete requests of a client into the groups.  */
+    void _parse (uint64 key)
+    {
+        Client &client = _clients[key];
+        size_t position = 0;
+
+        while (!client.closing &&
+               client.in.size() - position >= sizeof(AirRequestHeader))
+        {
+            AirRequestHeader header;
+            memcpy(&header, client.in.data() + position, sizeof(header));
+
+            bool bad = (header.magic != AIR_REQUEST_MAGIC) ||
+                       (header.mode > AIR_MODE_STATS) ||
+                       (header.count > AIR_MAX_STATES) ||
+                       (header.properties >> AirBatch::NUM_PROPERTIES) ||
+                       (header.mode == AIR_MODE_STATS && header.count);
+
+            size_t bytes = sizeof(header) + 2 * sizeof(double) *
+                                            size_t(bad ? 0 : header.count);
+
+            if (!bad && client.in.size() - position < bytes)
+                break;
+
+            if (bad || header.mode == AIR_MODE_STATS)
+            {
+                // Earlier requests of this client are answered first.
+                _evaluate();
+
+                if (bad)
+                {
+                    _reply(client, header.id, AIR_STATUS_BAD_REQUEST, 0, 0,
+                           NULL, 0);
+                    client.closing = true;
+                }
+                else
+                {
+                    std::string json = statsJson();
+                    _reply(client, header.id, AIR_STATUS_OK, 0, 0,
+                           json.data(), json.size());
+                }
+
+                _flush(key, false);
+                position += bytes;
+                continue;
+            }
+
+            Pending pending;
+            pending.client = key;
+            pending.id = header.id;
+            pending.group = _group(header.mode, header.properties);
+            pending.count = header.count;
+            pending.arrival = toolNowNs();
+
+            Group &group = _groups[pending.group];
+
+            pending.first = group.states.size() / 2;
+            group.states.resize(group.states.size() + 2 * header.count);
+
+            if (header.count)
+                memcpy(&group.states[2 * pending.first],
+                       client.in.data() + position + sizeof(header),
+                       bytes - sizeof(header));
+
+            if (_pending.empty())
+                _pendingSince = pending.arrival;
+
+            _pending.push_back(pending);
+            _pendingStates += header.count;
+            ++client.inFlight;
+            position += bytes;
+        }
+
+        client.in.erase(0, position);
+        return;
+    }
+
+    /** Find (or start) the group of a mode and property set.  */
+    uint32 _group (uint32 mode, uint32 properties)
+    {
+        for (uint32 i = 0; i < _groups.size(); ++i)
+            if (_groups[i].mode == mode && _groups[i].properties == properties)
+                return i;
+
+        Group group;
+        group.mode = mode;
+        group.properties = properties;
+
+        if (properties)
+        {
+            uint32 columns[AirBatch::NUM_PROPERTIES],
+                   count = 0;
+
+            for (uint32 p = 0; p < AirBatch::NUM_PROPERTIES; ++p)
+                if (properties & (1u << p))
+                    columns[count++] = p;
+
+            group.batch.setColumns(columns, count);
+        }
+
+        _groups.push_back(group);
+        return uint32(_groups.size() - 1);
+    }
+
+    /** Evaluate every group and queue the replies in arrival order.  */
+    void _evaluate (void)
+    {
+        if (_pending.empty())
+            return;
+
+        for (uint32 i = 0; i < _groups.size(); ++i)
+        {
+            Group &group = _groups[i];
+            size_t count = group.states.size() / 2;
+
+            group.values.resize(count * group.batch.getNumColumns());
+            group.batch.evaluate(group.mode == AIR_MODE_PH ?
+                                 AirBatch::INPUT_PH : AirBatch::INPUT_PT,
+                                 group.states.data(), count,
+                                 group.values.data());
+
+            if (count)
+                ++_batches;
+        }
+
+        std::vector<uint64> touched;
+
+        for (uint32 i = 0; i < _pending.size(); ++i)
+        {
+            const Pending &pending = _pending[i];
+            std::map<uint64, Client>::iterator it =
+                _clients.find(pending.client);
+
+            ++_batchRequests;
+            _batchStates += pending.count;
+
+            if (it == _clients.end())
+                continue;
+
+            const Group &group = _groups[pending.group];
+            uint32 columns = group.batch.getNumColumns();
+            Client &client = it->second;
+            uint64 latency = toolNowNs() - pending.arrival;
+
+            _reply(client, pending.id, AIR_STATUS_OK, columns,
+                   pending.count, &group.values[pending.first * columns],
+                   size_t(pending.count) * columns * sizeof(double));
+
+            client.latency.add(latency);
+            _latency.add(latency);
+            ++client.requests;
+            client.states += pending.count;
+            --client.inFlight;
+
+            if (touched.empty() || touched.back() != pending.client)
+                touched.push_back(pending.client);
+        }
+
+        _pending.clear();
+        _pendingStates = 0;
+
+        for (uint32 i = 0; i < _groups.size(); ++i)
+            _groups[i].states.clear();
+
+        for (uint32 i = 0; i < touched.size(); ++i)
+            if (_clients.count(touched[i]))
+                _flush(touched[i]);
+
+        return;
+    }
+
+    /** Send as much queued output as the socket takes.  */
+    void _flush (uint64 key, bool update = true)
+    {
+        Client &client = _clients[key];
+
+        while (client.outSent < client.out.size())
+        {
+            ssize_t sent = send(client.fd, client.out.data() + client.outSent,
+                                client.out.size() - client.outSent,
+                                MSG_NOSIGNAL | MSG_DONTWAIT);
+
+            if (sent > 0)
+                client.outSent += size_t(sent);
+            else if (sent < 0 && errno == EINTR)
+                continue;
+            else
+            {
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    // The peer is gone: drop the output.
+                    client.out.clear();
+                    client.outSent = 0;
+                    client.closing = true;
+                }
+
+                break;
+            }
+        }
+
+        if (client.outSent == client.out.size())
+        {
+            client.out.clear();
+            client.outSent = 0;
+        }
+        else if (client.outSent > (client.out.size() >> 1))
+        {
+            client.out.erase(0, client.outSent);
+            client.outSent = 0;
+        }
+
+        if (update)
+            _update(key);
+
+        return;
+    }
+};
+
+/******************************************************
+**                      Main                         **
+******************************************************/
+
+static void usage (const char *program)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --socket PATH     Unix socket (default /tmp/air-adt.sock)\n"
+            "  --window-ms N     wait up to N ms to coalesce requests\n"
+            "                    (default 0: one batch per wakeup)\n"
+            "  --batch N         states that end the window (default 65536)\n"
+            "  --verbose         log connections and their metrics\n"
+            "The metrics are printed as JSON on SIGINT or SIGTERM.\n",
+            program);
+
+    return;
+}
+
+int main (int argc, char *argv[])
+{
+    const char *path = "/tmp/air-adt.sock";
+    uint64 windowNs = 0;
+    uint32 maxBatch = 65536;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if (!strcmp(argv[i], "--socket") && hasValue)
+            path = argv[++i];
+        else if (!strcmp(argv[i], "--window-ms") && hasValue)
+            windowNs = 1000000ull * strtoull(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--batch") && hasValue)
+            maxBatch = uint32(strtoul(argv[++i], NULL, 10));
+        else if (!strcmp(argv[i], "--verbose"))
+            verbose = true;
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (maxBatch == 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = requestStop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    Server server(windowNs, maxBatch, verbose);
+
+    if (!server.listenOn(path))
+        return 1;
+
+    server.run();
+    fprintf(stderr, "%s\n", server.statsJson().c_str());
+    return 0;
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+||  toolLatency.h      (definition file)                                     ||
+||===========================================================================||
+||                                                                           ||
+||    Creation Date:  2026-10-18                                             ||
+||    Last Edit Date: 2026-10-18                                             ||
+||                                                                           ||
+||===========================================================================||
+||  DESCRIPTION                                                              ||
+||===========================================================================||
+||    Latency histograms for the command-line tools.  Latencies in           ||
+||    nanoseconds are counted in four logarithmic buckets per power of two,  ||
+||    so recording is constant time and memory, and percentiles are          ||
+||    reported within 12.5 %.                                                ||
+||                                                                           ||
+||===========================================================================||
+||  CODE REQUIREMENTS                                                        ||
+||===========================================================================||
+||    air.h                                                                  ||
+||                                                                           ||
+||===========================================================================||
+||  LICENSE    (MIT/X11 License)                                             ||
+||===========================================================================||
+||    Copyright (C) 2013 Gary Hammock                                        ||
+||                                                                           ||
+||    Permission is hereby granted, free of charge, to any person obtaining  ||
+||    a copy of this software and associated documentation files (the        ||
+||    "Software"), to deal in the Software without restriction, including    ||
+||    without limitation the rights to use, copy, modify, merge, publish,    ||
+||    distribute, sublicense, and/or sell copies of the Software, and to     ||
+||    permit persons to whom the Software is furnished to do so, subject to  ||
+||    the following conditions:                                              ||
+||                                                                           ||
+||    The above copyright notice and this permission notice shall be         ||
+||    included in all copies or substantial portions of the Software.        ||
+||                                                                           ||
+||    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        ||
+||    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     ||
+||    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. ||
+||    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   ||
+||    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   ||
+||    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      ||
+||    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 ||
+||                                                                           ||
+******************************************************************************/
+
+/**
+ *  @file toolLatency.h
+ *  @date 2026-10-18
+*/
+
+#ifndef _GH_DEF_TOOL_LATENCY_H
+#define _GH_DEF_TOOL_LATENCY_H
+
+#include "air.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+/** Monotonic time in nanoseconds (comparable between processes).  */
+inline uint64 toolNowNs (void)
+{
+    return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ *  @struct ToolLatency A latency distribution with four logarithmic
+ *          buckets per octave.  Plain data, so it may be copied through
+ *          shared memory.
+*/
+struct ToolLatency
+{
+    // Four buckets per power of two nanoseconds.
+    static const uint32 BUCKETS = 256;
+
+    uint64 buckets[BUCKETS];
+    uint64 count,
+           totalNs,
+           maxNs;
+
+    ToolLatency() : count(0), totalNs(0), maxNs(0)
+    {  memset(buckets, 0, sizeof(buckets));  }
+
+    static uint32 bucket (uint64 ns)
+    {
+        if (ns < 4)
+            return uint32(ns);
+
+        uint32 log = 63 - uint32(__builtin_clzll(ns));
+        return 4 * (log - 1) + uint32((ns >> (log - 2)) & 3);
+    }
+
+    static double lowerBound (uint32 b)
+    {
+        if (b < 4)
+            return double(b);
+
+        return ldexp(double(4 + b % 4), int(b / 4) - 1);
+    }
+
+    void add (uint64 ns)
+    {
+        ++buckets[bucket(ns)];
+        ++count;
+        totalNs += ns;
+
+        if (ns > maxNs)
+            maxNs = ns;
+    }
+
+    /** Add every sample of another distribution.  */
+    void merge (const ToolLatency &other)
+    {
+        for (uint32 b = 0; b < BUCKETS; ++b)
+            buckets[b] += other.buckets[b];
+
+        count += other.count;
+        totalNs += other.totalNs;
+        maxNs = std::max(maxNs, other.maxNs);
+    }
+
+    /** The midpoint of the bucket holding quantile q, in ns.  */
+    double percentile (double q) const
+    {
+        uint64 target = uint64(q * double(count)),
+               seen = 0;
+
+        for (uint32 b = 0; b < BUCKETS; ++b)
+        {
+            seen += buckets[b];
+
+            if (seen > target)
+                return std::min(0.5 * (lowerBound(b) + lowerBound(b + 1)),
+                                double(maxNs));
+        }
+
+        return double(maxNs);
+    }
+
+    /** Append {"mean":..,"p50":..,..,"max":..} in microseconds.  */
+    void json (std::string &out) const
+    {
+        char text[192];
+
+        snprintf(text, sizeof(text),
+                 "{\"mean\":%.2f,\"p50\":%.2f,\"p90\":%.2f,"
+                 "\"p99\":%.2f,\"p999\":%.2f,\"max\":%.2f}",
+                 count ? 1e-3 * double(totalNs) / double(count) : 0.0,
+                 1e-3 * percentile(0.5), 1e-3 * percentile(0.9),
+                 1e-3 * percentile(0.99), 1e-3 * percentile(0.999),
+                 1e-3 * double(maxNs));
+        out += text;
+    }
+};
+
+#endif